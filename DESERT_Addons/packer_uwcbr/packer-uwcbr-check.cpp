@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file packer-uwcbr-check.cpp
+ * \version 1.0.0
+ * \brief Check program of packerUWCBR::Schema: hdr_uwcbr is packed and
+ * unpacked with the schema and with the field by field code of packerUWCBR
+ * it replaced, and the two must match bit for bit.
+ */
+
+#include "packer-uwcbr.h"
+#include "packer-check.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+const int TRIALS = 1000; /**< Random headers checked for each widths. */
+const int WIDTHS = 200; /**< Random widths checked. */
+const size_t REPEAT = 200000; /**< Runs timed. */
+
+/**
+ * packerUWCBR::packMyHdr before packerUWCBR::Schema, with the bit by bit
+ * copy.
+ */
+size_t
+legacyPack(const hdr_uwcbr *uch, unsigned char *buf, size_t offset,
+		const size_t *n_bits)
+{
+	int field_idx = 0;
+	offset += PackerBitLoop::put(
+			buf, offset, &(uch->sn_), n_bits[field_idx++]);
+	offset += PackerBitLoop::put(
+			buf, offset, &(uch->rftt_), n_bits[field_idx++]);
+	offset += PackerBitLoop::put(
+			buf, offset, &(uch->rftt_valid_), n_bits[field_idx++]);
+	offset += PackerBitLoop::put(
+			buf, offset, &(uch->traffic_type_), n_bits[field_idx++]);
+	return offset;
+}
+
+/**
+ * packerUWCBR::unpackMyHdr before packerUWCBR::Schema, with the bit by bit
+ * copy.
+ */
+size_t
+legacyUnpack(const unsigned char *buf, size_t offset, hdr_uwcbr *uch,
+		const size_t *n_bits)
+{
+	int field_idx = 0;
+
+	memset(&(uch->sn_), 0, sizeof(uch->sn_));
+	offset += PackerBitLoop::get(
+			buf, offset, &(uch->sn_), n_bits[field_idx++]);
+
+	memset(&(uch->rftt_), 0, sizeof(uch->rftt_));
+	offset += PackerBitLoop::get(
+			buf, offset, &(uch->rftt_), n_bits[field_idx++]);
+
+	memset(&(uch->rftt_valid_), 0, sizeof(uch->rftt_valid_));
+	offset += PackerBitLoop::get(
+			buf, offset, &(uch->rftt_valid_), n_bits[field_idx++]);
+
+	memset(&(uch->traffic_type_), 0, sizeof(uch->traffic_type_));
+	offset += PackerBitLoop::get(
+			buf, offset, &(uch->traffic_type_), n_bits[field_idx++]);
+
+	return offset;
+}
+
+} // namespace
+
+int
+main()
+{
+	srand(1);
+	typedef packerUWCBR::Schema Schema;
+
+	// widths of packer-uwcbr-init.tcl
+	std::vector<size_t> n_bits = {32, 0, 0, 0};
+	if (Schema::bits != 32 || !Schema::isDefault(n_bits)) {
+		fprintf(stderr, "packerUWCBR::Schema does not match the Tcl widths\n");
+		return 1;
+	}
+
+	int errors = 0;
+	errors += packerCheckSchema<Schema, hdr_uwcbr>(
+			"packerUWCBR", n_bits, true, legacyPack, legacyUnpack, TRIALS);
+	errors += packerCheckSchema<Schema, hdr_uwcbr>(
+			"packerUWCBR", n_bits, false, legacyPack, legacyUnpack, TRIALS);
+
+	// widths changed from Tcl, up to the size of each field
+	const size_t max_bits[] = {sizeof(uint16_t) * CHAR_BIT,
+			sizeof(float) * CHAR_BIT,
+			sizeof(bool) * CHAR_BIT,
+			sizeof(uint16_t) * CHAR_BIT};
+	std::vector<size_t> random_bits(n_bits.size());
+	for (int w = 0; w < WIDTHS && errors == 0; w++) {
+		for (size_t i = 0; i < random_bits.size(); i++)
+			random_bits[i] = rand() % (max_bits[i] + 1);
+		errors += packerCheckSchema<Schema, hdr_uwcbr>("packerUWCBR",
+				random_bits,
+				false,
+				legacyPack,
+				legacyUnpack,
+				TRIALS / 10);
+	}
+
+	if (errors > 0)
+		return 1;
+	printf("packerUWCBR::Schema matches the handwritten packer\n");
+
+	hdr_uwcbr hdr;
+	hdr_uwcbr out;
+	packerCheckRandomize(&hdr, sizeof(hdr));
+	unsigned char buf[Schema::bits / CHAR_BIT + 1] = {0};
+
+	double by_hand = packerCheckTime(REPEAT, [&]() {
+		legacyPack(&hdr, buf, 0, &n_bits[0]);
+		legacyUnpack(buf, 0, &out, &n_bits[0]);
+	});
+	double by_widths = packerCheckTime(REPEAT, [&]() {
+		Schema::pack(&hdr, buf, 0, &n_bits[0]);
+		Schema::unpack(buf, 0, &out, &n_bits[0]);
+	});
+	double by_schema = packerCheckTime(REPEAT, [&]() {
+		Schema::pack(&hdr, buf, 0);
+		Schema::unpack(buf, 0, &out);
+	});
+	printf("pack and unpack of hdr_uwcbr [ns]: bit loop %.1f, schema with "
+		   "widths %.1f, schema with default widths %.1f\n",
+			by_hand,
+			by_widths,
+			by_schema);
+
+	return 0;
+}
@@ -78,6 +78,8 @@ packerUWCBR::packerUWCBR()
 	n_bits.push_back(RFTT_Bits);
 	n_bits.push_back(RFTT_VALID_Bits);
 	n_bits.push_back(TRAFFIC_TYPE_Bits);
+
+	default_bits_ = Schema::isDefault(n_bits);
 }
 
 packerUWCBR::~packerUWCBR()
@@ -97,6 +99,8 @@ packerUWCBR::init()
 	n_bits.push_back(RFTT_Bits);
 	n_bits.push_back(RFTT_VALID_Bits);
 	n_bits.push_back(TRAFFIC_TYPE_Bits);
+
+	default_bits_ = Schema::isDefault(n_bits);
 }
 
 size_t
@@ -108,15 +112,10 @@ packerUWCBR::packMyHdr(Packet *p, unsigned char *buf, size_t offset)
 	hdr_uwcbr *uch = HDR_UWCBR(p);
 
 	if (ch->ptype() == PT_UWCBR) {
-		int field_idx = 0;
-
-		offset += put(buf, offset, &(uch->sn_), n_bits[field_idx++]);
-
-		offset += put(buf, offset, &(uch->rftt_), n_bits[field_idx++]);
-
-		offset += put(buf, offset, &(uch->rftt_valid_), n_bits[field_idx++]);
-
-		offset += put(buf, offset, &(uch->traffic_type_), n_bits[field_idx++]);
+		if (default_bits_)
+			offset = Schema::pack(uch, buf, offset);
+		else
+			offset = Schema::pack(uch, buf, offset, &n_bits[0]);
 
 		if (debug_) {
 			printf("\033[0;46;30m TX CBR packer hdr \033[0m \n");
@@ -136,19 +135,10 @@ packerUWCBR::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	hdr_uwcbr *uch = HDR_UWCBR(p);
 
 	if (ch->ptype() == PT_UWCBR) {
-		int field_idx = 0;
-
-		memset(&(uch->sn_), 0, sizeof(uch->sn_));
-		offset += get(buf, offset, &(uch->sn_), n_bits[field_idx++]);
-
-		memset(&(uch->rftt_), 0, sizeof(uch->rftt_));
-		offset += get(buf, offset, &(uch->rftt_), n_bits[field_idx++]);
-
-		memset(&(uch->rftt_valid_), 0, sizeof(uch->rftt_valid_));
-		offset += get(buf, offset, &(uch->rftt_valid_), n_bits[field_idx++]);
-
-		memset(&(uch->traffic_type_), 0, sizeof(uch->traffic_type_));
-		offset += get(buf, offset, &(uch->traffic_type_), n_bits[field_idx++]);
+		if (default_bits_)
+			offset = Schema::unpack(buf, offset, uch);
+		else
+			offset = Schema::unpack(buf, offset, uch, &n_bits[0]);
 
 		if (debug_) {
 			printf("\033[0;46;30m RX CBR packer hdr \033[0m \n");
@@ -159,6 +149,12 @@ packerUWCBR::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	return offset;
 }
 
+size_t
+packerUWCBR::getMyHdrBinLength()
+{
+	return default_bits_ ? Schema::bits : packer::getMyHdrBinLength();
+}
+
 void
 packerUWCBR::printMyHdrMap()
 {
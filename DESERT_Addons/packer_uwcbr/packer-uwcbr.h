@@ -39,6 +39,7 @@
 
 // #include "../../packer.h"
 
+#include "packer-schema.h"
 #include "packer.h"
 #include "uwcbr-module.h"
 
@@ -61,6 +62,16 @@ public:
 	 */
 	~packerUWCBR();
 
+	/**
+	 * Fields of hdr_uwcbr serialized by the packer, with their default
+	 * widths.
+	 */
+	typedef PackerSchema<PackerField<hdr_uwcbr, uint16_t, &hdr_uwcbr::sn_, 32>,
+			PackerField<hdr_uwcbr, float, &hdr_uwcbr::rftt_, 0>,
+			PackerField<hdr_uwcbr, bool, &hdr_uwcbr::rftt_valid_, 0>,
+			PackerField<hdr_uwcbr, uint16_t, &hdr_uwcbr::traffic_type_, 0> >
+			Schema;
+
 private:
 	/**
 	 * Init the Packer
@@ -94,7 +105,14 @@ private:
 	 * @param Pointer of the packet
 	 */
 	void printMyHdrFields(Packet *);
+	/**
+	 * Method returning the length in bits of the serialized header
+	 * @return Number of bits of the header
+	 */
+	size_t getMyHdrBinLength();
 
+	bool default_bits_; /**< True if n_bits holds the default widths of
+						   Schema. */
 	size_t SN_Bits; /** Bit length of the sn_ field to be put in the header
 					   stream of bits. */
 	size_t RFTT_Bits; /** Bit length of the rftt_ field to be put in the header
@@ -40,6 +40,7 @@ Module/UW/SC/CTR set destAddr_           0
 Module/UW/SC/CTR set debug_              0
 Module/UW/SC/CTR set PoissonTraffic_     1
 Module/UW/SC/CTR set drop_out_of_order_  0
+Module/UW/SC/CTR set dup_window_         32768
 Module/UW/SC/CTR set adaptiveRTO_     	  0
 Module/UW/SC/CTR set traffic_type_		  0
 Module/UW/SC/CTR set tracefile_enabler_  0
@@ -51,6 +52,7 @@ Module/UW/ROV set destAddr_           0
 Module/UW/ROV set debug_              0
 Module/UW/ROV set PoissonTraffic_     1
 Module/UW/ROV set drop_out_of_order_  0
+Module/UW/ROV set dup_window_         32768
 Module/UW/ROV set ackTimeout_		  10
 Module/UW/ROV set ackPriority_ 		  0
 Module/UW/ROV set drop_old_waypoints_ 0
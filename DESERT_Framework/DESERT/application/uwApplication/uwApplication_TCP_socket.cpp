@@ -38,6 +38,7 @@
  */
 
 #include "uwApplication_module.h"
+#include "uwlog.h"
 
 bool
 uwApplicationModule::listenTCP()
@@ -45,7 +46,7 @@ uwApplicationModule::listenTCP()
 	int sockoptval = 1;
 
 	if ((servSockDescr = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"listenTCP()::Socket creation failed");
 
@@ -58,14 +59,14 @@ uwApplicationModule::listenTCP()
 				&sockoptval,
 				sizeof(int)) == -1) {
 
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"listenTCP()::Set socket failed");
 
 		return false;
 	}
 
-	printOnLog(Logger::LogLevel::INFO,
+	UWLOG(Logger::LogLevel::INFO,
 			"UWAPPLICATION",
 			"listenTCP()::Socket created");
 
@@ -76,7 +77,7 @@ uwApplicationModule::listenTCP()
 
 	if (::bind(servSockDescr, (struct sockaddr *) &servAddr, sizeof(servAddr)) <
 			0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"listenTCP()::Socket binding failed: " +
 						std::string(strerror(errno)));
@@ -85,14 +86,14 @@ uwApplicationModule::listenTCP()
 	}
 
 	if (listen(servSockDescr, 1)) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"listenTCP()::Socket listen failed");
 
 		return false;
 	}
 
-	printOnLog(Logger::LogLevel::INFO,
+	UWLOG(Logger::LogLevel::INFO,
 			"UWAPPLICATION",
 			"listenTCP()::Socket listening");
 
@@ -110,14 +111,14 @@ uwApplicationModule::acceptTCP()
 		if ((clnSockDescr = accept(servSockDescr,
 					 (struct sockaddr *) &(clnAddr),
 					 (socklen_t *) &clnLen)) < 0) {
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWAPPLICATION",
 					"acceptTCP()::Socket connection not accepted");
 
 			continue;
 		}
 
-		printOnLog(Logger::LogLevel::INFO,
+		UWLOG(Logger::LogLevel::INFO,
 				"UWAPPLICATION",
 				"acceptTCP()::Socket accept connection from " +
 						std::string(inet_ntoa(clnAddr.sin_addr)));
@@ -138,7 +139,7 @@ uwApplicationModule::readFromTCP(int clnSock)
 		}
 
 		if ((recvMsgSize = read(clnSock, buffer_msg, MAX_READ_LEN)) < 0) {
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWAPPLICATION",
 					"readFromTCP(int)::Read from socket failed");
 
@@ -146,7 +147,7 @@ uwApplicationModule::readFromTCP(int clnSock)
 		}
 
 		if (recvMsgSize == 0) {
-			printOnLog(Logger::LogLevel::INFO,
+			UWLOG(Logger::LogLevel::INFO,
 					"UWAPPLICATION",
 					"readFromTCP(int)::Socket disconnected");
 
@@ -160,7 +161,7 @@ uwApplicationModule::readFromTCP(int clnSock)
 		hdr_cmn *ch = HDR_CMN(p);
 		hdr_DATA_APPLICATION *hdr_Appl = HDR_DATA_APPLICATION(p);
 
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWAPPLICATION",
 				"readFromTCP(int)::Socket payload received : " +
 						std::string(buffer_msg, recvMsgSize));
@@ -38,6 +38,7 @@
  */
 
 #include "uwApplication_module.h"
+#include "uwlog.h"
 
 bool
 uwApplicationModule::openConnectionUDP()
@@ -46,7 +47,7 @@ uwApplicationModule::openConnectionUDP()
 
 	// Create socket for incoming connections
 	if ((servSockDescr = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"openConnectionUDP()::Socket creation failed");
 
@@ -58,12 +59,12 @@ uwApplicationModule::openConnectionUDP()
 				SO_REUSEADDR,
 				&sockoptval,
 				sizeof(int)) == -1) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"openConnectionUDP()::Set socket failed");
 	}
 
-	printOnLog(Logger::LogLevel::INFO,
+	UWLOG(Logger::LogLevel::INFO,
 			"UWAPPLICATION",
 			"openConnectionUDP()::Socket created");
 
@@ -74,7 +75,7 @@ uwApplicationModule::openConnectionUDP()
 
 	if (::bind(servSockDescr, (struct sockaddr *) &servAddr, sizeof(servAddr)) <
 			0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"openConnectionUDP()::Socket binding failed: " +
 						std::string(strerror(errno)));
@@ -105,7 +106,7 @@ uwApplicationModule::readFromUDP()
 					 (struct sockaddr *) &(clnAddr),
 					 &clnLen)) < 0) {
 
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWAPPLICATION",
 					"readFromUDP()::Receive from socket failed");
 
@@ -118,7 +119,7 @@ uwApplicationModule::readFromUDP()
 			hdr_cmn *ch = HDR_CMN(p);
 			hdr_DATA_APPLICATION *hdr_Appl = HDR_DATA_APPLICATION(p);
 
-			printOnLog(Logger::LogLevel::DEBUG,
+			UWLOG(Logger::LogLevel::DEBUG,
 					"UWAPPLICATION",
 					"readFromUDP()::Socket payload received : " +
 							std::string(buffer_msg, recvMsgSize));
@@ -37,6 +37,7 @@
  */
 
 #include "uwApplication_module.h"
+#include "uwlog.h"
 #include <rng.h>
 #include <uwip-module.h>
 #include <uwudp-module.h>
@@ -246,7 +247,7 @@ uwApplicationModule::recv(Packet *p)
 	hdr_DATA_APPLICATION *uwApph = HDR_DATA_APPLICATION(p);
 
 	if (ch->ptype_ != PT_DATA_APPLICATION) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWAPPLICATION",
 				"recv(Packet *)::Drop packet, wrong type");
 
@@ -261,7 +262,7 @@ uwApplicationModule::recv(Packet *p)
 	if (useDropOutOfOrder()) {
 		// Packet already processed: drop it
 		if (sn_check[uwApph->sn_ & 0x00ffffff]) {
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWAPPLICATION",
 					"recv(Packet *)::Drop packet with sn " +
 							to_string((int) uwApph->sn_) +
@@ -284,7 +285,7 @@ uwApplicationModule::recv(Packet *p)
 		if (uwApph->sn_ < esn) {
 			incrPktOoseq();
 
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWAPPLICATION",
 					"recv(Packet *)::Drop packet with sn " +
 							to_string((int) uwApph->sn_) + ", out of sequence");
@@ -308,7 +309,7 @@ uwApplicationModule::recv(Packet *p)
 	if (useDropOutOfOrder()) {
 		// Verify if a packet is lost
 		if (uwApph->sn_ > esn) {
-			printOnLog(Logger::LogLevel::DEBUG,
+			UWLOG(Logger::LogLevel::DEBUG,
 					"UWAPPLICATION",
 					"recv(Packet *)::Packet lost. Received has sn " +
 							to_string((int) uwApph->sn_) +
@@ -327,17 +328,17 @@ uwApplicationModule::recv(Packet *p)
 	incrPktRecv();
 
 	if (!withoutSocket())
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWAPPLICATION",
 				"recv(Packet *)::Payload received : " +
 						std::string(
 								uwApph->payload_msg, uwApph->payload_size()));
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"recv(Packet *)::Payload size : " +
 					to_string((int) uwApph->payload_size()));
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"recv(Packet *)::Sequence number : " +
 					to_string((int) uwApph->sn()));
@@ -417,20 +418,20 @@ uwApplicationModule::transmit()
 	}
 	uwApph->priority() = 0;
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"transmit()::Unique id : " + to_string(ch->uid()));
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"transmit()::Dest addr : " + to_string((int) uwiph->daddr()));
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"transmit()::Payload size : " +
 					to_string((int) uwApph->payload_size()));
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"transmit()::Sequence number : " + to_string((int) uwApph->sn()));
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWAPPLICATION",
 			"transmit()::Send down packet");
 
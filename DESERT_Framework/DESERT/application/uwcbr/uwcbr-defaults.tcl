@@ -39,6 +39,7 @@ Module/UW/CBR set destAddr_           0
 Module/UW/CBR set debug_              0
 Module/UW/CBR set PoissonTraffic_     1
 Module/UW/CBR set drop_out_of_order_  1
+Module/UW/CBR set dup_window_         32768
 Module/UW/CBR set traffic_type_		  0
 Module/UW/CBR set tracefile_enabler_  0
 
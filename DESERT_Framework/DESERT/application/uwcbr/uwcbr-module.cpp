@@ -38,6 +38,7 @@
  */
 
 #include "uwcbr-module.h"
+#include "uwlog.h"
 
 #include <iostream>
 #include <rng.h>
@@ -97,6 +98,8 @@ UwCbrModule::UwCbrModule()
 	, PoissonTraffic_(0)
 	, debug_(0)
 	, drop_out_of_order_(0)
+	, dup_window_(UWCBR_DEFAULT_DUP_WINDOW)
+	, dup_filter(UWCBR_DEFAULT_DUP_WINDOW, 8 * sizeof(uint16_t))
 	, traffic_type_(0)
 	, sendTmr_(this)
 	, txsn(1)
@@ -130,12 +133,9 @@ UwCbrModule::UwCbrModule()
 	bind("PoissonTraffic_", &PoissonTraffic_);
 	bind("debug_", &debug_);
 	bind("drop_out_of_order_", &drop_out_of_order_);
+	bind("dup_window_", &dup_window_);
 	bind("traffic_type_", (uint *) &traffic_type_);
 	bind("tracefile_enabler_", (int *) &tracefile_enabler_);
-	sn_check = new bool[USHRT_MAX];
-	for (int i = 0; i < USHRT_MAX; i++) {
-		sn_check[i] = false;
-	}
 }
 
 int
@@ -278,7 +278,7 @@ UwCbrModule::sendPkt()
 	hdr_cmn *ch = hdr_cmn::access(p);
 	hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCBR",
 			"sendPkt()::send a packet (" + to_string(ch->uid()) +
 					") with sn: " + to_string(uwcbrh->sn()));
@@ -296,7 +296,7 @@ UwCbrModule::sendPktLowPriority()
 	hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 	uwcbrh->priority() = 0;
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCBR",
 			"sendPktLowPriority()::send a packet (" + to_string(ch->uid()) +
 					") with sn: " + to_string(uwcbrh->sn()));
@@ -314,7 +314,7 @@ UwCbrModule::sendPktHighPriority()
 	hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 	uwcbrh->priority() = 1;
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCBR",
 			"sendPktHighPriority()::send a packet (" + to_string(ch->uid()) +
 					") with sn: " + to_string(uwcbrh->sn()));
@@ -346,7 +346,7 @@ UwCbrModule::recv(Packet *p)
 {
 	hdr_cmn *ch = hdr_cmn::access(p);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCBR",
 			"recv(Packet *)::received packet with id " + to_string(ch->uid()));
 
@@ -359,23 +359,27 @@ UwCbrModule::recv(Packet *p)
 	hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 	esn = hrsn + 1; // expected sn
 
-	if (!drop_out_of_order_) {
-		if (sn_check[uwcbrh->sn() & 0x00ffffff]) {
-			// Packet already processed: drop it
-			incrPktInvalid();
-			drop(p, 1, UWCBR_DROP_REASON_DUPLICATED_PACKET);
-			return;
-		}
-	}
+	if ((uint32_t) dup_window_ != dup_filter.getWindow())
+		dup_filter.setWindow(dup_window_);
 
-	sn_check[uwcbrh->sn() & 0x00ffffff] = true;
+	bool duplicated = dup_filter.isDuplicate(
+			UwDupFilter::flowId(
+					HDR_UWUDP(p)->sport(), hdr_uwip::access(p)->saddr()),
+			uwcbrh->sn());
+
+	if (!drop_out_of_order_ && duplicated) {
+		// Packet already processed: drop it
+		incrPktInvalid();
+		drop(p, 1, UWCBR_DROP_REASON_DUPLICATED_PACKET);
+		return;
+	}
 
 	if (drop_out_of_order_) {
 		if (uwcbrh->sn() < esn) {
 			// packet is out of sequence and is to be discarded
 			incrPktOoseq();
 
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWCBR",
 					"recv(Packet *)::packet out of sequence sn = " +
 							to_string(uwcbrh->sn()) + " hrsn = " +
@@ -420,7 +424,7 @@ UwCbrModule::recv(Packet *p)
 	if (drop_out_of_order_) {
 		if (pkts_lost + pkts_recv + pkts_last_reset != hrsn) {
 
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWCBR",
 					"recv(Packet *)::pkts_lost = " + to_string(pkts_lost) +
 							" pkts_recv = " + to_string(pkts_recv) +
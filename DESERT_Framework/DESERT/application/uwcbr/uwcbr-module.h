@@ -56,6 +56,8 @@
 	"OOS" /**< Reason for a drop in a <i>UWCBR</i> module. */
 #define UWCBR_DROP_REASON_DUPLICATED_PACKET \
 	"DPK" /**< Reason for a drop in a <i>UWCBR</i> module. */
+#define UWCBR_DEFAULT_DUP_WINDOW \
+	32768 /**< Default window of the <i>UWCBR</i> duplicate filter. */
 
 #define HDR_UWCBR(p) (hdr_uwcbr::access(p))
 
@@ -269,13 +271,16 @@ protected:
 	std::ofstream tracefile;
 	std::string tracefilename;
 
-	bool *sn_check; /**< Used to keep track of the packets already received. */
 
 	int PoissonTraffic_; /**< <i>1</i> if the traffic is generated according to
 							a poissonian distribution, <i>0</i> otherwise. */
 	int debug_; /**< Flag to enable several levels of debug. */
 	int drop_out_of_order_; /**< Flag to enable or disable the check for out of
 							   order packets. */
+	int dup_window_; /**< Number of sequence numbers tracked for each source
+						to detect duplicated packets. */
+	UwDupFilter dup_filter; /**< Sliding window of the sequence numbers
+							   received from each source. */
 	uint traffic_type_; /**< Traffic type of the packets. */
 
 	UwSendTimer sendTmr_; /**< Timer which schedules packet transmissions. */
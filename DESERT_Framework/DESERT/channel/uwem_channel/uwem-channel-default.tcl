@@ -32,3 +32,5 @@
 
 Module/UW/ElectroMagnetic/Channel set RefractiveIndex_ 1.33
 
+Module/UW/ElectroMagnetic/Channel set CutoffRange_ 0
+Module/UW/ElectroMagnetic/Channel set GridRefreshPeriod_ 0
@@ -37,13 +37,16 @@
  */
 
 #include <cassert>
+#include <cmath>
 #include <iostream>
 
 #include "uwem-channel.h"
+#include "uwmobilitymanager.h"
 
 #define SPEED_OF_LIGHT_VACUUM (3e8)
 #define REFRACTIVE_INDEX_MIN (1)
 #define REFRACTIVE_INDEX_WATER (1.33)
+#define GRID_CELL_BITS (21)
 
 /**
  * Adds the module for UwElectroMagneticChannel in ns2.
@@ -66,8 +69,18 @@ UwElectroMagneticChannel::UwElectroMagneticChannel()
 	: ChannelModule()
 	, refractive_index(REFRACTIVE_INDEX_WATER)
 	, speed_of_light(SPEED_OF_LIGHT_VACUUM)
+	, cutoff_range_(0)
+	, grid_refresh_period_(0)
+	, grid_time_(-1)
+	, grid_cell_size_(0)
+	, grid_chsap_num_(0)
+	, grid_()
+	, deliveries_(0)
+	, culled_deliveries_(0)
 {
 	bind("RefractiveIndex_", (double *) &refractive_index);
+	bind("CutoffRange_", (double *) &cutoff_range_);
+	bind("GridRefreshPeriod_", (double *) &grid_refresh_period_);
 
 	if (refractive_index < REFRACTIVE_INDEX_MIN) {
 		refractive_index = REFRACTIVE_INDEX_MIN;
@@ -79,7 +92,16 @@ UwElectroMagneticChannel::UwElectroMagneticChannel()
 int
 UwElectroMagneticChannel::command(int argc, const char *const *argv)
 {
-	// Tcl& tcl = Tcl::instance();
+	Tcl &tcl = Tcl::instance();
+	if (argc == 2) {
+		if (strcasecmp(argv[1], "getDeliveries") == 0) {
+			tcl.resultf("%lu", deliveries_);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getCulledDeliveries") == 0) {
+			tcl.resultf("%lu", culled_deliveries_);
+			return TCL_OK;
+		}
+	}
 	return ChannelModule::command(argc, argv);
 }
 
@@ -97,19 +119,111 @@ UwElectroMagneticChannel::sendUpPhy(Packet *p, ChSAP *chsap)
 	if (debug_)
 		cout << "UwElectroMagneticChannel::sendUpPhy() sending packet" << endl;
 
-	for (int i = 0; i < getChSAPnum(); i++) {
-		dest = (ChSAP *) getChSAP(i);
+	if (cutoff_range_ <= 0) {
+		for (int i = 0; i < getChSAPnum(); i++) {
+			dest = (ChSAP *) getChSAP(i);
+
+			if (chsap == dest) // it's the source node -> skip it
+				continue;
 
-		if (chsap == dest) // it's the source node -> skip it
-			continue;
+			s.schedule(dest,
+					p->copy(),
+					getPropDelay(sourcePos, dest->getPosition()));
+			deliveries_++;
+		}
 
-		s.schedule(
-				dest, p->copy(), getPropDelay(sourcePos, dest->getPosition()));
+		Packet::free(p);
+		return;
 	}
 
+	updateGrid();
+
+	int64_t cx = getCell(sourcePos->getX());
+	int64_t cy = getCell(sourcePos->getY());
+	int64_t cz = getCell(sourcePos->getZ());
+	unsigned long delivered = 0;
+
+	for (int64_t x = cx - 1; x <= cx + 1; x++) {
+		for (int64_t y = cy - 1; y <= cy + 1; y++) {
+			for (int64_t z = cz - 1; z <= cz + 1; z++) {
+				std::map<uint64_t, std::vector<ChSAP *>>::const_iterator it =
+						grid_.find(getCellKey(x, y, z));
+				if (it == grid_.end())
+					continue;
+
+				for (size_t i = 0; i < it->second.size(); i++) {
+					dest = it->second[i];
+
+					if (chsap == dest) // it's the source node -> skip it
+						continue;
+
+					Position *destPos = dest->getPosition();
+					if (sourcePos->getDist(destPos) > cutoff_range_)
+						continue;
+
+					s.schedule(dest,
+							p->copy(),
+							getPropDelay(sourcePos, destPos));
+					delivered++;
+				}
+			}
+		}
+	}
+
+	deliveries_ += delivered;
+	culled_deliveries_ += getChSAPnum() - 1 - delivered;
+
+	if (debug_)
+		cout << "UwElectroMagneticChannel::sendUpPhy() delivered "
+			 << delivered << " copies out of " << getChSAPnum() - 1 << endl;
+
 	Packet::free(p);
 }
 
+void
+UwElectroMagneticChannel::updateGrid()
+{
+	if (!grid_.empty() && grid_chsap_num_ == getChSAPnum() &&
+			grid_cell_size_ == cutoff_range_ &&
+			NOW <= grid_time_ + grid_refresh_period_)
+		return;
+
+	grid_.clear();
+	grid_time_ = NOW;
+	grid_cell_size_ = cutoff_range_;
+	grid_chsap_num_ = getChSAPnum();
+
+	// DESERT mobility models are read from the shared cache, the others
+	// are queried directly
+	UwMobilityManager &mobility = UwMobilityManager::instance();
+
+	for (int i = 0; i < grid_chsap_num_; i++) {
+		ChSAP *chsap = (ChSAP *) getChSAP(i);
+		Position *pos = chsap->getPosition();
+		double x, y, z;
+		if (!mobility.getPosition(pos, x, y, z)) {
+			x = pos->getX();
+			y = pos->getY();
+			z = pos->getZ();
+		}
+		grid_[getCellKey(getCell(x), getCell(y), getCell(z))].push_back(chsap);
+	}
+}
+
+int64_t
+UwElectroMagneticChannel::getCell(double coord) const
+{
+	return (int64_t) floor(coord / grid_cell_size_);
+}
+
+uint64_t
+UwElectroMagneticChannel::getCellKey(int64_t cx, int64_t cy, int64_t cz)
+{
+	const uint64_t mask = ((uint64_t) 1 << GRID_CELL_BITS) - 1;
+	return ((uint64_t) cx & mask) << (2 * GRID_CELL_BITS) |
+			((uint64_t) cy & mask) << GRID_CELL_BITS | ((uint64_t) cz & mask);
+}
+
 void
 UwElectroMagneticChannel::recv(Packet *p, ChSAP *chsap)
 {
@@ -40,9 +40,13 @@
 #define UW_EM_CHANNEL_H
 
 #include <channel-module.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <tclcl.h>
 
+#include <map>
+#include <vector>
+
 /**
  * UwElectroMagneticChannel extends Miracle channel class and implements the
  * underwater optical channel
@@ -73,6 +77,9 @@ public:
 
 	/**
 	 * TCL command interpreter. It implements the following OTcl methods:
+	 * - <i>getDeliveries</i>: number of packet copies delivered to the PHYs;
+	 * - <i>getCulledDeliveries</i>: number of packet copies not delivered
+	 *   because the receiver was farther than CutoffRange_.
 	 *
 	 * @param argc Number of arguments in <i>argv</i>.
 	 * @param argv Array of strings which are the command parameters (Note that
@@ -101,8 +108,49 @@ protected:
 	 */
 	void sendUpPhy(Packet *p, ChSAP *chsap);
 
+	/**
+	 * Rebuilds the grid of the ChSAP positions if the number of ChSAPs
+	 * changed or if GridRefreshPeriod_ elapsed since the last build.
+	 */
+	void updateGrid();
+
+	/**
+	 * Returns the index of the grid cell containing the given coordinate.
+	 *
+	 * @param coord coordinate [m]
+	 * @return index of the cell along that axis
+	 */
+	int64_t getCell(double coord) const;
+
+	/**
+	 * Returns the key of a grid cell.
+	 *
+	 * @param cx index of the cell along the x axis
+	 * @param cy index of the cell along the y axis
+	 * @param cz index of the cell along the z axis
+	 * @return key of the cell in the grid map
+	 */
+	static uint64_t getCellKey(int64_t cx, int64_t cy, int64_t cz);
+
 	double refractive_index; /**< refractive index of the underwater medium. */
 	double speed_of_light; /**< Speed of light in the underwater medium. */
+	double cutoff_range_; /**< Packets are delivered only to the PHYs within
+							 this range [m]. If <= 0, all the PHYs receive
+							 every packet. */
+	double grid_refresh_period_; /**< Minimum time between two rebuilds of the
+									grid [s]. With 0 the grid is rebuilt
+									at each new transmission time; with
+									larger values, receivers that moved to a
+									far cell since the last rebuild can be
+									missed. */
+	double grid_time_; /**< Time of the last rebuild of the grid. */
+	double grid_cell_size_; /**< Cell size of the current grid [m]. */
+	int grid_chsap_num_; /**< Number of ChSAPs in the current grid. */
+	std::map<uint64_t, std::vector<ChSAP *>>
+			grid_; /**< ChSAPs of each cell of the grid. */
+	unsigned long deliveries_; /**< Number of packet copies delivered. */
+	unsigned long culled_deliveries_; /**< Number of packet copies not
+										 delivered because out of range. */
 };
 
 #endif /* UW_EM_CHANNEL_H */
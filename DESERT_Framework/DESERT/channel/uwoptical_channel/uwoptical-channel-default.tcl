@@ -32,3 +32,5 @@
 
 Module/UW/Optical/Channel set RefractiveIndex_ 1.33
 
+Module/UW/Optical/Channel set CutoffRange_ 0
+Module/UW/Optical/Channel set GridRefreshPeriod_ 0
@@ -37,6 +37,7 @@
  */
 
 #include "uw-cs-burst.h"
+#include "uwlog.h"
 #include <rng.h>
 #include <mac.h>
 #include <string>
@@ -91,19 +92,19 @@ UwCsBurst::UwCsBurst()
 	bind("rv_sens_time", (double *) &rv_sens_time_);
 
 	if (max_packet_per_burst_ < 0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWCSB",
 				"not valid max_packet_per_burst < 0!! set to 1 by default");
 		max_packet_per_burst_ = 1;
 	}
 	if (fix_sens_time_ < 0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWCSB",
 				"not valid fix_sens_time < 0!! set to 1 by default");
 		fix_sens_time_ = 1;
 	}
 	if (rv_sens_time_ < 0) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWCSB",
 				"not valid rv_sens_time < 0!! set to 1 by default");
 		rv_sens_time_ = 1;
@@ -118,14 +119,14 @@ UwCsBurst::recvFromUpperLayers(Packet *p)
 		initPkt(p);
 		buffer_.push_back(p);
 	} else {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"UWCSB",
 				"recvFromUpperLayers()::dropping pkt due to buffer full");
 
 		Packet::free(p);
 	}
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCSB",
 			"recvFromUpperLayers()::start sensing");
 
@@ -136,7 +137,7 @@ void
 UwCsBurst::sensing()
 {
 	if (tx_status_ != UWCS_STATUS::IDLE) { // already sensing or transmitting
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWCSB",
 				"sensing()::already sensing or transmitting");
 
@@ -150,7 +151,7 @@ UwCsBurst::sensing()
 			RNG::defaultrng()->uniform_double() * rv_sens_time_;
 	sensing_timer_.sched(sensing_time);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCSB",
 			"sensing()::sensing time = " + to_string(sensing_time) +
 					". Change status to SENSING.");
@@ -168,14 +169,14 @@ UwCsBurst::sensingExpired()
 				RNG::defaultrng()->uniform_double() * rv_sens_time_;
 		sensing_timer_.resched(sensing_time);
 
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWCSB",
 				"sensingExpired()::received packet in the meanwhile, new "
 				"sensing time = " + to_string(sensing_time));
 		return;
 	}
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCSB",
 			"sensingExpired()::change status to TRANSMITTING");
 
@@ -189,7 +190,7 @@ UwCsBurst::txData()
 	if (buffer_.size() <= 0) {
 		tx_status_ = UWCS_STATUS::IDLE;
 
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWCSB",
 				"txData()::no data to transmit. Change status to IDLE");
 
@@ -204,7 +205,7 @@ UwCsBurst::txData()
 
 		incrDataPktsTx();
 	} else {
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWCSB",
 				"txData()::already sent max packet = " +
 						to_string(max_packet_per_burst_) +
@@ -218,7 +219,7 @@ UwCsBurst::txData()
 void
 UwCsBurst::Mac2PhyStartTx(Packet *p)
 {
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCSB",
 			"Mac2PhyStartTx()::Start transmitting");
 
@@ -228,9 +229,7 @@ UwCsBurst::Mac2PhyStartTx(Packet *p)
 void
 UwCsBurst::Phy2MacEndTx(const Packet *p)
 {
-	printOnLog(Logger::LogLevel::DEBUG,
-			"UWCSB",
-			"Mac2PhyEndTx()::End transmitting");
+	UWLOG(Logger::LogLevel::DEBUG, "UWCSB", "Mac2PhyEndTx()::End transmitting");
 
 	packet_sent_curr_burst_++;
 
@@ -240,7 +239,7 @@ UwCsBurst::Phy2MacEndTx(const Packet *p)
 void
 UwCsBurst::Phy2MacStartRx(const Packet *p)
 {
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWCSB",
 			"Mac2PhyStartRx()::Start receiving");
 
@@ -256,7 +255,7 @@ UwCsBurst::Phy2MacEndRx(Packet *p)
 	int src_mac = mach->macSA();
 
 	if (ch->error()) {
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"UWCSB",
 				"Phy2MacEndRx()::dropping corrupted packet from node " +
 						to_string(src_mac));
@@ -268,7 +267,7 @@ UwCsBurst::Phy2MacEndRx(Packet *p)
 		if (dest_mac != addr && dest_mac != MAC_BROADCAST) {
 			rxPacketNotForMe(p);
 
-			printOnLog(Logger::LogLevel::DEBUG,
+			UWLOG(Logger::LogLevel::DEBUG,
 					"UWCSB",
 					"Phy2MacEndRx()::dropping packet, it was for node " +
 							to_string(dest_mac));
@@ -276,7 +275,7 @@ UwCsBurst::Phy2MacEndRx(Packet *p)
 			sendUp(p);
 			incrDataPktsRx();
 
-			printOnLog(Logger::LogLevel::DEBUG,
+			UWLOG(Logger::LogLevel::DEBUG,
 					"UWCSB",
 					"Phy2MacEndRx()::Received packet from node " +
 							to_string(src_mac));
@@ -325,7 +324,7 @@ UwCsBurst::command(int argc, const char *const *argv)
 		if (strcasecmp(argv[1], "setMacAddr") == 0) {
 			addr = atoi(argv[2]);
 
-			printOnLog(Logger::LogLevel::INFO,
+			UWLOG(Logger::LogLevel::INFO,
 					"UWCSB",
 					"command()::MAC address of current node is " +
 							to_string(addr));
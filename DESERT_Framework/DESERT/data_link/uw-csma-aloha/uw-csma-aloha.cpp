@@ -37,6 +37,8 @@
  */
 
 #include "uw-csma-aloha.h"
+#include "uwlog.h"
+#include "uwstatetracer.h"
 #include <climits>
 #include <cmath>
 #include <iomanip>
@@ -77,7 +79,8 @@ CsmaAloha::AckTimer::expire(Event *e)
 {
 	timer_status = CSMA_EXPIRED;
 	if (module->curr_state == CSMA_STATE_WAIT_ACK) {
-		module->printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG_MODULE(module,
+				Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"AckTimer::expire(Event *)::current state = " +
 						module->status_info[module->curr_state] +
@@ -87,7 +90,8 @@ CsmaAloha::AckTimer::expire(Event *e)
 		module->refreshReason(CSMA_REASON_ACK_TIMEOUT);
 		module->stateBackoff();
 	} else {
-		module->printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG_MODULE(module,
+				Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"AckTimer::expire(Event *)");
 	}
@@ -98,7 +102,8 @@ CsmaAloha::BackOffTimer::expire(Event *e)
 {
 	timer_status = CSMA_EXPIRED;
 	if (module->curr_state == CSMA_STATE_BACKOFF) {
-		module->printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG_MODULE(module,
+				Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"BackOffTimer::expire(Event *)::current state = " +
 						module->status_info[module->curr_state] +
@@ -109,7 +114,8 @@ CsmaAloha::BackOffTimer::expire(Event *e)
 		module->exitBackoff();
 		module->stateIdle();
 	} else {
-		module->printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG_MODULE(module,
+				Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"BackOffTimer::expire(Event *)");
 	}
@@ -122,7 +128,8 @@ CsmaAloha::ListenTimer::expire(Event *e)
 
 	if (module->curr_state == CSMA_STATE_LISTEN) {
 
-		module->printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG_MODULE(module,
+				Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"ListenTimer::expire(Event *)::current state = " +
 						module->status_info[module->curr_state] +
@@ -132,7 +139,8 @@ CsmaAloha::ListenTimer::expire(Event *e)
 		module->refreshReason(CSMA_REASON_LISTEN_TIMEOUT);
 		module->stateTxData();
 	} else {
-		module->printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG_MODULE(module,
+				Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"ListenTimer::expire(Event *)");
 	}
@@ -171,6 +179,7 @@ CsmaAloha::CsmaAloha()
 	, prev_state(CSMA_STATE_IDLE)
 	, prev_prev_state(CSMA_STATE_IDLE)
 	, ack_mode(CSMA_ACK_MODE)
+	, tracer_id(-1)
 {
 	u_pkt_id = 0;
 	mac2phy_delay_ = 1e-19;
@@ -211,7 +220,7 @@ CsmaAloha::command(int argc, const char *const *argv)
 			if (initialized == false)
 				initInfo();
 			if (print_transitions)
-				fout.open("/tmp/CSMAstateTransitions.txt", ios_base::app);
+				initTracer();
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "printTransitions") == 0) {
 			print_transitions = true;
@@ -224,10 +233,14 @@ CsmaAloha::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 	} else if (argc == 3) {
-		if (strcasecmp(argv[1], "setMacAddr") == 0) {
+		if (strcasecmp(argv[1], "printTransitions") == 0) {
+			print_transitions = true;
+			UwStateTracer::instance().setFile(argv[2]);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setMacAddr") == 0) {
 			std::stringstream addr_ss(argv[2]);
 			if (addr_ss >> addr) {
-				printOnLog(Logger::LogLevel::INFO,
+				UWLOG(Logger::LogLevel::INFO,
 						"CSMA_ALOHA",
 						"command(int, const char *const)::current node MAC "
 						"address = " +
@@ -247,11 +260,6 @@ CsmaAloha::initInfo()
 
 	initialized = true;
 
-	if ((print_transitions) && (system(NULL))) {
-		system("rm -f /tmp/CSMAstateTransitions.txt");
-		system("touch /tmp/CSMAstateTransitions.txt");
-	}
-
 	status_info[CSMA_STATE_IDLE] = "Idle state";
 	status_info[CSMA_STATE_BACKOFF] = "Backoff state";
 	status_info[CSMA_STATE_TX_DATA] = "Transmit DATA state";
@@ -314,7 +322,7 @@ CsmaAloha::updateAckTimeout(double rtt)
 {
 	updateRTT(rtt);
 
-	printOnLog(Logger::LogLevel::INFO,
+	UWLOG(Logger::LogLevel::INFO,
 			"CSMA_ALOHA",
 			"updateAckTimeout(double)::current ACK_timeout =  " +
 					to_string(ACK_timeout));
@@ -352,7 +360,7 @@ CsmaAloha::computeTxTime(CSMA_PKT_TYPE type)
 		hdr_cmn *ch = HDR_CMN(temp_data_pkt);
 		ch->size() = ACK_size;
 	} else {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"CSMA_ALOHA",
 				"computeTxTime(CSMA_PKT_TYPE)::invalid packet type =  " +
 						to_string(type));
@@ -385,7 +393,7 @@ CsmaAloha::getBackoffTime()
 			backoff_tuner * random * 2.0 * ACK_timeout * pow(2.0, counter);
 	backoffSumDuration(backoff_duration);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"getBackoffTime()::backoff_duration =  " +
 					to_string(backoff_duration) + " s");
@@ -437,7 +445,7 @@ CsmaAloha::initPkt(Packet *p, CSMA_PKT_TYPE type, int dest_addr)
 			mach->macDA() = dest_addr;
 		} break;
 		default:
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"CSMA_ALOHA",
 					"initPkt(Packet *, CSMA_PKT_TYPE, int)::invalid packet "
 					"type =  " +
@@ -448,7 +456,7 @@ CsmaAloha::initPkt(Packet *p, CSMA_PKT_TYPE type, int dest_addr)
 void
 CsmaAloha::Mac2PhyStartTx(Packet *p)
 {
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"Mac2PhyStartTx(Packet *)::start tx packet ");
 
@@ -459,7 +467,7 @@ void
 CsmaAloha::Phy2MacEndTx(const Packet *p)
 {
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"Phy2MacEndTx(Packet *)::end tx packet ");
 
@@ -468,7 +476,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 		case (CSMA_STATE_TX_DATA): {
 			refreshReason(CSMA_REASON_DATA_TX);
 			if (ack_mode == CSMA_ACK_MODE) {
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::DATA sent, from" +
 								status_info[curr_state] + " to " +
@@ -476,7 +484,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 
 				stateWaitAck();
 			} else {
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::DATA sent, from" +
 								status_info[curr_state] + " to " +
@@ -490,7 +498,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 			refreshReason(CSMA_REASON_ACK_TX);
 
 			if (prev_prev_state == CSMA_STATE_RX_BACKOFF) {
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::ACK sent, from" +
 								status_info[curr_state] + " to " +
@@ -498,7 +506,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 
 				stateCheckBackoffExpired();
 			} else if (prev_prev_state == CSMA_STATE_RX_LISTEN) {
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::ACK sent, from" +
 								status_info[curr_state] + " to " +
@@ -507,7 +515,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 				stateCheckListenExpired();
 			} else if (prev_prev_state == CSMA_STATE_RX_IDLE) {
 
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::ACK sent, from" +
 								status_info[curr_state] + " to " +
@@ -515,7 +523,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 
 				stateIdle();
 			} else if (prev_prev_state == CSMA_STATE_RX_WAIT_ACK) {
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::ACK sent, from" +
 								status_info[curr_state] + " to " +
@@ -524,7 +532,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 				stateCheckAckExpired();
 			} else {
 
-				printOnLog(Logger::LogLevel::DEBUG,
+				UWLOG(Logger::LogLevel::DEBUG,
 						"CSMA_ALOHA",
 						"Phy2MacEndTx(Packet *)::logical error in timers, "
 						"current state = " +
@@ -534,7 +542,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 		} break;
 
 		default: {
-			printOnLog(Logger::LogLevel::DEBUG,
+			UWLOG(Logger::LogLevel::DEBUG,
 					"CSMA_ALOHA",
 					"Phy2MacEndTx(Packet *)::logical error in timers, "
 					"current state = " +
@@ -548,7 +556,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 void
 CsmaAloha::Phy2MacStartRx(const Packet *p)
 {
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"Phy2MacStartRx(Packet *)::rx packet");
 
@@ -573,7 +581,7 @@ CsmaAloha::Phy2MacStartRx(const Packet *p)
 			break;
 
 		default: {
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"CSMA_ALOHA",
 					"Phy2MacStartRx(Packet *)::cannot RX in current state = " +
 							status_info[curr_state]);
@@ -599,18 +607,21 @@ CsmaAloha::Phy2MacEndRx(Packet *p)
 
 	double distance = diff_time * prop_speed;
 
-	std::stringstream log_stream;
-	log_stream << "Phy2MacEndRx(Packet *)::current state = "
-			   << status_info[curr_state]
-			   << ", received a pkt type = " << ch->ptype()
-			   << ", src addr = " << mach->macSA()
-			   << " dest addr = " << mach->macDA()
-			   << ", estimated distance between nodes = " << distance << " m ";
-	printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", log_stream.str());
+	if (UWLOG_ENABLED(Logger::LogLevel::DEBUG)) {
+		std::stringstream log_stream;
+		log_stream << "Phy2MacEndRx(Packet *)::current state = "
+				   << status_info[curr_state]
+				   << ", received a pkt type = " << ch->ptype()
+				   << ", src addr = " << mach->macSA()
+				   << " dest addr = " << mach->macDA()
+				   << ", estimated distance between nodes = " << distance
+				   << " m ";
+		printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", log_stream.str());
+	}
 
 	if (ch->error()) {
 
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"CSMA_ALOHA",
 				"Phy2MacEndRx(Packet *)::dropping corrupted packet");
 		incrErrorPktsRx();
@@ -666,7 +677,7 @@ CsmaAloha::stateRxPacketNotForMe(Packet *p)
 {
 	// Check if packet already dropped because it was corrupted
 	if (p != NULL) {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"CSMA_ALOHA",
 				"stateRxPacketNotForMe(Packet *)::dropping packet for another "
 				"address");
@@ -695,7 +706,7 @@ CsmaAloha::stateRxPacketNotForMe(Packet *p)
 			break;
 
 		default:
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"CSMA_ALOHA",
 					"stateRxPacketNotForMe(Packet *)::cannot RX in previous "
 					"state = " +
@@ -710,8 +721,7 @@ CsmaAloha::stateCheckListenExpired()
 {
 	refreshState(CSMA_STATE_CHK_LISTEN_TIMEOUT);
 
-	printOnLog(
-			Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateCheckListenExpired()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateCheckListenExpired()");
 
 	if (print_transitions)
 		printStateInfo();
@@ -728,7 +738,7 @@ CsmaAloha::stateCheckListenExpired()
 		else
 			stateListen();
 	} else {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"CSMA_ALOHA",
 				"stateCheckListenExpired()::cannot RX in current listen timer "
 				"state = " +
@@ -743,7 +753,7 @@ CsmaAloha::stateCheckAckExpired()
 {
 	refreshState(CSMA_STATE_CHK_ACK_TIMEOUT);
 
-	printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateCheckAckExpired()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateCheckAckExpired()");
 
 	if (print_transitions)
 		printStateInfo();
@@ -754,7 +764,7 @@ CsmaAloha::stateCheckAckExpired()
 		refreshReason(CSMA_REASON_ACK_TIMEOUT);
 		stateBackoff();
 	} else {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"CSMA_ALOHA",
 				"stateCheckAckExpired()::cannot RX in current ack timer "
 				"state = " +
@@ -769,9 +779,7 @@ CsmaAloha::stateCheckBackoffExpired()
 {
 	refreshState(CSMA_STATE_CHK_BACKOFF_TIMEOUT);
 
-	printOnLog(Logger::LogLevel::DEBUG,
-			"CSMA_ALOHA",
-			"stateCheckBackoffExpired()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateCheckBackoffExpired()");
 
 	if (print_transitions)
 		printStateInfo();
@@ -783,7 +791,7 @@ CsmaAloha::stateCheckBackoffExpired()
 		exitBackoff();
 		stateIdle();
 	} else {
-		printOnLog(Logger::LogLevel::ERROR,
+		UWLOG(Logger::LogLevel::ERROR,
 				"CSMA_ALOHA",
 				"stateCheckAckExpired()::cannot RX in current backoff timer "
 				"state = " +
@@ -806,7 +814,7 @@ CsmaAloha::stateIdle()
 	if (print_transitions)
 		printStateInfo();
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"stateIdle()::queue size = " + to_string(Q.size()));
 
@@ -836,7 +844,7 @@ CsmaAloha::stateListen()
 	double time =
 			listen_time * RNG::defaultrng()->uniform_double() + wait_costant;
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"stateListen()::listen time = " + to_string(time));
 
@@ -865,7 +873,7 @@ CsmaAloha::stateBackoff()
 	else
 		backoff_timer.schedule(getBackoffTime());
 
-	printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateBackoff()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateBackoff()");
 
 	if (print_transitions)
 		printStateInfo(backoff_timer.getDuration());
@@ -886,7 +894,7 @@ CsmaAloha::stateTxData()
 {
 	refreshState(CSMA_STATE_TX_DATA);
 
-	printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateTxData()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateTxData()");
 
 	if (print_transitions)
 		printStateInfo();
@@ -912,7 +920,7 @@ CsmaAloha::stateTxData()
 
 		refreshReason(CSMA_REASON_MAX_TX_TRIES);
 
-		printOnLog(Logger::LogLevel::DEBUG,
+		UWLOG(Logger::LogLevel::DEBUG,
 				"CSMA_ALOHA",
 				"stateTxData()::curr_tx_rounds " + to_string(curr_tx_rounds) +
 						" > max_tx_tries = " + to_string(max_tx_tries));
@@ -927,7 +935,7 @@ CsmaAloha::stateWaitAck()
 	ack_timer.stop();
 	refreshState(CSMA_STATE_WAIT_ACK);
 
-	printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateWaitAck()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateWaitAck()");
 
 	if (print_transitions)
 		printStateInfo();
@@ -950,7 +958,7 @@ CsmaAloha::stateTxAck(int dest_addr)
 {
 	refreshState(CSMA_STATE_TX_ACK);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"stateTxAck(int)::dest_addr = " + to_string(dest_addr));
 
@@ -965,7 +973,7 @@ CsmaAloha::stateRxData(Packet *data_pkt)
 {
 	refreshState(CSMA_STATE_DATA_RX);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"stateRxData(Packet *)::current state = " +
 					status_info[curr_state]);
@@ -1024,7 +1032,7 @@ CsmaAloha::stateRxData(Packet *data_pkt)
 		} break;
 
 		default:
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"CSMA_ALOHA",
 					"stateRxData(Packet *)::cannot RX in previous "
 					"state = " +
@@ -1038,7 +1046,7 @@ CsmaAloha::stateRxAck(Packet *p)
 	ack_timer.stop();
 	refreshState(CSMA_STATE_ACK_RX);
 
-	printOnLog(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateRxAck()");
+	UWLOG(Logger::LogLevel::DEBUG, "CSMA_ALOHA", "stateRxAck()");
 
 	Packet::free(p);
 
@@ -1066,7 +1074,7 @@ CsmaAloha::stateRxAck(Packet *p)
 			break;
 
 		default:
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"CSMA_ALOHA",
 					"stateRxAck(Packet *)::cannot RX in previous "
 					"state = " +
@@ -1077,24 +1085,33 @@ CsmaAloha::stateRxAck(Packet *p)
 void
 CsmaAloha::printStateInfo(double delay)
 {
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"CSMA_ALOHA",
 			"AckTimer::printStateInfo(double)::from " +
 					status_info[prev_state] + " to " + status_info[curr_state] +
 					". Reason: " + reason_info[last_reason]);
 
-	if (curr_state == CSMA_STATE_BACKOFF) {
-		fout << left << setw(10) << NOW << "  CsmaAloha(" << addr
-			 << ")::printStateInfo() "
-			 << "from " << status_info[prev_state] << " to "
-			 << status_info[curr_state]
-			 << ". Reason: " << reason_info[last_reason]
-			 << ". Backoff duration = " << delay << endl;
-	} else {
-		fout << left << setw(10) << NOW << "  CsmaAloha(" << addr
-			 << ")::printStateInfo() "
-			 << "from " << status_info[prev_state] << " to "
-			 << status_info[curr_state]
-			 << ". Reason: " << reason_info[last_reason] << endl;
-	}
+	if (tracer_id >= 0)
+		UwStateTracer::instance().trace(NOW,
+				tracer_id,
+				addr,
+				prev_state,
+				curr_state,
+				last_reason,
+				delay);
+}
+
+void
+CsmaAloha::initTracer()
+{
+	UwStateTracer &tracer = UwStateTracer::instance();
+
+	tracer_id = tracer.getProtocol("CsmaAloha");
+	if (tracer_id >= 0)
+		return;
+
+	tracer_id = tracer.addProtocol("CsmaAloha");
+	tracer.setStateNames(tracer_id, status_info);
+	tracer.setReasonNames(tracer_id, reason_info);
+	tracer.setExtraName(tracer_id, CSMA_STATE_BACKOFF, "Backoff duration");
 }
@@ -578,6 +578,12 @@ protected:
 	 */
 	virtual void printStateInfo(double delay = 0);
 
+	/**
+	 * Adds the protocol to UwStateTracer, with the names of its states and
+	 * reasons, and starts tracing the state transitions of this node.
+	 */
+	void initTracer();
+
 	/**
 	 * Initializes the protocol at the beginning of the simulation. This method
 	 * is called by
@@ -797,8 +803,8 @@ protected:
 	static map<CSMA_PKT_TYPE, string>
 			pkt_type_info; /**< Textual description of the packet type */
 
-	ofstream fout; /**< Object that handles the output file where the protocol
-					  writes the state transistions */
+	int tracer_id; /**< Id of the protocol in UwStateTracer, -1 if the state
+					  transitions are not traced */
 };
 
 #endif /* CSMA_H */
@@ -35,6 +35,7 @@
  */
 
 #include "uwaloha.h"
+#include "uwstatetracer.h"
 #include <climits>
 #include <cmath>
 #include <iomanip>
@@ -137,6 +138,7 @@ UWAloha::UWAloha()
 	, sumrtt(0)
 	, sumrtt2(0)
 	, rttsamples(0)
+	, tracer_id(-1)
 {
 	mac2phy_delay_ = 1e-19;
 
@@ -180,7 +182,7 @@ UWAloha::command(int argc, const char *const *argv)
 			if (initialized == false)
 				initInfo();
 			if (print_transitions)
-				fout.open("/tmp/ALOHAstateTransitions.txt", ios_base::app);
+				initTracer();
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "printTransitions") == 0) {
 			print_transitions = true;
@@ -194,7 +196,11 @@ UWAloha::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 	} else if (argc == 3) {
-		if (strcasecmp(argv[1], "setMacAddr") == 0) {
+		if (strcasecmp(argv[1], "printTransitions") == 0) {
+			print_transitions = true;
+			UwStateTracer::instance().setFile(argv[2]);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setMacAddr") == 0) {
 			addr = atoi(argv[2]);
 			if (debug_)
 				cout << "Aloha MAC address of current node is " << addr << endl;
@@ -210,11 +216,6 @@ UWAloha::initInfo()
 
 	initialized = true;
 
-	if ((print_transitions) && (system(NULL))) {
-		system("rm -f /tmp/ALOHAstateTransitions.txt");
-		system("touch /tmp/ALOHAstateTransitions.txt");
-	}
-
 	status_info[UWALOHA_STATE_IDLE] = "Idle state";
 	status_info[UWALOHA_STATE_TX_DATA] = "Transmit DATA state";
 	status_info[UWALOHA_STATE_TX_ACK] = "Transmit ACK state";
@@ -820,20 +821,31 @@ UWAloha::printStateInfo(double delay)
 			 << status_info[curr_state]
 			 << ". Reason: " << reason_info[last_reason] << endl;
 
-	if (curr_state == UWALOHA_STATE_BACKOFF) {
-		fout << left << setw(10) << NOW << "  UWAloha (" << addr
-			 << ")::printStateInfo() "
-			 << "from " << status_info[prev_state] << " to "
-			 << status_info[curr_state]
-			 << ". Reason: " << reason_info[last_reason]
-			 << ". Backoff duration = " << delay << endl;
-	} else {
-		fout << left << setw(10) << NOW << "  UWAloha (" << addr
-			 << ")::printStateInfo() "
-			 << "from " << status_info[prev_state] << " to "
-			 << status_info[curr_state]
-			 << ". Reason: " << reason_info[last_reason] << endl;
-	}
+	if (tracer_id >= 0)
+		UwStateTracer::instance().trace(NOW,
+				tracer_id,
+				addr,
+				prev_state,
+				curr_state,
+				last_reason,
+				delay);
+}
+
+void
+UWAloha::initTracer()
+{
+	UwStateTracer &tracer = UwStateTracer::instance();
+
+	tracer_id = tracer.getProtocol("UWAloha");
+	if (tracer_id >= 0)
+		return;
+
+	tracer_id = tracer.addProtocol("UWAloha");
+	tracer.setStateNames(tracer_id, status_info);
+	tracer.setReasonNames(tracer_id, reason_info);
+	tracer.setExtraName(tracer_id, UWALOHA_STATE_BACKOFF, "Backoff duration");
+	// keep the spacing of the text traces
+	tracer.setPrintName(tracer_id, "  UWAloha ");
 }
 
 void
@@ -564,6 +564,12 @@ protected:
 	 */
 	virtual void printStateInfo(double delay = 0);
 
+	/**
+	 * Adds the protocol to UwStateTracer, with the names of its states and
+	 * reasons, and starts tracing the state transitions of this node.
+	 */
+	void initTracer();
+
 	/**
 	 * This function is used to initialize the UWAloha protocol.
 	 */
@@ -812,7 +818,8 @@ protected:
 	map<pktSeqNum, AckTimer> mapAckTimer; /**< Container where acknowledgement
 											 timer(s) is stored */
 
-	ofstream fout; /**< An object of ofstream class */
+	int tracer_id; /**< Id of the protocol in UwStateTracer, -1 if the state
+					  transitions are not traced */
 };
 
 #endif /* UWUWALOHA_H_ */
@@ -37,6 +37,7 @@
  */
 
 #include "uw-mac-DACAP-alter.h"
+#include "uwstatetracer.h"
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -401,7 +402,7 @@ MMacDACAP::MMacDACAP()
 	, sumrtt(0)
 	, sumrtt2(0)
 	, rttsamples(0)
-
+	, tracer_id(-1)
 {
 	u_pkt_id = 0;
 
@@ -447,8 +448,7 @@ MMacDACAP::command(int argc, const char *const *argv)
 	if (argc == 2) {
 		if (strcasecmp(argv[1], "printTransitions") == 0) {
 			print_transitions = true;
-			if (print_transitions)
-				fout.open("/tmp/DACAPstateTransitions.txt", ios_base::app);
+			initTracer();
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "setAckMode") == 0) {
 			op_mode = ACK_MODE;
@@ -497,7 +497,12 @@ MMacDACAP::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 	} else if (argc == 3) {
-		if (strcasecmp(argv[1], "setMacAddr") == 0) {
+		if (strcasecmp(argv[1], "printTransitions") == 0) {
+			print_transitions = true;
+			UwStateTracer::instance().setFile(argv[2]);
+			initTracer();
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setMacAddr") == 0) {
 			addr = atoi(argv[2]);
 			if (debug_)
 				cout << "DACAP MAC address of current node is " << addr << endl;
@@ -524,12 +529,6 @@ MMacDACAP::crLayCommand(ClMessage *m)
 void
 MMacDACAP::initInfo()
 {
-	if (system(NULL)) {
-		system("rm -f /tmp/DACAPstateTransitions.txt");
-		if (print_transitions)
-			system("touch /tmp/DACAPstateTransitions.txt");
-	}
-
 	info[STATE_IDLE] = "Idle State";
 	info[STATE_WAIT_CTS] = "Wait CTS State";
 	info[STATE_DEFER_DATA] = "Defer Data State";
@@ -2286,33 +2285,37 @@ MMacDACAP::printStateInfo(double delay)
 			 << "from " << info[prev_state] << " to " << info[curr_state]
 			 << " reason: " << info[last_reason] << endl;
 
-	if (print_transitions) {
-		if (curr_state == STATE_BACKOFF) {
-			fout << left << setw(10) << NOW << " MMacDACAP(" << addr
-				 << ")::printStateInfo() "
-				 << "from " << info[prev_state] << " to " << info[curr_state]
-				 << " reason: " << info[last_reason]
-				 << ". Backoff duration = " << delay
-				 << "; backoff cnt = " << backoff_counter << endl;
-		} else if (curr_state == STATE_DEFER_DATA) {
-			fout << left << setw(10) << NOW << " MMacDACAP(" << addr
-				 << ")::printStateInfo() "
-				 << "from " << info[prev_state] << " to " << info[curr_state]
-				 << " reason: " << info[last_reason]
-				 << ". Defering delay = " << delay << endl;
-		} else if (curr_state == STATE_RECONTEND_WINDOW) {
-			fout << left << setw(10) << NOW << " MMacDACAP(" << addr
-				 << ")::printStateInfo() "
-				 << "from " << info[prev_state] << " to " << info[curr_state]
-				 << " reason: " << info[last_reason]
-				 << ". Waiting delay = " << delay << endl;
-		} else {
-			fout << left << setw(10) << NOW << " MMacDACAP(" << addr
-				 << ")::printStateInfo() "
-				 << "from " << info[prev_state] << " to " << info[curr_state]
-				 << " reason: " << info[last_reason] << endl;
-		}
-	}
+	if (print_transitions && tracer_id >= 0)
+		UwStateTracer::instance().trace(NOW,
+				tracer_id,
+				addr,
+				prev_state,
+				curr_state,
+				last_reason,
+				delay,
+				backoff_counter);
+}
+
+void
+MMacDACAP::initTracer()
+{
+	UwStateTracer &tracer = UwStateTracer::instance();
+
+	tracer_id = tracer.getProtocol("MMacDACAP");
+	if (tracer_id >= 0)
+		return;
+
+	// info holds the names of both the states and the reasons
+	tracer_id = tracer.addProtocol("MMacDACAP");
+	tracer.setStateNames(tracer_id, info);
+	tracer.setReasonNames(tracer_id, info);
+	tracer.setExtraName(tracer_id, STATE_BACKOFF, "Backoff duration");
+	tracer.setAuxName(tracer_id, STATE_BACKOFF, "backoff cnt");
+	tracer.setExtraName(tracer_id, STATE_DEFER_DATA, "Defering delay");
+	tracer.setExtraName(tracer_id, STATE_RECONTEND_WINDOW, "Waiting delay");
+	// keep the spacing and the reason label of the text traces
+	tracer.setPrintName(tracer_id, " MMacDACAP");
+	tracer.setReasonLabel(tracer_id, " reason: ");
 }
 
 inline void
@@ -485,6 +485,13 @@ protected:
 	 * on the file
 	 */
 	virtual void printStateInfo(double delay = 0);
+
+	/**
+	 * Adds the protocol to UwStateTracer, with the names of its states and
+	 * reasons, and starts tracing the state transitions of this node.
+	 */
+	void initTracer();
+
 	/**
 	 * Initializes the protocol at the beginning of the simulation. This method
 	 * is called by
@@ -833,8 +840,8 @@ protected:
 	static map<int, string> info; /**< Relationship between the state and its
 									 textual description */
 
-	ofstream fout; /**< Object that handle the file where the state transitions
-					  is written (if the print_transitions option is active) */
+	int tracer_id; /**< Id of the protocol in UwStateTracer, -1 if the state
+					  transitions are not traced */
 };
 
 #endif /* MMAC_UW_DACAP_H */
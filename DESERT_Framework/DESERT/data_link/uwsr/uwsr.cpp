@@ -36,6 +36,7 @@
  */
 
 #include "uwsr.h"
+#include "uwstatetracer.h"
 #include <algorithm>
 #include <climits>
 #include <cmath>
@@ -206,6 +207,7 @@ MMacUWSR::MMacUWSR()
 	, hit_count(0)
 	, total_pkts_tx(0)
 	, latest_ack_timeout(0)
+	, tracer_id(-1)
 
 {
 	mac2phy_delay_ = 1e-19;
@@ -250,7 +252,7 @@ MMacUWSR::command(int argc, const char *const *argv)
 			if (initialized == false)
 				initInfo();
 			if (print_transitions)
-				fout.open("/tmp/UWSRstateTransitions.txt", ios_base::app);
+				initTracer();
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "printTransitions") == 0) {
 			print_transitions = true;
@@ -268,7 +270,11 @@ MMacUWSR::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 	} else if (argc == 3) {
-		if (strcasecmp(argv[1], "setMacAddr") == 0) {
+		if (strcasecmp(argv[1], "printTransitions") == 0) {
+			print_transitions = true;
+			UwStateTracer::instance().setFile(argv[2]);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setMacAddr") == 0) {
 			addr = atoi(argv[2]);
 			if (debug_)
 				cout << "UwSR MAC address of current node is " << addr << endl;
@@ -284,11 +290,6 @@ MMacUWSR::initInfo()
 
 	initialized = true;
 
-	if ((print_transitions) && (system(NULL))) {
-		system("rm -f /tmp/UWSRstateTransitions.txt");
-		system("touch /tmp/UWSRstateTransitions.txt");
-	}
-
 	status_info[UWSR_STATE_IDLE] = "Idle state";
 	status_info[UWSR_STATE_BACKOFF] = "Backoff state";
 	status_info[UWSR_STATE_TX_DATA] = "Transmit DATA state";
@@ -1589,20 +1590,29 @@ MMacUWSR::printStateInfo(double delay)
 			 << status_info[curr_state]
 			 << ". Reason: " << reason_info[last_reason] << endl;
 
-	if (curr_state == UWSR_STATE_BACKOFF) {
-		fout << left << setw(10) << NOW << "  MMacUWSR(" << addr
-			 << ")::printStateInfo() "
-			 << "from " << status_info[prev_state] << " to "
-			 << status_info[curr_state]
-			 << ". Reason: " << reason_info[last_reason]
-			 << ". Backoff duration = " << delay << endl;
-	} else {
-		fout << left << setw(10) << NOW << "  MMacUWSR(" << addr
-			 << ")::printStateInfo() "
-			 << "from " << status_info[prev_state] << " to "
-			 << status_info[curr_state]
-			 << ". Reason: " << reason_info[last_reason] << endl;
-	}
+	if (tracer_id >= 0)
+		UwStateTracer::instance().trace(NOW,
+				tracer_id,
+				addr,
+				prev_state,
+				curr_state,
+				last_reason,
+				delay);
+}
+
+void
+MMacUWSR::initTracer()
+{
+	UwStateTracer &tracer = UwStateTracer::instance();
+
+	tracer_id = tracer.getProtocol("MMacUWSR");
+	if (tracer_id >= 0)
+		return;
+
+	tracer_id = tracer.addProtocol("MMacUWSR");
+	tracer.setStateNames(tracer_id, status_info);
+	tracer.setReasonNames(tracer_id, reason_info);
+	tracer.setExtraName(tracer_id, UWSR_STATE_BACKOFF, "Backoff duration");
 }
 
 void
@@ -709,6 +709,12 @@ protected:
 	 */
 	virtual void printStateInfo(double delay = 0);
 
+	/**
+	 * Adds the protocol to UwStateTracer, with the names of its states and
+	 * reasons, and starts tracing the state transitions of this node.
+	 */
+	void initTracer();
+
 	/**
 	 * This function is used to initialize the UWAloha protocol.
 	 */
@@ -1265,7 +1271,8 @@ protected:
 						  * receiving node and number
 						  * of acknowledgement receive among them. */
 
-	ofstream fout; /**< An object of ofstream class */
+	int tracer_id; /**< Id of the protocol in UwStateTracer, -1 if the state
+					  transitions are not traced */
 };
 
 #endif /* UWSR_H */
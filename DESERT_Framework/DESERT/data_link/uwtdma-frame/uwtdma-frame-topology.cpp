@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwtdma-frame-topology.cpp
+ * @version 1.0.0
+ *
+ * \brief Provides the implementation of the class <i>UwTDMATopology</i>.
+ *
+ */
+
+#include "uwtdma-frame-topology.h"
+
+#include <fstream>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+std::map<UwTDMATopology::topology_key, UwTDMATopology *>
+		UwTDMATopology::topologies;
+
+UwTDMATopology::UwTDMATopology()
+	: nodes(0)
+	, slots(0)
+	, status()
+	, mtime(0)
+	, size(0)
+{
+}
+
+const UwTDMATopology *
+UwTDMATopology::getTopology(const std::string &file_name, char separator)
+{
+	struct stat file_stat;
+	if (stat(file_name.c_str(), &file_stat) != 0)
+		return nullptr;
+
+	topology_key key(file_name, separator);
+	std::map<topology_key, UwTDMATopology *>::iterator it =
+			topologies.find(key);
+
+	if (it != topologies.end() && it->second->mtime == file_stat.st_mtime &&
+			it->second->size == file_stat.st_size)
+		return it->second;
+
+	UwTDMATopology *topology = new UwTDMATopology();
+	if (!topology->parse(file_name, separator)) {
+		delete topology;
+		return nullptr;
+	}
+	topology->mtime = file_stat.st_mtime;
+	topology->size = file_stat.st_size;
+
+	if (it != topologies.end()) {
+		delete it->second;
+		it->second = topology;
+	} else {
+		topologies[key] = topology;
+	}
+
+	return topology;
+}
+
+bool
+UwTDMATopology::parse(const std::string &file_name, char separator)
+{
+	std::ifstream input_file(file_name.c_str());
+	if (!input_file.is_open())
+		return false;
+
+	std::string line;
+	std::vector<int> row;
+
+	while (std::getline(input_file, line)) {
+		row.clear();
+		size_t start = 0;
+		while (start < line.size()) {
+			size_t end = line.find(separator, start);
+			if (end == std::string::npos)
+				end = line.size();
+			else
+				line[end] = '\0';
+			row.push_back(atoi(line.c_str() + start));
+			start = end + 1;
+		}
+
+		if (nodes == 0)
+			slots = row.size();
+		row.resize(slots, 0);
+		status.insert(status.end(), row.begin(), row.end());
+		nodes++;
+	}
+
+	return true;
+}
+
+int
+UwTDMATopology::getStatus(int node, int slot) const
+{
+	if (node < 1 || node > nodes || slot < 1 || slot > slots)
+		return 0;
+
+	return status[(size_t) (node - 1) * slots + (slot - 1)];
+}
+
+void
+UwTDMATopology::getNodeSlots(int node, std::vector<int> &node_slots) const
+{
+	node_slots.clear();
+	if (node < 1 || node > nodes || slots == 0)
+		return;
+
+	const int *node_row = &status[(size_t) (node - 1) * slots];
+	for (int slot = 0; slot < slots; slot++) {
+		if (node_row[slot] > 0)
+			node_slots.push_back(slot + 1);
+	}
+}
@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwtdma-frame-topology.h
+ * @version 1.0.0
+ *
+ * \brief Provides the definition of the class <i>UwTDMATopology</i>.
+ *
+ */
+
+#ifndef UWTDMA_FRAME_TOPOLOGY_H
+#define UWTDMA_FRAME_TOPOLOGY_H
+
+#include <map>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+/**
+ * Slot schedule of a TDMA frame, read from a topology S file. Each row of
+ * the file is a node and each column is a slot: a positive value means that
+ * the node transmits in that slot. The schedule is stored as a dense matrix
+ * and every file is parsed only once per process, so that all the
+ * UwTDMA_frame nodes of a simulation share the same copy.
+ */
+class UwTDMATopology
+{
+public:
+	/**
+	 * Returns the schedule read from a topology S file, parsing it if it is
+	 * not cached yet or if the file changed since it was parsed.
+	 *
+	 * @param file_name Name of the topology S file.
+	 * @param separator Character used as token separator in the file.
+	 * @return the schedule, or nullptr if the file cannot be opened.
+	 */
+	static const UwTDMATopology *getTopology(
+			const std::string &file_name, char separator);
+
+	/**
+	 * Returns the number of nodes (rows) in the schedule.
+	 */
+	inline int
+	getNodes() const
+	{
+		return nodes;
+	}
+
+	/**
+	 * Returns the number of slots in a frame, i.e., the number of columns of
+	 * the first row of the file.
+	 */
+	inline int
+	getSlots() const
+	{
+		return slots;
+	}
+
+	/**
+	 * Returns the value of the schedule for a node and a slot.
+	 *
+	 * @param node Node, from 1 to getNodes().
+	 * @param slot Slot, from 1 to getSlots().
+	 * @return the value read from the file, 0 if out of the schedule.
+	 */
+	int getStatus(int node, int slot) const;
+
+	/**
+	 * Fills a vector with the slots assigned to a node, in increasing order.
+	 *
+	 * @param node Node, from 1 to getNodes().
+	 * @param node_slots Vector filled with the slots, from 1 to getSlots().
+	 */
+	void getNodeSlots(int node, std::vector<int> &node_slots) const;
+
+private:
+	/**
+	 * Constructor of the UwTDMATopology class.
+	 */
+	UwTDMATopology();
+
+	/**
+	 * Reads the schedule from a file.
+	 *
+	 * @param file_name Name of the topology S file.
+	 * @param separator Character used as token separator in the file.
+	 * @return <i>true</i> if the file has been read, <i>false</i> otherwise.
+	 */
+	bool parse(const std::string &file_name, char separator);
+
+	typedef std::pair<std::string, char> topology_key; /**< File and
+														  separator. */
+
+	static std::map<topology_key, UwTDMATopology *>
+			topologies; /**< Schedules parsed so far. */
+
+	int nodes; /**< Number of nodes in the schedule. */
+	int slots; /**< Number of slots in a frame. */
+	std::vector<int> status; /**< Schedule, row-major nodes x slots. */
+	time_t mtime; /**< Modification time of the parsed file. */
+	off_t size; /**< Size of the parsed file. */
+};
+
+#endif
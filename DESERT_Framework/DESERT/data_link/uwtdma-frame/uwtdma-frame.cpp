@@ -108,8 +108,7 @@ UwTDMA_frame::changeStatus()
 	}
 	if (slot_status == UW_TDMA_STATUS_MY_SLOT) {
 		slot_status = UW_TDMA_STATUS_NOT_MY_SLOT;
-		int num_jumping_slots =
-				getNextMySlot()->first - getCurrentSlot()->first;
+		int num_jumping_slots = getNextMySlot() - getCurrentSlot();
 		num_jumping_slots = num_jumping_slots > 0
 				? num_jumping_slots
 				: num_jumping_slots + tot_slots;
@@ -123,7 +122,7 @@ UwTDMA_frame::changeStatus()
 		if (sea_trial_)
 			out_file_stats << left << "[" << getEpoch() << "]::" << NOW
 						   << "::TDMA_node(" << addr << ")::Off timeslot "
-						   << getCurrentSlot()->first << std::endl;
+						   << getCurrentSlot() << std::endl;
 	} else
 		UwTDMA::changeStatus();
 }
@@ -150,10 +149,14 @@ UwTDMA_frame::command(int argc, const char *const *argv)
 					std::cout << "Error: guard time or frame set incorrectly"
 							  << std::endl;
 					return TCL_ERROR;
+				} else if (my_slot_numbers_.empty()) {
+					std::cout << "Error: no slots assigned to the node in "
+								 "the topology"
+							  << std::endl;
+					return TCL_ERROR;
 				} else {
-					Slot::iterator iter = my_slot_numbers_.begin();
-					start_time = iter->first * slot_duration;
-					start(iter->first * slot_duration);
+					start_time = my_slot_numbers_.front() * slot_duration;
+					start(my_slot_numbers_.front() * slot_duration);
 					return TCL_OK;
 				}
 			}
@@ -190,74 +193,39 @@ UwTDMA_frame::command(int argc, const char *const *argv)
 	return UwTDMA::command(argc, argv);
 }
 
-Slot::iterator
-UwTDMA_frame::getCurrentSlot()
+int
+UwTDMA_frame::getCurrentSlot() const
 {
-	Slot::iterator iter = my_slot_numbers_.begin();
-	int pos = ((my_slots_counter - 1) % my_slot_numbers_.size());
-	// std::cout<< NOW << " ID:" << addr << " Slots SIZE:" <<
-	// my_slot_numbers_.size() << std::endl;
+	int pos = ((my_slots_counter - 1) % (int) my_slot_numbers_.size());
 	if (debug_ < -5)
 		std::cout << NOW << " ID:" << addr << " Slot Pos:" << pos << std::endl;
-	for (int i = 0; i < pos; i++) {
-		iter++;
-	}
-	return iter;
+	return my_slot_numbers_[pos > 0 ? pos : 0];
 }
 
-Slot::iterator
-UwTDMA_frame::getNextMySlot(int skip)
+int
+UwTDMA_frame::getNextMySlot(int skip) const
 {
-	Slot::iterator iter = my_slot_numbers_.begin();
-	int pos = ((my_slots_counter + skip) % my_slot_numbers_.size());
+	int pos = ((my_slots_counter + skip) % (int) my_slot_numbers_.size());
 	if (debug_ < -5)
 		std::cout << NOW << " ID:" << addr << " Pos:" << pos << std::endl;
-	for (int i = 0; i < pos; i++) {
-		iter++;
-	}
-	return iter;
+	return my_slot_numbers_[pos > 0 ? pos : 0];
 }
 
 void
 UwTDMA_frame::initializeTopologyS()
 {
 	topology_index = topology_index ? topology_index : addr;
-	ifstream input_file_;
-	string line_;
-	char *tmp_ = new char[topology_S_file_name_.length() + 1];
-	strcpy(tmp_, topology_S_file_name_.c_str());
-	input_file_.open(tmp_);
-	int slot_number = 0;
-	if (tot_slots ||
-			tot_nodes) { // initialize the frame again due to frame change
-		tot_slots = 0;
-		tot_nodes = 0;
-		s_.clear();
-		my_slot_numbers_.clear();
-	}
-	if (input_file_.is_open()) {
-		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			string result_;
-			slot_number = 0;
-			while (std::getline(
-					line_stream, result_, topology_S_token_separator_)) {
-				slot_number++;
-				int tx_status = atoi(result_.c_str());
-				s_[tot_nodes + 1][slot_number] = tx_status;
-				if (tot_nodes + 1 == topology_index && tx_status > 0) {
-					// cout << "Node " <<addr << "S[" << slot_number << "] = "
-					// << tx_status <<endl;
-					my_slot_numbers_[slot_number] = tx_status;
-				}
-				if (!tot_nodes) {
-					tot_slots++;
-				}
-			}
-			tot_nodes++;
-		}
-		// std::cout << NOW << " ID " << addr << " num slots: "
-		// <<my_slot_numbers_.size() << std::endl;
+	// initialize the frame again in case of frame change
+	tot_slots = 0;
+	tot_nodes = 0;
+	my_slot_numbers_.clear();
+
+	const UwTDMATopology *topology = UwTDMATopology::getTopology(
+			topology_S_file_name_, topology_S_token_separator_);
+	if (topology) {
+		tot_nodes = topology->getNodes();
+		tot_slots = topology->getSlots();
+		topology->getNodeSlots(topology_index, my_slot_numbers_);
 	} else {
 		cerr << "Impossible to open file " << topology_S_file_name_.c_str()
 			 << endl;
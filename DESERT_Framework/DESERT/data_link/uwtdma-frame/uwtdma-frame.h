@@ -49,8 +49,7 @@
 #include <uwtdma.h>
 #include <vector>
 
-typedef std::map<int, int> Slot;
-typedef std::map<int, Slot> SlotTopology;
+#include "uwtdma-frame-topology.h"
 
 class UwTDMA_frame;
 
@@ -91,13 +90,24 @@ protected:
 	virtual void changeStatus();
 
 	/**
-	 * Initialize the topology S 2D matrix from file.
-	 * This matrix cointains the schedule slot of each node.
+	 * Initialize the slots of the node from the topology S file.
+	 * The file cointains the schedule slot of each node and is parsed only
+	 * once for all the nodes (see UwTDMATopology).
 	 */
 	virtual void initializeTopologyS();
 
-	Slot::iterator getCurrentSlot();
-	Slot::iterator getNextMySlot(int skip = 0);
+	/**
+	 * Returns the slot of the node in which it was active last.
+	 * @return the slot number, from 1 to tot_slots.
+	 */
+	int getCurrentSlot() const;
+
+	/**
+	 * Returns the next slot in which the node will be active.
+	 * @param skip Number of slots of the node to skip.
+	 * @return the slot number, from 1 to tot_slots.
+	 */
+	int getNextMySlot(int skip = 0) const;
 
 	int my_slots_counter; /**<count the passed number of slots in which it was
 							 active*/
@@ -106,11 +116,9 @@ protected:
 	int max_packet_per_slot; /**<max numer of packet it can transmit per slot */
 	int packet_sent_curr_slot_; /**<counter of packet has been sent in the
 								   current slot */
-	SlotTopology s_; /**<matrix cointaining the transmission schedule of all the
-						network */
-	Slot my_slot_numbers_; /**<set the position of the node in the frame
-							  (fair_mode)
-										  (starting from 0 to tot_slots-1)*/
+	std::vector<int> my_slot_numbers_; /**<sorted slots of the node in the
+										  frame (fair_mode), from 1 to
+										  tot_slots */
 
 private:
 	string topology_S_file_name_; /**<Topology S file name */
@@ -38,6 +38,7 @@
 
 #include "uwinterference.h"
 
+#include <algorithm>
 #include <iostream>
 #include <mac.h>
 #include <mphy.h>
@@ -60,13 +61,41 @@ public:
 	}
 } class_interf_overlap;
 
+EndInterfEvent *EndInterfEvent::free_list_ = NULL;
+long EndInterfEvent::pool_hits_ = 0;
+long EndInterfEvent::pool_misses_ = 0;
+
+EndInterfEvent *
+EndInterfEvent::create(double pw, PKT_TYPE tp)
+{
+	if (!free_list_) {
+		pool_misses_++;
+		return new EndInterfEvent(pw, tp);
+	}
+
+	EndInterfEvent *e = free_list_;
+	free_list_ = e->next_free;
+	pool_hits_++;
+	e->next_free = NULL;
+	e->power = pw;
+	e->type = tp;
+	return e;
+}
+
+void
+EndInterfEvent::release(EndInterfEvent *e)
+{
+	e->next_free = free_list_;
+	free_list_ = e;
+}
+
 void
 EndInterfTimer::handle(Event *e)
 {
 
 	EndInterfEvent *ee = (EndInterfEvent *) e;
 	interference->removeFromInterference(ee->power, ee->type);
-	delete ee;
+	EndInterfEvent::release(ee);
 }
 
 uwinterference::uwinterference()
@@ -76,6 +105,14 @@ uwinterference::uwinterference()
 	, initial_interference_time(0)
 	, start_rx_time(0)
 	, end_rx_time(0)
+	, result_()
+	, query_valid_(false)
+	, query_chunks_(false)
+	, query_type_(DATA)
+	, query_power_(0)
+	, query_start_(0)
+	, query_duration_(0)
+	, query_now_(0)
 {
 	bind("use_maxinterval_", &use_maxinterval_);
 }
@@ -84,6 +121,22 @@ uwinterference::~uwinterference()
 {
 }
 
+int
+uwinterference::command(int argc, const char *const *argv)
+{
+	Tcl &tcl = Tcl::instance();
+	if (argc == 2) {
+		if (strcasecmp(argv[1], "getEventPoolHits") == 0) {
+			tcl.resultf("%ld", EndInterfEvent::getPoolHits());
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getEventPoolMisses") == 0) {
+			tcl.resultf("%ld", EndInterfEvent::getPoolMisses());
+			return TCL_OK;
+		}
+	}
+	return MInterferenceMIV::command(argc, argv);
+}
+
 void
 uwinterference::addToInterference(Packet *p)
 {
@@ -91,13 +144,13 @@ uwinterference::addToInterference(Packet *p)
 	hdr_mac *mach = HDR_MAC(p);
 	if (mach->ftype() == MF_CONTROL) {
 		addToInterference(ph->Pr, CTRL);
-		EndInterfEvent *ee = new EndInterfEvent(ph->Pr, CTRL);
+		EndInterfEvent *ee = EndInterfEvent::create(ph->Pr, CTRL);
 		// EPSILON_TIME needed to avoid the scheduling of simultaneous events
 		Scheduler::instance().schedule(
 				&end_timer, ee, ph->duration - EPSILON_TIME);
 	} else {
 		addToInterference(ph->Pr, DATA);
-		EndInterfEvent *ee = new EndInterfEvent(ph->Pr, DATA);
+		EndInterfEvent *ee = EndInterfEvent::create(ph->Pr, DATA);
 		// EPSILON_TIME needed to avoid the scheduling of simultaneous events
 		Scheduler::instance().schedule(
 				&end_timer, ee, ph->duration - EPSILON_TIME);
@@ -107,6 +160,8 @@ uwinterference::addToInterference(Packet *p)
 void
 uwinterference::addToInterference(double pw, PKT_TYPE tp)
 {
+	query_valid_ = false;
+
 	if (use_maxinterval_) {
 		std::list<ListNode>::iterator it;
 		for (it = power_list.begin(); it != power_list.end();) {
@@ -150,6 +205,8 @@ uwinterference::addToInterference(double pw, PKT_TYPE tp)
 void
 uwinterference::removeFromInterference(double pw, PKT_TYPE tp)
 {
+	query_valid_ = false;
+
 	if (use_maxinterval_) {
 		std::list<ListNode>::iterator it;
 
@@ -211,14 +268,12 @@ uwinterference::removeFromInterference(double pw, PKT_TYPE tp)
 double
 uwinterference::getInterferencePower(Packet *p)
 {
-
-	hdr_MPhy *ph = HDR_MPHY(p);
-	double a = getTimeOverlap(p);
+	const InterferenceResult &res = getInterference(p);
 	if (debug_) {
 		std::cout << NOW << " uwinterference::getInterferencePower, "
-				  << "percentage of overlap: " << a << std::endl;
+				  << "percentage of overlap: " << res.overlap << std::endl;
 	}
-	return (getInterferencePower(ph->Pr, ph->rxtime, ph->duration));
+	return res.power;
 }
 
 double
@@ -376,3 +431,140 @@ uwinterference::getCounters(double starttime, double duration, PKT_TYPE tp)
 
 	return counter(ctrl_pkts, data_pkts);
 }
+
+const InterferenceResult &
+uwinterference::getInterference(Packet *p, bool chunks)
+{
+	hdr_MPhy *ph = HDR_MPHY(p);
+	hdr_mac *mach = HDR_MAC(p);
+	PKT_TYPE tp = (mach->ftype() == MF_CONTROL) ? CTRL : DATA;
+	return getInterference(ph->Pr, ph->rxtime, ph->duration, tp, chunks);
+}
+
+const InterferenceResult &
+uwinterference::getInterference(double power, double starttime,
+		double duration, PKT_TYPE tp, bool chunks)
+{
+	assert(starttime <= NOW);
+	assert(duration > 0);
+
+	if (isCachedQuery(power, starttime, duration, tp, chunks))
+		return result_;
+
+	double integral = 0;
+	double overlap = 0;
+	int ctrl_pkts = 0;
+	int data_pkts = 0;
+	double lasttime = NOW;
+	result_.chunks.clear();
+
+	std::list<ListNode>::reverse_iterator rit;
+	for (rit = power_list.rbegin(); rit != power_list.rend(); ++rit) {
+		bool collision = rit->ctrl_cnt > 1 || rit->data_cnt > 1;
+		if (starttime < rit->time) {
+			double step = lasttime - rit->time;
+			integral += rit->sum_power * step;
+			if (collision)
+				overlap += step;
+			if (rit != power_list.rbegin()) {
+				std::list<ListNode>::reverse_iterator next = rit;
+				--next;
+				ctrl_pkts += std::max(next->ctrl_cnt - rit->ctrl_cnt, 0);
+				data_pkts += std::max(next->data_cnt - rit->data_cnt, 0);
+			}
+			if (chunks)
+				addPowerChunk(rit->sum_power - power, step);
+			lasttime = rit->time;
+		} else {
+			double step = lasttime - starttime;
+			integral += rit->sum_power * step;
+			if (collision)
+				overlap += step;
+			ctrl_pkts += rit->ctrl_cnt;
+			data_pkts += rit->data_cnt;
+			if (chunks)
+				addPowerChunk(rit->sum_power - power, step);
+			break;
+		}
+	}
+
+	fillResult(power,
+			integral,
+			overlap,
+			ctrl_pkts,
+			data_pkts,
+			starttime,
+			duration,
+			tp);
+	setCachedQuery(power, starttime, duration, tp, chunks);
+	return result_;
+}
+
+const PowerChunkList &
+uwinterference::getInterferencePowerChunkList(Packet *p)
+{
+	return getInterference(p, true).chunks;
+}
+
+bool
+uwinterference::isCachedQuery(double power, double starttime,
+		double duration, PKT_TYPE tp, bool chunks) const
+{
+	return (query_valid_ && query_now_ == NOW && query_power_ == power &&
+			query_start_ == starttime && query_duration_ == duration &&
+			query_type_ == tp && (query_chunks_ || !chunks));
+}
+
+void
+uwinterference::setCachedQuery(double power, double starttime,
+		double duration, PKT_TYPE tp, bool chunks)
+{
+	query_valid_ = true;
+	query_now_ = NOW;
+	query_power_ = power;
+	query_start_ = starttime;
+	query_duration_ = duration;
+	query_type_ = tp;
+	query_chunks_ = chunks;
+}
+
+void
+uwinterference::addPowerChunk(double power, double time)
+{
+	if (power > POWER_PRECISION_THRESHOLD && time > 2 * EPSILON_TIME)
+		result_.chunks.push_back(PowerChunk(power, time));
+}
+
+void
+uwinterference::fillResult(double power, double integral, double overlap,
+		int ctrl_pkts, int data_pkts, double starttime, double duration,
+		PKT_TYPE tp)
+{
+	double interference = (integral / duration) - power;
+	// Check for cancellation errors
+	// which can arise when interference is subtracted
+	if (interference < 0)
+		interference = 0;
+
+	if (tp == CTRL) {
+		ctrl_pkts--;
+	} else {
+		data_pkts--;
+	}
+
+	result_.power = interference;
+	result_.overlap = overlap / duration;
+	result_.counters = counter(ctrl_pkts, data_pkts);
+
+	if (debug_) {
+		std::cout << NOW << " uwinterference::getInterference(), "
+				  << "transmission from " << starttime << " to "
+				  << starttime + duration << " power " << power
+				  << " gets interference " << result_.power
+				  << ", overlap " << result_.overlap
+				  << ", collisions with ctrl pkts: " << ctrl_pkts
+				  << ", collisions with data pkts: " << data_pkts
+				  << ", power chunks: " << result_.chunks.size()
+				  << std::endl;
+	}
+}
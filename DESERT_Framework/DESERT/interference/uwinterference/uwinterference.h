@@ -52,6 +52,17 @@ enum PKT_TYPE { CTRL, DATA }; /**< Pkt type: CONTROL or DATA packet */
 
 typedef std::pair<int, int> counter; /**< counter of collisions */
 
+/**
+ * Result of an interference query over a reception window, collected with a
+ * single pass over the power history.
+ */
+struct InterferenceResult {
+	double power; /**< Mean interference power. */
+	double overlap; /**< Fraction of the window overlapped by interferers. */
+	counter counters; /**< Collisions with ctrl and data packets. */
+	PowerChunkList chunks; /**< Interference power chunks, if requested. */
+};
+
 class ListNode
 {
 public:
@@ -104,32 +115,56 @@ public:
 	 * @param type type of the packet (DATA or CTRL)
 	 */
 	EndInterfEvent(double pw, PKT_TYPE tp)
+		: next_free(NULL)
 	{
 		power = pw;
 		type = tp;
 	}
+
+	/**
+	 * Destructor of the class EndInterfEvent
+	 */
+	virtual ~EndInterfEvent()
+	{
+	}
 	/**
-	 * Constructor of the class EndInterfEvent for OFDM
+	 * Take an event from the free list, allocating a new one only when the
+	 * list is empty. The free list is shared by all the interference modules.
 	 * @param pw Received power of the current packet
 	 * @param type type of the packet (DATA or CTRL)
+	 * @return pointer to the event
 	 */
-
-	EndInterfEvent(double pw, PKT_TYPE tp, const std::vector<double> &carPwr)
-		: carrier_power(carPwr)
+	static EndInterfEvent *create(double pw, PKT_TYPE tp);
+	/**
+	 * Give back to the free list an event that has been handled
+	 * @param e pointer to the event
+	 */
+	static void release(EndInterfEvent *e);
+	/**
+	 * @return number of events taken from the free list
+	 */
+	static long
+	getPoolHits()
 	{
-		power = pw;
-		type = tp;
+		return pool_hits_;
 	}
-
 	/**
-	 * Destructor of the class EndInterfEvent
+	 * @return number of events allocated because the free list was empty
 	 */
-	virtual ~EndInterfEvent()
+	static long
+	getPoolMisses()
 	{
+		return pool_misses_;
 	}
+
 	double power;
 	PKT_TYPE type;
-	std::vector<double> carrier_power;
+	EndInterfEvent *next_free; /**< Next event in the free list. */
+
+protected:
+	static EndInterfEvent *free_list_; /**< Head of the free list. */
+	static long pool_hits_; /**< Events taken from the free list. */
+	static long pool_misses_; /**< Events allocated with new. */
 };
 
 class uwinterference;
@@ -158,6 +193,19 @@ public:
 	 * Destructor of the class uwinterference
 	 */
 	virtual ~uwinterference();
+	/**
+	 * TCL command interpreter. It implements the following OTcl methods:
+	 * getEventPoolHits: events of the process taken from the free list;
+	 * getEventPoolMisses: events of the process allocated with new.
+	 *
+	 * @param argc Number of arguments in <i>argv</i>.
+	 * @param argv Array of strings which are the command parameters (Note that
+	 * <i>argv[0]</i> is the name of the object).
+	 * @return TCL_OK or TCL_ERROR whether the command has been dispatched
+	 * successfully or not.
+	 *
+	 */
+	virtual int command(int, const char *const *);
 	/**
 	 * Add a packet to the interference calculation
 	 * @param p Pointer to the interferer packet
@@ -220,6 +268,34 @@ public:
 	 * @return counter variable that represent the counters of the interference
 	 */
 	virtual counter getCounters(double starttime, double duration, PKT_TYPE tp);
+	/**
+	 * Returns power, overlap and counters of the interference for the given
+	 * packet, visiting the power history only once
+	 * @param p Pointer of the packet for which the interference is needed
+	 * @param chunks true to fill also the list of power chunks
+	 * @return reference to the result, valid until the next query
+	 */
+	virtual const InterferenceResult &getInterference(
+			Packet *p, bool chunks = false);
+	/**
+	 * Returns power, overlap and counters of the interference for the given
+	 * reception window, visiting the power history only once
+	 * @param power Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @param chunks true to fill also the list of power chunks
+	 * @return reference to the result, valid until the next query
+	 */
+	virtual const InterferenceResult &getInterference(double power,
+			double starttime, double duration, PKT_TYPE tp,
+			bool chunks = false);
+	/**
+	 * Returns the interference power chunks for the given packet
+	 * @param p Pointer of the packet for which the chunks are needed
+	 * @return list of (power, duration) interference chunks
+	 */
+	virtual const PowerChunkList &getInterferencePowerChunkList(Packet *p);
 	/**
 	 * Get the timestamp of the start of reception phase
 	 * @return timestamp of the start of reception phase
@@ -251,6 +327,49 @@ public:
 	}
 
 protected:
+	/**
+	 * Check if result_ already holds the answer to the given query
+	 * @param power Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @param chunks true if the list of power chunks is needed
+	 * @return true if result_ can be returned as it is
+	 */
+	bool isCachedQuery(double power, double starttime, double duration,
+			PKT_TYPE tp, bool chunks) const;
+	/**
+	 * Record the query whose answer is stored in result_
+	 * @param power Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @param chunks true if the list of power chunks has been filled
+	 */
+	void setCachedQuery(double power, double starttime, double duration,
+			PKT_TYPE tp, bool chunks);
+	/**
+	 * Append a chunk to result_, skipping the steps without interference
+	 * and the zero length steps due to the EPSILON_TIME compensation
+	 * @param power interference power of the chunk
+	 * @param time duration of the chunk
+	 */
+	void addPowerChunk(double power, double time);
+	/**
+	 * Turn the values collected by a query into result_
+	 * @param power Received power of the current packet
+	 * @param integral integral of the total power over the window
+	 * @param overlap time with collisions in the window
+	 * @param ctrl_pkts ctrl packets in the window, own packet included
+	 * @param data_pkts data packets in the window, own packet included
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 */
+	void fillResult(double power, double integral, double overlap,
+			int ctrl_pkts, int data_pkts, double starttime, double duration,
+			PKT_TYPE tp);
+
 	std::list<ListNode> power_list; /**<List with power and counters*/
 	EndInterfTimer end_timer; /**< Timer for schedules end of interference
 									 for a transmission */
@@ -260,6 +379,15 @@ protected:
 										 of the first interferer packet */
 	double start_rx_time; /**< timestamp of the start of reception phase */
 	double end_rx_time; /**< timetamp of the end of reception phase */
+
+	InterferenceResult result_; /**< Result of the last getInterference. */
+	bool query_valid_; /**< true if result_ matches the history. */
+	bool query_chunks_; /**< true if result_ has the chunks. */
+	PKT_TYPE query_type_; /**< Packet type of the last query. */
+	double query_power_; /**< Rx power of the last query. */
+	double query_start_; /**< Start time of the last query. */
+	double query_duration_; /**< Duration of the last query. */
+	double query_now_; /**< Time of the last query. */
 };
 
 #endif /*UW_INTERFERENCE*/
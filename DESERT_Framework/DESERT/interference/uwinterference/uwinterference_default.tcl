@@ -31,3 +31,7 @@
 Module/UW/INTERFERENCE set use_maxinterval_ 1 
 Module/UW/INTERFERENCE set maxinterval_ 50 
 Module/UW/INTERFERENCE set debug_ 0
+
+Module/UW/INTERFERENCE/INDEXED set use_maxinterval_ 1 
+Module/UW/INTERFERENCE/INDEXED set maxinterval_ 50 
+Module/UW/INTERFERENCE/INDEXED set debug_ 0
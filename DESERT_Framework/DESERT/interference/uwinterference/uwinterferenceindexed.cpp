@@ -0,0 +1,406 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwinterferenceindexed.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of uwinterferenceindexed class.
+ *
+ */
+
+#include "uwinterferenceindexed.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <mphy.h>
+
+#define POWER_PRECISION_THRESHOLD (1e-14)
+#define EPSILON_TIME 0.000000000001
+#define INITIAL_RING_SIZE 64
+
+static class Interf_Indexed_Class : public TclClass
+{
+public:
+	Interf_Indexed_Class()
+		: TclClass("Module/UW/INTERFERENCE/INDEXED")
+	{
+	}
+
+	TclObject *
+	create(int, const char *const *)
+	{
+		return (new uwinterferenceindexed);
+	}
+} class_interf_indexed;
+
+uwinterferenceindexed::uwinterferenceindexed()
+	: uwinterference()
+	, ring_(INITIAL_RING_SIZE)
+	, head_(0)
+	, count_(0)
+{
+}
+
+uwinterferenceindexed::~uwinterferenceindexed()
+{
+}
+
+void
+uwinterferenceindexed::pushNode(double t, double sum_pw, int ctrl, int data)
+{
+	if (count_ == (int) ring_.size()) {
+		std::vector<IndexedNode> grown(2 * ring_.size());
+		for (int i = 0; i < count_; i++)
+			grown[i] = at(i);
+		ring_.swap(grown);
+		head_ = 0;
+	}
+
+	IndexedNode node;
+	if (count_ == 0) {
+		node.time = t;
+		node.power_integral = 0;
+		node.overlap_time = 0;
+		node.ctrl_arrivals = 0;
+		node.data_arrivals = 0;
+	} else {
+		const IndexedNode &prev = back();
+		// Steps are kept sorted, a late step is collapsed on the previous one
+		node.time = std::max(t, prev.time);
+		node.power_integral = powerIntegralAt(count_ - 1, node.time);
+		node.overlap_time = overlapTimeAt(count_ - 1, node.time);
+		node.ctrl_arrivals =
+				prev.ctrl_arrivals + std::max(ctrl - prev.ctrl_cnt, 0);
+		node.data_arrivals =
+				prev.data_arrivals + std::max(data - prev.data_cnt, 0);
+	}
+	node.sum_power = sum_pw;
+	node.ctrl_cnt = ctrl;
+	node.data_cnt = data;
+
+	ring_[(head_ + count_) & (ring_.size() - 1)] = node;
+	count_++;
+}
+
+void
+uwinterferenceindexed::trimHistory()
+{
+	if (!use_maxinterval_)
+		return;
+
+	while (count_ > 0 && at(0).time < NOW - maxinterval_) {
+		head_ = (head_ + 1) & (ring_.size() - 1);
+		count_--;
+	}
+}
+
+int
+uwinterferenceindexed::findStep(double t) const
+{
+	int lo = 0;
+	int hi = count_;
+
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (at(mid).time <= t)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo - 1;
+}
+
+double
+uwinterferenceindexed::powerIntegralAt(int i, double t) const
+{
+	const IndexedNode &node = at(i);
+	return node.power_integral + node.sum_power * (t - node.time);
+}
+
+double
+uwinterferenceindexed::overlapTimeAt(int i, double t) const
+{
+	const IndexedNode &node = at(i);
+	if (node.ctrl_cnt > 1 || node.data_cnt > 1)
+		return node.overlap_time + (t - node.time);
+	return node.overlap_time;
+}
+
+void
+uwinterferenceindexed::addToInterference(double pw, PKT_TYPE tp)
+{
+	query_valid_ = false;
+	trimHistory();
+
+	if (count_ == 0) {
+		if (tp == CTRL)
+			pushNode(NOW, pw, 1, 0);
+		else
+			pushNode(NOW, pw, 0, 1);
+	} else {
+		IndexedNode last = back();
+		if (tp == CTRL)
+			pushNode(NOW,
+					last.sum_power + pw,
+					last.ctrl_cnt + 1,
+					last.data_cnt);
+		else
+			pushNode(NOW,
+					last.sum_power + pw,
+					last.ctrl_cnt,
+					last.data_cnt + 1);
+	}
+
+	if (debug_) {
+		std::cout << NOW << " uwinterferenceindexed::addToInterference, "
+				  << "power: " << pw << " ,total power: " << back().sum_power
+				  << " ,ctrl_packet: " << back().ctrl_cnt
+				  << " ,data packets: " << back().data_cnt << std::endl;
+	}
+}
+
+void
+uwinterferenceindexed::removeFromInterference(double pw, PKT_TYPE tp)
+{
+	query_valid_ = false;
+	trimHistory();
+
+	if (count_ == 0) {
+		std::cerr << "uwinterferenceindexed::removeFromInterference, "
+				  << "some interference removed wrongly" << std::endl;
+		return;
+	}
+
+	IndexedNode last = back();
+	double power_temp = last.sum_power - pw;
+	if (power_temp < 0) {
+		if (debug_) {
+			std::cout << NOW
+					  << " Precision error, negative power: " << power_temp
+					  << std::endl;
+		}
+		power_temp = 0;
+	}
+
+	// NOW+EPSILON_TIME to compensate the early scheduling in
+	// addToInterference(Packet* p)
+	if (tp == CTRL)
+		pushNode(NOW + EPSILON_TIME,
+				power_temp,
+				last.ctrl_cnt - 1,
+				last.data_cnt);
+	else
+		pushNode(NOW + EPSILON_TIME,
+				power_temp,
+				last.ctrl_cnt,
+				last.data_cnt - 1);
+
+	if (debug_) {
+		std::cout << NOW << " uwinterferenceindexed::removeFromInterference, "
+				  << "power: " << pw << " ,total power: " << back().sum_power
+				  << " ,ctrl_packet: " << back().ctrl_cnt
+				  << " ,data packets: " << back().data_cnt << std::endl;
+	}
+}
+
+double
+uwinterferenceindexed::getInterferencePower(
+		double power, double starttime, double duration)
+{
+	assert(starttime <= NOW);
+	assert(duration > 0);
+
+	double integral = 0;
+	if (count_ > 0) {
+		int step = findStep(starttime);
+		integral = powerIntegralAt(count_ - 1, NOW);
+		if (step >= 0)
+			integral -= powerIntegralAt(step, starttime);
+		else
+			integral -= at(0).power_integral;
+	}
+	double interference = (integral / duration) - power;
+
+	if (std::abs(interference) < POWER_PRECISION_THRESHOLD) {
+		if (debug_)
+			std::cout << "getInterferencePower() WARNING:"
+					  << " interference=" << interference
+					  << " POWER_PRECISION_THRESHOLD="
+					  << POWER_PRECISION_THRESHOLD
+					  << ". Precision error, interference set to 0"
+					  << std::endl;
+	}
+	// Check for cancellation errors
+	// which can arise when interference is subtracted
+	if (interference < 0) {
+		interference = 0;
+		if (debug_)
+			std::cout << "getInterferencePower() WARNING:"
+					  << " cancellation errors, interference set to 0"
+					  << std::endl;
+	}
+
+	if (debug_) {
+		std::cout << "transmission from " << starttime << " to "
+				  << starttime + duration << " power " << power
+				  << " gets interference " << interference << std::endl;
+	}
+	return interference;
+}
+
+double
+uwinterferenceindexed::getCurrentTotalPower()
+{
+	if (count_ == 0)
+		return 0.0;
+	return back().sum_power;
+}
+
+double
+uwinterferenceindexed::getTimeOverlap(double starttime, double duration)
+{
+	assert(starttime <= NOW);
+	assert(duration > 0);
+
+	if (count_ == 0)
+		return 0.0;
+
+	int step = findStep(starttime);
+	double overlap = overlapTimeAt(count_ - 1, NOW);
+	if (step >= 0)
+		overlap -= overlapTimeAt(step, starttime);
+	else
+		overlap -= at(0).overlap_time;
+
+	return overlap / duration;
+}
+
+counter
+uwinterferenceindexed::getCounters(
+		double starttime, double duration, PKT_TYPE tp)
+{
+	assert(starttime <= NOW);
+	assert(duration > 0);
+
+	int ctrl_pkts = 0;
+	int data_pkts = 0;
+
+	if (count_ > 0) {
+		// Same accounting of uwinterference::getCounters(): packets being
+		// received at starttime, plus the arrivals of the steps following
+		// the first one after starttime
+		int step = findStep(starttime);
+		const IndexedNode &last = back();
+		if (step + 1 < count_) {
+			const IndexedNode &next = at(step + 1);
+			ctrl_pkts = last.ctrl_arrivals - next.ctrl_arrivals;
+			data_pkts = last.data_arrivals - next.data_arrivals;
+		}
+		if (step >= 0) {
+			ctrl_pkts += at(step).ctrl_cnt;
+			data_pkts += at(step).data_cnt;
+		}
+	}
+
+	if (tp == CTRL) {
+		ctrl_pkts--;
+	} else {
+		data_pkts--;
+	}
+
+	if (debug_) {
+		std::cout << NOW << " uwinterferenceindexed::getCounters(), "
+				  << "collisions with ctrl pkts: " << ctrl_pkts
+				  << ", collisions with data pkts: " << data_pkts
+				  << std::endl;
+	}
+
+	return counter(ctrl_pkts, data_pkts);
+}
+
+const InterferenceResult &
+uwinterferenceindexed::getInterference(double power, double starttime,
+		double duration, PKT_TYPE tp, bool chunks)
+{
+	assert(starttime <= NOW);
+	assert(duration > 0);
+
+	if (isCachedQuery(power, starttime, duration, tp, chunks))
+		return result_;
+
+	double integral = 0;
+	double overlap = 0;
+	int ctrl_pkts = 0;
+	int data_pkts = 0;
+	result_.chunks.clear();
+
+	if (count_ > 0) {
+		int step = findStep(starttime);
+		const IndexedNode &last = back();
+		integral = powerIntegralAt(count_ - 1, NOW);
+		overlap = overlapTimeAt(count_ - 1, NOW);
+		if (step >= 0) {
+			integral -= powerIntegralAt(step, starttime);
+			overlap -= overlapTimeAt(step, starttime);
+			ctrl_pkts = at(step).ctrl_cnt;
+			data_pkts = at(step).data_cnt;
+		} else {
+			integral -= at(0).power_integral;
+			overlap -= at(0).overlap_time;
+		}
+		if (step + 1 < count_) {
+			ctrl_pkts += last.ctrl_arrivals - at(step + 1).ctrl_arrivals;
+			data_pkts += last.data_arrivals - at(step + 1).data_arrivals;
+		}
+
+		if (chunks) {
+			// Same order of the list based model, most recent chunk first
+			double lasttime = NOW;
+			for (int i = count_ - 1; i > step; i--) {
+				addPowerChunk(at(i).sum_power - power, lasttime - at(i).time);
+				lasttime = at(i).time;
+			}
+			if (step >= 0)
+				addPowerChunk(at(step).sum_power - power, lasttime - starttime);
+		}
+	}
+
+	fillResult(power,
+			integral,
+			overlap,
+			ctrl_pkts,
+			data_pkts,
+			starttime,
+			duration,
+			tp);
+	setCachedQuery(power, starttime, duration, tp, chunks);
+	return result_;
+}
@@ -0,0 +1,200 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwinterferenceindexed.h
+ * @version 1.0.0
+ *
+ * \brief Definition of uwinterferenceindexed class, an interference model
+ * that keeps the power history in a time ordered ring buffer with prefix
+ * integrated values.
+ *
+ */
+
+#ifndef UW_INTERFERENCE_INDEXED
+#define UW_INTERFERENCE_INDEXED
+
+#include "uwinterference.h"
+
+#include <vector>
+
+/**
+ * Entry of the power history of uwinterferenceindexed. Besides the step
+ * values already stored by ListNode, each entry keeps the integral of the
+ * power, the collision time and the packet arrivals accumulated from the
+ * first entry up to its own timestamp.
+ */
+struct IndexedNode {
+	double time; /**< Timestamp of the power change. */
+	double sum_power; /**< Total rx power from time on. */
+	double power_integral; /**< Integral of sum_power up to time. */
+	double overlap_time; /**< Time with more than one packet up to time. */
+	int ctrl_cnt; /**< Control packets being received from time on. */
+	int data_cnt; /**< Data packets being received from time on. */
+	int ctrl_arrivals; /**< Control packet arrivals up to time. */
+	int data_arrivals; /**< Data packet arrivals up to time. */
+};
+
+/**
+ * Interference model with the same behaviour of uwinterference, that answers
+ * the power, overlap and counter queries for a reception window with a
+ * single binary search instead of a walk over the whole history.
+ */
+class uwinterferenceindexed : public uwinterference
+{
+public:
+	using uwinterference::addToInterference;
+	using uwinterference::getCounters;
+	using uwinterference::getInterference;
+	using uwinterference::getInterferencePower;
+	using uwinterference::getTimeOverlap;
+
+	/**
+	 * Constructor of the class uwinterferenceindexed
+	 */
+	uwinterferenceindexed();
+	/**
+	 * Destructor of the class uwinterferenceindexed
+	 */
+	virtual ~uwinterferenceindexed();
+	/**
+	 * Add a packet to the interference calculation
+	 * @param pw Received power of the current packet
+	 * @param type type of the packet (DATA or CTRL)
+	 */
+	virtual void addToInterference(double pw, PKT_TYPE tp);
+	/**
+	 * Remove a packet to the interference calculation
+	 * @param pw Received power of the current packet
+	 * @param type type of the packet (DATA or CTRL)
+	 */
+	virtual void removeFromInterference(double pw, PKT_TYPE tp);
+	/**
+	 * Compute the average interference power for the given packet
+	 * @param pw Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @return average interference power
+	 */
+	virtual double getInterferencePower(
+			double power, double starttime, double duration);
+	/**
+	 * Returns the current total power
+	 * @return sum of the rx power of the packets being received
+	 */
+	virtual double getCurrentTotalPower();
+	/**
+	 * Returns the percentage of overlap between current packet and interference
+	 * packets
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @return percantage of overlap
+	 */
+	virtual double getTimeOverlap(double starttime, double duration);
+	/**
+	 * Returns the counters of collisions
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @return counter variable that represent the counters of the interference
+	 */
+	virtual counter getCounters(double starttime, double duration, PKT_TYPE tp);
+	/**
+	 * Returns power, overlap and counters of the interference for the given
+	 * reception window with a single lookup in the power history
+	 * @param power Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @param chunks true to fill also the list of power chunks
+	 * @return reference to the result, valid until the next query
+	 */
+	virtual const InterferenceResult &getInterference(double power,
+			double starttime, double duration, PKT_TYPE tp,
+			bool chunks = false);
+
+protected:
+	/**
+	 * Append a new step to the power history, updating the prefix values
+	 * @param t timestamp of the power change
+	 * @param sum_pw total rx power from t on
+	 * @param ctrl control packets being received from t on
+	 * @param data data packets being received from t on
+	 */
+	void pushNode(double t, double sum_pw, int ctrl, int data);
+	/**
+	 * Remove from the front of the history the steps older than
+	 * maxinterval_, if use_maxinterval_ is set
+	 */
+	void trimHistory();
+	/**
+	 * Find the last step of the history not later than the given time
+	 * @param t time of interest
+	 * @return logical index of the step, -1 if all the steps are later than t
+	 */
+	int findStep(double t) const;
+	/**
+	 * Access a step of the history through its logical index
+	 * @param i logical index, 0 is the oldest step
+	 * @return reference to the step
+	 */
+	inline const IndexedNode &
+	at(int i) const
+	{
+		return ring_[(head_ + i) & (ring_.size() - 1)];
+	}
+	/**
+	 * Access the most recent step of the history
+	 * @return reference to the step
+	 */
+	inline const IndexedNode &
+	back() const
+	{
+		return at(count_ - 1);
+	}
+	/**
+	 * Integral of the total power from the oldest step up to the given time
+	 * @param i logical index of the last step not later than t
+	 * @param t time of interest
+	 * @return power integral
+	 */
+	double powerIntegralAt(int i, double t) const;
+	/**
+	 * Collision time from the oldest step up to the given time
+	 * @param i logical index of the last step not later than t
+	 * @param t time of interest
+	 * @return collision time
+	 */
+	double overlapTimeAt(int i, double t) const;
+
+	std::vector<IndexedNode> ring_; /**< Ring buffer, power of two size. */
+	int head_; /**< Position of the oldest step in ring_. */
+	int count_; /**< Number of steps stored in ring_. */
+};
+
+#endif /* UW_INTERFERENCE_INDEXED */
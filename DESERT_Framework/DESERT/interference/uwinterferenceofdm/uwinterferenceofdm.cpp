@@ -38,12 +38,14 @@
 
 #include "uwinterferenceofdm.h"
 
+#include <algorithm>
 #include <iostream>
 #include <mac.h>
 #include <mphy.h>
 
 #define POWER_PRECISION_THRESHOLD (1e-14)
 #define EPSILON_TIME 0.000000000001
+#define MIN_COMPACT_STEPS 256
 
 static class Interf_FOverlap_Class : public TclClass
 {
@@ -60,18 +62,79 @@ public:
 	}
 } class_interf_foverlap;
 
+EndInterfEventOFDM *EndInterfEventOFDM::ofdm_free_list_ = NULL;
+long EndInterfEventOFDM::ofdm_pool_hits_ = 0;
+long EndInterfEventOFDM::ofdm_pool_misses_ = 0;
+
+EndInterfEventOFDM *
+EndInterfEventOFDM::create(double pw, PKT_TYPE tp)
+{
+	if (!ofdm_free_list_) {
+		ofdm_pool_misses_++;
+		return new EndInterfEventOFDM(pw, tp);
+	}
+
+	EndInterfEventOFDM *e = ofdm_free_list_;
+	ofdm_free_list_ = static_cast<EndInterfEventOFDM *>(e->next_free);
+	ofdm_pool_hits_++;
+	e->next_free = NULL;
+	e->power = pw;
+	e->type = tp;
+	e->carrier_num = 0;
+	return e;
+}
+
+void
+EndInterfEventOFDM::release(EndInterfEventOFDM *e)
+{
+	e->next_free = ofdm_free_list_;
+	ofdm_free_list_ = e;
+}
+
 void
 EndInterfTimerOFDM::handle(Event *e)
 {
 
-	EndInterfEvent *ee = (EndInterfEvent *) e;
+	EndInterfEventOFDM *ee = (EndInterfEventOFDM *) e;
 	interference->removeFromInterference(
-			ee->power, ee->type, ee->carrier_power);
-	delete ee;
+			ee->power, ee->type, ee->carrier_power, ee->carrier_num);
+	EndInterfEventOFDM::release(ee);
+}
+
+/**
+ * Dot product of two contiguous columns
+ */
+static double
+dotProduct(const double *a, const double *b, int n)
+{
+	double sum = 0;
+	for (int i = 0; i < n; i++)
+		sum += a[i] * b[i];
+	return sum;
+}
+
+/**
+ * Add a scaled column to an accumulator column
+ */
+static void
+addScaled(double *acc, const double *col, double scale, int n)
+{
+	for (int i = 0; i < n; i++)
+		acc[i] += scale * col[i];
 }
 
 uwinterferenceofdm::uwinterferenceofdm()
 	: uwinterference()
+	, step_time_()
+	, step_power_()
+	, step_ctrl_()
+	, step_data_()
+	, carrier_power_()
+	, current_carrier_()
+	, first_step_(0)
+	, window_first_(0)
+	, window_weight_()
+	, window_power_()
 	, end_timerOFDM(this)
 {
 	bind("use_maxinterval_", &use_maxinterval_);
@@ -90,6 +153,12 @@ uwinterferenceofdm::command(int argc, const char *const *argv)
 		if (strcasecmp(argv[1], "getInterfCarriers") == 0) {
 			tcl.resultf("%d", getInterfCarriers());
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getEventPoolHits") == 0) {
+			tcl.resultf("%ld", EndInterfEventOFDM::getPoolHits());
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getEventPoolMisses") == 0) {
+			tcl.resultf("%ld", EndInterfEventOFDM::getPoolMisses());
+			return TCL_OK;
 		}
 	}
 	if (argc == 3) {
@@ -98,7 +167,7 @@ uwinterferenceofdm::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 	}
-	return uwinterferenceofdm::command(argc, argv);
+	return uwinterference::command(argc, argv);
 }
 
 void
@@ -107,7 +176,6 @@ uwinterferenceofdm::addToInterference(Packet *p)
 	hdr_MPhy *ph = HDR_MPHY(p);
 	hdr_mac *mach = HDR_MAC(p);
 	hdr_OFDM *ofdmph = HDR_OFDM(p);
-	std::vector<double> car_power;
 	int used_carriers = 0;
 
 	// Check how many carriers are effectively used
@@ -115,44 +183,32 @@ uwinterferenceofdm::addToInterference(Packet *p)
 		used_carriers += ofdmph->carriers[i];
 	}
 
-	// For each used carrier fill with associated power
-	for (int i = 0; i < ofdmph->carrierNum; i++) {
-		car_power.push_back(ph->Pr / used_carriers * ofdmph->carriers[i]);
-	}
 	bool ctrl_pkt = (mach->ftype() == MF_CTS || mach->ftype() == MF_RTS ||
 			mach->ftype() == MF_ACK);
+	PKT_TYPE tp = ctrl_pkt ? CTRL : DATA;
 
-	if (ctrl_pkt) {
+	if (debug_)
+		std::cout << NOW << " uwinterference::addToInterference() "
+				  << (ctrl_pkt ? "CTRL" : "DATA") << " packet" << std::endl;
+	addToInterference(ph->Pr, tp, ofdmph->carriers, ofdmph->carrierNum);
 
-		if (debug_)
-			std::cout << NOW
-					  << " uwinterference::addToInterference() CTRL packet"
-					  << std::endl;
-		addToInterference(ph->Pr, CTRL, ofdmph->carriers, ofdmph->carrierNum);
-		EndInterfEvent *ee = new EndInterfEvent(ph->Pr, CTRL, car_power);
-		// EPSILON_TIME needed to avoid the scheduling of simultaneous events
-		Scheduler::instance().schedule(
-				&end_timerOFDM, ee, ph->duration - EPSILON_TIME);
-
-	} else {
-
-		if (debug_)
-			std::cout << NOW
-					  << " uwinterference::addToInterference() DATA packet"
-					  << std::endl;
-		addToInterference(ph->Pr, DATA, ofdmph->carriers, ofdmph->carrierNum);
-		EndInterfEvent *ee = new EndInterfEvent(ph->Pr, DATA, car_power);
-		// EPSILON_TIME needed to avoid the scheduling of simultaneous events
-		Scheduler::instance().schedule(
-				&end_timerOFDM, ee, ph->duration - EPSILON_TIME);
+	// For each used carrier fill with associated power
+	EndInterfEventOFDM *ee = EndInterfEventOFDM::create(ph->Pr, tp);
+	ee->carrier_num = ofdmph->carrierNum;
+	for (int i = 0; i < ofdmph->carrierNum; i++) {
+		ee->carrier_power[i] = ph->Pr / used_carriers * ofdmph->carriers[i];
 	}
+	// EPSILON_TIME needed to avoid the scheduling of simultaneous events
+	Scheduler::instance().schedule(
+			&end_timerOFDM, ee, ph->duration - EPSILON_TIME);
 }
 
 void
 uwinterferenceofdm::addToInterference(
 		double pw, PKT_TYPE tp, int *carriers, int carNum)
 {
-	std::vector<double> car_power;
+	query_valid_ = false;
+
 	int used_carriers = 0;
 
 	// Check how many carriers are effectively used
@@ -160,140 +216,77 @@ uwinterferenceofdm::addToInterference(
 		used_carriers += carriers[i];
 	}
 
-	// For each used carrier fill with associated power
-	for (int i = 0; i < carNum; i++) {
-		car_power.push_back(pw / used_carriers * carriers[i]);
-	}
-
-	if (use_maxinterval_) {
+	trimHistory();
+	resizeCarriers(carNum);
 
-		std::list<ListNodeOFDM>::iterator it;
-		for (it = power_list.begin(); it != power_list.end();) {
-			if (it->time < NOW - maxinterval_) {
-				it = power_list.erase(it); // Side effect: it++
-			} else
-				break;
-		}
-	}
+	// For each used carrier add the associated power
+	double car_pw = (used_carriers > 0) ? pw / used_carriers : 0;
+	double *current = current_carrier_.data();
+	for (int i = 0; i < carNum; i++)
+		current[i] += car_pw * carriers[i];
 
-	if (power_list.empty()) {
-
-		if (tp == CTRL) {
-			ListNodeOFDM pn(NOW, pw, 1, 0, car_power);
-			power_list.push_back(pn);
-		} else {
-			ListNodeOFDM pn(NOW, pw, 0, 1, car_power);
-			power_list.push_back(pn);
-		}
+	if (!hasSteps()) {
+		if (tp == CTRL)
+			pushStep(NOW, pw, 1, 0);
+		else
+			pushStep(NOW, pw, 0, 1);
 	} else {
-
-		double power_temp = power_list.back().sum_power;
-		int ctrl_temp = power_list.back().ctrl_cnt;
-		int data_temp = power_list.back().data_cnt;
-		std::vector<double> car_pwr_old = power_list.back().carrier_power;
-
-		string carPwr = "CarrierPower_Vector = [";
-
-		for (int i = 0; i < car_pwr_old.size(); i++) {
-			car_power.at(i) += car_pwr_old.at(i);
-			carPwr += (std::to_string(car_power.at(i)) + ", ");
-		}
-		carPwr += "]";
-
-		if (debug_)
-			std::cout << NOW << " uwinterference::addToInterference() "
-					  << carPwr << std::endl;
-
-		if (tp == CTRL) {
-			ListNodeOFDM pn(
-					NOW, pw + power_temp, ctrl_temp + 1, data_temp, car_power);
-			power_list.push_back(pn);
-		} else {
-			ListNodeOFDM pn(
-					NOW, pw + power_temp, ctrl_temp, data_temp + 1, car_power);
-			power_list.push_back(pn);
-		}
+		int last = step_time_.size() - 1;
+		if (tp == CTRL)
+			pushStep(NOW,
+					step_power_[last] + pw,
+					step_ctrl_[last] + 1,
+					step_data_[last]);
+		else
+			pushStep(NOW,
+					step_power_[last] + pw,
+					step_ctrl_[last],
+					step_data_[last] + 1);
 	}
 
 	if (debug_) {
+		std::cout << NOW << " uwinterference::addToInterference() "
+				  << "CarrierPower_Vector = [";
+		for (std::size_t i = 0; i < current_carrier_.size(); i++)
+			std::cout << current_carrier_[i] << ", ";
+		std::cout << "]" << std::endl;
 		std::cout << NOW << " uwinterference::addToInterference, power: " << pw
-				  << " ,total power: " << power_list.back().sum_power
-				  << " ,ctrl_packet: " << power_list.back().ctrl_cnt
-				  << " ,data packets: " << power_list.back().data_cnt
-				  << std::endl;
+				  << " ,total power: " << step_power_.back()
+				  << " ,ctrl_packet: " << step_ctrl_.back()
+				  << " ,data packets: " << step_data_.back() << std::endl;
 	}
 }
 
 void
 uwinterferenceofdm::removeFromInterference(
-		double pw, PKT_TYPE tp, const std::vector<double> &carPwr)
+		double pw, PKT_TYPE tp, const double *carPwr, int carNum)
 {
-	if (use_maxinterval_) {
-		std::list<ListNodeOFDM>::iterator it;
-
-		for (it = power_list.begin(); it != power_list.end();) {
-			if (it->time < NOW - maxinterval_) {
-				it = power_list.erase(it); // Side effect: it++
-			} else
-				break;
-		}
-	}
+	query_valid_ = false;
 
-	if (power_list.empty()) {
+	trimHistory();
 
+	if (!hasSteps()) {
 		std::cerr << "uwinterference::removeFromInterference, "
 				  << "some interference removed wrongly" << std::endl;
 		return;
-	} else {
-		double power_temp = power_list.back().sum_power;
-		int ctrl_temp = power_list.back().ctrl_cnt;
-		int data_temp = power_list.back().data_cnt;
-		std::vector<double> car_pwr_old = power_list.back().carrier_power;
-		std::vector<double> car_pwr_new;
-		for (std::size_t i = 0; i < car_pwr_old.size(); ++i) {
-			double tempPwr = car_pwr_old[i] - carPwr[i];
-			if (tempPwr < 0) {
-				if (tempPwr < -0.001)
-					cerr << NOW << " NODE " << inodeID
-						 << " REMOVE FROM INTERFERENCE !!! result < 0 ("
-						 << tempPwr << ") car " << i << std::endl;
-				tempPwr = 0;
-			}
-			car_pwr_new.push_back(tempPwr);
-		}
+	}
 
-		if (tp == CTRL) {
-			// NOW+EPSILON_TIME to compensate the early scheduling in
-			// addToInterference(Packet* p)
-			ListNodeOFDM pn(NOW + EPSILON_TIME,
-					power_temp - pw,
-					ctrl_temp - 1,
-					data_temp,
-					car_pwr_new);
-			power_list.push_back(pn);
-		} else {
-
-			// NOW+EPSILON_TIME to compensate the early scheduling in
-			// addToInterference(Packet* p)
-			ListNodeOFDM pn(NOW + EPSILON_TIME,
-					power_temp - pw,
-					ctrl_temp,
-					data_temp - 1,
-					car_pwr_new);
-			power_list.push_back(pn);
+	resizeCarriers(carNum);
+	double *current = current_carrier_.data();
+	for (int i = 0; i < carNum; i++)
+		current[i] -= carPwr[i];
+	for (std::size_t i = 0; i < current_carrier_.size(); i++) {
+		if (current[i] < 0) {
+			if (current[i] < -0.001)
+				cerr << NOW << " NODE " << inodeID
+					 << " REMOVE FROM INTERFERENCE !!! result < 0 ("
+					 << current[i] << ") car " << i << std::endl;
+			current[i] = 0;
 		}
 	}
-	if (debug_) {
-		std::cout << NOW << " uwinterference::removeFromInterference, "
-				  << "power: " << pw
-				  << " ,total power: " << power_list.back().sum_power
-				  << " ,ctrl_packet: " << power_list.back().ctrl_cnt
-				  << " ,data packets: " << power_list.back().data_cnt
-				  << std::endl;
-	}
-
-	double power_temp = power_list.back().sum_power;
 
+	int last = step_time_.size() - 1;
+	double power_temp = step_power_[last] - pw;
 	if (power_temp < -0.001) {
 		if (debug_)
 			std::cout << NOW << " NODE " << inodeID
@@ -303,118 +296,188 @@ uwinterferenceofdm::removeFromInterference(
 			cerr << NOW << " NODE " << inodeID
 				 << " Precision ERROR, negative power: " << power_temp
 				 << std::endl;
+		power_temp = 0;
+	}
+
+	// NOW+EPSILON_TIME to compensate the early scheduling in
+	// addToInterference(Packet* p)
+	if (tp == CTRL)
+		pushStep(NOW + EPSILON_TIME,
+				power_temp,
+				step_ctrl_[last] - 1,
+				step_data_[last]);
+	else
+		pushStep(NOW + EPSILON_TIME,
+				power_temp,
+				step_ctrl_[last],
+				step_data_[last] - 1);
 
-		power_list.back().sum_power = 0;
+	if (debug_) {
+		std::cout << NOW << " uwinterference::removeFromInterference, "
+				  << "power: " << pw << " ,total power: " << step_power_.back()
+				  << " ,ctrl_packet: " << step_ctrl_.back()
+				  << " ,data packets: " << step_data_.back() << std::endl;
 	}
 }
 
-double
-uwinterferenceofdm::getInterferencePower(Packet *p)
+void
+uwinterferenceofdm::resizeCarriers(int carNum)
 {
+	if (carNum <= (int) carrier_power_.size())
+		return;
 
-	hdr_MPhy *ph = HDR_MPHY(p);
-	hdr_OFDM *ofdmph = HDR_OFDM(p);
+	// A carrier seen for the first time had no power in the previous steps
+	current_carrier_.resize(carNum, 0.0);
+	carrier_power_.resize(carNum, std::vector<double>(step_time_.size(), 0.0));
+}
 
-	return (getInterferencePower(ph->Pr,
-			ph->rxtime,
-			ph->duration,
-			ofdmph->carriers,
-			ofdmph->carrierNum));
+void
+uwinterferenceofdm::pushStep(double t, double sum_pw, int ctrl, int data)
+{
+	// Steps are kept sorted, a late step is collapsed on the previous one
+	if (hasSteps())
+		t = std::max(t, step_time_.back());
+
+	step_time_.push_back(t);
+	step_power_.push_back(sum_pw);
+	step_ctrl_.push_back(ctrl);
+	step_data_.push_back(data);
+	for (std::size_t i = 0; i < carrier_power_.size(); i++)
+		carrier_power_[i].push_back(current_carrier_[i]);
 }
 
-double
-uwinterferenceofdm::getInterferencePower(double power, double starttime,
-		double duration, int *carriers, int ncarriers)
+void
+uwinterferenceofdm::trimHistory()
 {
-	std::list<ListNodeOFDM>::reverse_iterator rit;
+	if (!use_maxinterval_)
+		return;
 
-	std::vector<double> car_pwr;
+	int n = step_time_.size();
+	while (first_step_ < n && step_time_[first_step_] < NOW - maxinterval_)
+		first_step_++;
 
-	double integral = 0;
-	double car_integral = 0;
-	double car_power = 0;
-	double lasttime = NOW;
-	assert(starttime <= NOW);
-	assert(duration > 0);
+	// Drop the expired steps only once they are the larger part of the
+	// columns, so that each step is moved a bounded number of times
+	if (first_step_ < MIN_COMPACT_STEPS || 2 * first_step_ < n)
+		return;
 
-	for (rit = power_list.rbegin(); rit != power_list.rend(); ++rit) {
-		car_power = 0;
-		if (starttime < rit->time) {
-			integral += rit->sum_power * (lasttime - rit->time);
-
-			// for each carrier add interf pwr if carrier is used
-			for (int i = 0; i < rit->carrier_power.size(); i++) {
-				car_power += carriers[i] * rit->carrier_power.at(i);
-			}
-
-			car_integral += car_power * (lasttime - rit->time);
-			lasttime = rit->time;
-		} else {
-
-			integral += rit->sum_power * (lasttime - starttime);
-			for (int i = 0; i < rit->carrier_power.size(); i++) {
-				car_power += carriers[i] * rit->carrier_power.at(i);
-			}
-			car_integral += car_power * (lasttime - starttime);
-			break;
-		}
-	}
-	double interference = (integral / duration) - power;
-	double ofdminterference = (car_integral / duration) - power;
-	if (interference < (ofdminterference - 1))
-		std::cerr << "PROBLEM interference VS OFDM interference "
-				  << interference << " - " << ofdminterference << std::endl;
+	step_time_.erase(step_time_.begin(), step_time_.begin() + first_step_);
+	step_power_.erase(step_power_.begin(), step_power_.begin() + first_step_);
+	step_ctrl_.erase(step_ctrl_.begin(), step_ctrl_.begin() + first_step_);
+	step_data_.erase(step_data_.begin(), step_data_.begin() + first_step_);
+	for (std::size_t i = 0; i < carrier_power_.size(); i++)
+		carrier_power_[i].erase(carrier_power_[i].begin(),
+				carrier_power_[i].begin() + first_step_);
+	first_step_ = 0;
+}
 
-	if (abs(interference) < POWER_PRECISION_THRESHOLD) {
-		if (debug_)
-			std::cout << "getInterferencePower() WARNING:"
-					  << " interference=" << interference
-					  << " POWER_PRECISION_THRESHOLD="
-					  << POWER_PRECISION_THRESHOLD
-					  << ". Precision error, interference set to 0" << endl;
+void
+uwinterferenceofdm::integrateWindow(
+		double starttime, const int *carriers, int ncar)
+{
+	int n = step_time_.size();
+
+	// Last step not later than starttime, it covers the window from its start
+	int lo = first_step_;
+	int hi = n;
+	while (lo < hi) {
+		int mid = lo + (hi - lo) / 2;
+		if (step_time_[mid] <= starttime)
+			lo = mid + 1;
+		else
+			hi = mid;
 	}
-	// Check for cancellation errors
-	// which can arise when interference is subtracted
-	if (interference < 0) {
-		if (debug_)
-			std::cout << "getInterferencePower() WARNING:"
-					  << " cancellation errors, interference set to 0"
-					  << " previous value " << interference << endl;
-		interference = 0;
+	window_first_ = std::max(lo - 1, first_step_);
+
+	int len = n - window_first_;
+	window_weight_.assign(len, 0.0);
+	double *weight = window_weight_.data();
+	const double *time = step_time_.data() + window_first_;
+	for (int i = 0; i < len - 1; i++)
+		weight[i] = time[i + 1] - time[i];
+	if (len > 0) {
+		weight[len - 1] = NOW - time[len - 1];
+		if (time[0] <= starttime)
+			weight[0] -= starttime - time[0];
 	}
 
-	if (debug_) {
-		std::cout << "transmission from " << starttime << " to "
-				  << starttime + duration << " power " << power
-				  << " gets interference " << interference << std::endl;
+	// Power on the used carriers, one sweep per carrier
+	if (!carriers) {
+		window_power_.assign(step_power_.begin() + window_first_,
+				step_power_.end());
+		return;
 	}
-	if (ofdminterference < 0) {
-		if (debug_)
-			std::cout << "getInterferencePower() WARNING:"
-					  << " cancellation errors, ofdminterference set to 0 "
-					  << "previous value " << ofdminterference << endl;
+	window_power_.assign(len, 0.0);
+	int used = std::min(ncar, (int) carrier_power_.size());
+	for (int c = 0; c < used; c++) {
+		if (carriers[c])
+			addScaled(window_power_.data(),
+					carrier_power_[c].data() + window_first_,
+					carriers[c],
+					len);
+	}
+}
+
+double
+uwinterferenceofdm::getInterferencePower(Packet *p)
+{
+	return getInterference(p).power;
+}
 
-		ofdminterference = 0;
+double
+uwinterferenceofdm::getInterferencePower(double power, double starttime,
+		double duration, int *carriers, int ncarriers)
+{
+	return getInterference(
+			power, starttime, duration, DATA, carriers, ncarriers)
+			.power;
+}
+
+int
+uwinterferenceofdm::getCarrierInterference(Packet *p, double *carrier_interf)
+{
+	hdr_MPhy *ph = HDR_MPHY(p);
+	hdr_OFDM *ofdmph = HDR_OFDM(p);
+	assert(ph->rxtime <= NOW);
+	assert(ph->duration > 0);
+
+	int used_carriers = 0;
+	for (int i = 0; i < ofdmph->carrierNum; i++)
+		used_carriers += ofdmph->carriers[i];
+	double car_pw = (used_carriers > 0) ? ph->Pr / used_carriers : 0;
+
+	integrateWindow(ph->rxtime, NULL, 0);
+	int len = window_weight_.size();
+	int ncar = std::min(ofdmph->carrierNum, (int) carrier_power_.size());
+	for (int c = 0; c < ncar; c++) {
+		double integral = dotProduct(carrier_power_[c].data() + window_first_,
+				window_weight_.data(),
+				len);
+		double interf = integral / ph->duration - car_pw * ofdmph->carriers[c];
+		carrier_interf[c] = std::max(interf, 0.0);
 	}
-	return ofdminterference;
+	for (int c = ncar; c < ofdmph->carrierNum; c++)
+		carrier_interf[c] = 0;
+
+	return ofdmph->carrierNum;
 }
 
 double
 uwinterferenceofdm::getCurrentTotalPower()
 {
-	if (power_list.empty())
+	if (!hasSteps())
 		return 0.0;
 	else
-		return (power_list.back().sum_power);
+		return step_power_.back();
 }
 
 double
 uwinterferenceofdm::getCurrentTotalPowerOnCarrier(int carrier)
 {
-	if (power_list.empty())
+	if (!hasSteps())
 		return 0.0;
 	else
-		return (power_list.back().carrier_power.at(carrier));
+		return current_carrier_.at(carrier);
 }
 
 double
@@ -428,28 +491,7 @@ uwinterferenceofdm::getTimeOverlap(Packet *p)
 double
 uwinterferenceofdm::getTimeOverlap(double starttime, double duration)
 {
-	std::list<ListNodeOFDM>::reverse_iterator rit;
-
-	double overlap = 0;
-	double lasttime = NOW;
-	assert(starttime <= NOW);
-	assert(duration > 0);
-
-	for (rit = power_list.rbegin(); rit != power_list.rend(); ++rit) {
-		if (starttime < rit->time) {
-
-			if (rit->ctrl_cnt > 1 || rit->data_cnt > 1) {
-				overlap += (lasttime - rit->time);
-			}
-			lasttime = rit->time;
-		} else {
-			if (rit->ctrl_cnt > 1 || rit->data_cnt > 1) {
-				overlap += (lasttime - starttime);
-			}
-			break;
-		}
-	}
-	return overlap / duration;
+	return getInterference(0, starttime, duration, DATA, NULL, 0).overlap;
 }
 
 counter
@@ -469,46 +511,100 @@ uwinterferenceofdm::getCounters(Packet *p)
 counter
 uwinterferenceofdm::getCounters(double starttime, double duration, PKT_TYPE tp)
 {
-	std::list<ListNodeOFDM>::reverse_iterator rit;
+	return getInterference(0, starttime, duration, tp, NULL, 0).counters;
+}
 
-	int ctrl_pkts = 0;
-	int data_pkts = 0;
+const InterferenceResult &
+uwinterferenceofdm::getInterference(Packet *p, bool chunks)
+{
+	hdr_MPhy *ph = HDR_MPHY(p);
+	hdr_mac *mach = HDR_MAC(p);
+	hdr_OFDM *ofdmph = HDR_OFDM(p);
+	PKT_TYPE tp = (mach->ftype() == MF_CONTROL) ? CTRL : DATA;
+
+	// The carriers are part of the packet, so they match whenever the
+	// other parameters of the query do
+	if (isCachedQuery(ph->Pr, ph->rxtime, ph->duration, tp, chunks))
+		return result_;
+
+	getInterference(ph->Pr,
+			ph->rxtime,
+			ph->duration,
+			tp,
+			ofdmph->carriers,
+			ofdmph->carrierNum,
+			chunks);
+	setCachedQuery(ph->Pr, ph->rxtime, ph->duration, tp, chunks);
+	return result_;
+}
+
+const InterferenceResult &
+uwinterferenceofdm::getInterference(double power, double starttime,
+		double duration, PKT_TYPE tp, bool chunks)
+{
+	return getInterference(power, starttime, duration, tp, NULL, 0, chunks);
+}
 
+const InterferenceResult &
+uwinterferenceofdm::getInterference(double power, double starttime,
+		double duration, PKT_TYPE tp, int *carriers, int ncar, bool chunks)
+{
 	assert(starttime <= NOW);
 	assert(duration > 0);
 
-	rit = power_list.rbegin();
-	int last_ctrl_cnt = rit->ctrl_cnt;
-	int last_data_cnt = rit->data_cnt;
-	rit++;
-	for (; rit != power_list.rend(); ++rit) {
-		if (starttime < rit->time) {
-			if (last_ctrl_cnt - rit->ctrl_cnt >= 0) {
-				ctrl_pkts += last_ctrl_cnt - rit->ctrl_cnt;
-			}
-			if (last_data_cnt - rit->data_cnt >= 0) {
-				data_pkts += last_data_cnt - rit->data_cnt;
-			}
-			last_ctrl_cnt = rit->ctrl_cnt;
-			last_data_cnt = rit->data_cnt;
-		} else {
-			ctrl_pkts += rit->ctrl_cnt;
-			data_pkts += rit->data_cnt;
-			break;
-		}
-	}
+	query_valid_ = false;
+	result_.chunks.clear();
+	integrateWindow(starttime, carriers, ncar);
 
-	if (tp == CTRL) {
-		ctrl_pkts--;
-	} else {
-		data_pkts--;
+	int len = window_weight_.size();
+	const double *weight = window_weight_.data();
+	double integral = dotProduct(
+			step_power_.data() + window_first_, weight, len);
+	double car_integral = dotProduct(window_power_.data(), weight, len);
+
+	double overlap = 0;
+	int ctrl_pkts = 0;
+	int data_pkts = 0;
+	if (len > 0) {
+		const int *ctrl = step_ctrl_.data() + window_first_;
+		const int *data = step_data_.data() + window_first_;
+		for (int i = 0; i < len; i++) {
+			if (ctrl[i] > 1 || data[i] > 1)
+				overlap += weight[i];
+		}
+		// Same accounting of uwinterference::getCounters(): packets being
+		// received at starttime, plus the arrivals of the steps following
+		// the first one after starttime
+		int i = 0;
+		if (step_time_[window_first_] <= starttime) {
+			ctrl_pkts = ctrl[0];
+			data_pkts = data[0];
+			i = 1;
+		}
+		for (; i < len - 1; i++) {
+			ctrl_pkts += std::max(ctrl[i + 1] - ctrl[i], 0);
+			data_pkts += std::max(data[i + 1] - data[i], 0);
+		}
 	}
 
-	if (debug_) {
-		std::cout << NOW << " uwinterference::getCounters(), collisions"
-				  << " with ctrl pkts: " << ctrl_pkts
-				  << ", collisions with data pkts: " << data_pkts << std::endl;
+	if (chunks) {
+		// Same order of the list based model, most recent chunk first
+		for (int i = len - 1; i >= 0; i--)
+			addPowerChunk(window_power_[i] - power, weight[i]);
 	}
 
-	return counter(ctrl_pkts, data_pkts);
+	if (carriers && integral < car_integral - duration)
+		std::cerr << "PROBLEM interference VS OFDM interference "
+				  << (integral / duration) - power << " - "
+				  << (car_integral / duration) - power << std::endl;
+
+	fillResult(power,
+			car_integral,
+			overlap,
+			ctrl_pkts,
+			data_pkts,
+			starttime,
+			duration,
+			tp);
+	return result_;
 }
@@ -44,38 +44,69 @@
 #include "uwinterference.h"
 #include "uwofdmphy_hdr.h"
 
+#include <vector>
+
 typedef std::pair<int, int> counter; /**< counter of collisions */
 
 class uwinterferenceofdm;
 
-class ListNodeOFDM : public ListNode
+class EndInterfEventOFDM : public EndInterfEvent
 {
 public:
-	std::vector<double> carrier_power;
-
 	/**
-	 * Constructor of the class ListNode when used with multicarrier
-	 * @param t time
-	 * @param sum_pw sum of the rx power in the node at the given time
-	 * @param ctrl  control packet counter
-	 * @param data data packet counter
+	 * Constructor of the class EndInterfEventOFDM
+	 * @param pw Received power of the current packet
+	 * @param type type of the packet (DATA or CTRL)
 	 */
-	ListNodeOFDM(double t, double sum_pw, int ctrl, int data,
-			const std::vector<double> &carPwr)
-		: carrier_power(carPwr)
+	EndInterfEventOFDM(double pw, PKT_TYPE tp)
+		: EndInterfEvent(pw, tp)
+		, carrier_num(0)
 	{
-		time = t;
-		sum_power = sum_pw;
-		ctrl_cnt = ctrl;
-		data_cnt = data;
 	}
 
 	/**
-	 * Destructor of the class ListNode
+	 * Destructor of the class EndInterfEventOFDM
+	 */
+	virtual ~EndInterfEventOFDM()
+	{
+	}
+	/**
+	 * Take an event from the OFDM free list, allocating a new one only when
+	 * the list is empty. The carrier powers have to be filled by the caller.
+	 * @param pw Received power of the current packet
+	 * @param type type of the packet (DATA or CTRL)
+	 * @return pointer to the event
+	 */
+	static EndInterfEventOFDM *create(double pw, PKT_TYPE tp);
+	/**
+	 * Give back to the OFDM free list an event that has been handled
+	 * @param e pointer to the event
 	 */
-	virtual ~ListNodeOFDM()
+	static void release(EndInterfEventOFDM *e);
+	/**
+	 * @return number of events taken from the OFDM free list
+	 */
+	static long
+	getPoolHits()
 	{
+		return ofdm_pool_hits_;
 	}
+	/**
+	 * @return number of events allocated because the OFDM free list was empty
+	 */
+	static long
+	getPoolMisses()
+	{
+		return ofdm_pool_misses_;
+	}
+
+	double carrier_power[MAX_CARRIERS]; /**< Rx power on each carrier. */
+	int carrier_num; /**< Number of valid entries of carrier_power. */
+
+protected:
+	static EndInterfEventOFDM *ofdm_free_list_; /**< Head of the free list. */
+	static long ofdm_pool_hits_; /**< Events taken from the free list. */
+	static long ofdm_pool_misses_; /**< Events allocated with new. */
 };
 
 class EndInterfTimerOFDM : public Handler
@@ -98,6 +129,8 @@ public:
 
 	/**
 	 * TCL command interpreter. It implements the following OTcl methods:
+	 * getInterfCarriers, setInterfCarriers and, for the OFDM events of the
+	 * process, getEventPoolHits and getEventPoolMisses.
 	 *
 	 * @param argc Number of arguments in <i>argv</i>.
 	 * @param argv Array of strings which are the command parameters (Note that
@@ -134,9 +167,11 @@ public:
 	 * Remove a packet to the interference calculation
 	 * @param pw Received power of the current packet
 	 * @param type type of the packet (DATA or CTRL)
+	 * @param carPwr rx power of the packet on each carrier
+	 * @param carNum number of carriers
 	 */
 	virtual void removeFromInterference(
-			double pw, PKT_TYPE tp, const std::vector<double> &carPwr);
+			double pw, PKT_TYPE tp, const double *carPwr, int carNum);
 	/**
 	 * Compute the average interference power for the given packet
 	 * @param p Pointer to the interferer packet
@@ -152,6 +187,15 @@ public:
 	 */
 	virtual double getInterferencePower(double power, double starttime,
 			double duration, int *carriers, int ncar);
+	/**
+	 * Compute the average interference power on each carrier for the given
+	 * packet, the power of the packet itself is not included
+	 * @param p Pointer to the packet for which the interference is needed
+	 * @param carrier_interf array filled with the interference power of each
+	 * carrier, it must hold at least the carrierNum of the packet
+	 * @return number of entries written in carrier_interf
+	 */
+	virtual int getCarrierInterference(Packet *p, double *carrier_interf);
 	/**/
 	virtual double getCurrentTotalPower();
 	/**
@@ -189,6 +233,43 @@ public:
 	 * @return counter variable that represent the counters of the interference
 	 */
 	virtual counter getCounters(double starttime, double duration, PKT_TYPE tp);
+	/**
+	 * Returns power on the used carriers, overlap and counters of the
+	 * interference for the given packet, visiting the power history only once
+	 * @param p Pointer of the packet for which the interference is needed
+	 * @param chunks true to fill also the list of power chunks
+	 * @return reference to the result, valid until the next query
+	 */
+	virtual const InterferenceResult &getInterference(
+			Packet *p, bool chunks = false);
+	/**
+	 * Returns power over all the carriers, overlap and counters of the
+	 * interference for the given reception window
+	 * @param power Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @param chunks true to fill also the list of power chunks
+	 * @return reference to the result, valid until the next query
+	 */
+	virtual const InterferenceResult &getInterference(double power,
+			double starttime, double duration, PKT_TYPE tp,
+			bool chunks = false);
+	/**
+	 * Returns power on the given carriers, overlap and counters of the
+	 * interference for the given reception window
+	 * @param power Received power of the current packet
+	 * @param starttime timestamp of the start of reception phase
+	 * @param duration duration of the reception phase
+	 * @param type type of the packet (DATA or CTRL)
+	 * @param carriers carriers used by the packet, NULL for all the carriers
+	 * @param ncar number of carriers
+	 * @param chunks true to fill also the list of power chunks
+	 * @return reference to the result, valid until the next query
+	 */
+	virtual const InterferenceResult &getInterference(double power,
+			double starttime, double duration, PKT_TYPE tp, int *carriers,
+			int ncar, bool chunks = false);
 
 	/**
 	 * @return number of carriers used by the node
@@ -240,7 +321,52 @@ public:
 	}
 
 protected:
-	std::list<ListNodeOFDM> power_list; /**<List with power and counters*/
+	/**
+	 * Grow the per carrier columns up to the given number of carriers
+	 * @param carNum number of carriers of the current packet
+	 */
+	void resizeCarriers(int carNum);
+	/**
+	 * Append a step of the power history, with the current carrier powers
+	 * @param t time of the step
+	 * @param sum_pw sum of the rx power at the given time
+	 * @param ctrl control packet counter
+	 * @param data data packet counter
+	 */
+	void pushStep(double t, double sum_pw, int ctrl, int data);
+	/**
+	 * Drop the steps older than maxinterval_, if use_maxinterval_ is set
+	 */
+	void trimHistory();
+	/**
+	 * Compute for each step from starttime to NOW the time it lasts inside
+	 * the window (window_weight_) and its power on the used carriers
+	 * (window_power_). The first step of the window is window_first_.
+	 * @param starttime timestamp of the start of reception phase
+	 * @param carriers carriers used by the packet, NULL for all the carriers
+	 * @param ncar number of carriers
+	 */
+	void integrateWindow(double starttime, const int *carriers, int ncar);
+	/**
+	 * @return true if the power history holds at least one step
+	 */
+	inline bool
+	hasSteps() const
+	{
+		return first_step_ < (int) step_time_.size();
+	}
+
+	std::vector<double> step_time_; /**< Time of each step. */
+	std::vector<double> step_power_; /**< Total power of each step. */
+	std::vector<int> step_ctrl_; /**< Control packets of each step. */
+	std::vector<int> step_data_; /**< Data packets of each step. */
+	std::vector<std::vector<double> >
+			carrier_power_; /**< Power of each step, one column per carrier. */
+	std::vector<double> current_carrier_; /**< Power on each carrier now. */
+	int first_step_; /**< First step not yet expired. */
+	int window_first_; /**< First step of the last integrated window. */
+	std::vector<double> window_weight_; /**< Duration of each window step. */
+	std::vector<double> window_power_; /**< Used carriers power per step. */
 	EndInterfTimerOFDM end_timerOFDM; /**< Timer for schedules end of
 										 interference for a transmission */
 	int inodeID; /* ID of the node */
@@ -38,6 +38,7 @@
  */
 
 #include "uwdriftposition.h"
+#include "uwmobilitymanager.h"
 #include <rng.h>
 
 #include <ostream>
@@ -102,10 +103,12 @@ UwDriftPosition::UwDriftPosition()
 	old_speed_x_ = starting_speed_x_;
 	old_speed_y_ = starting_speed_y_;
 	old_speed_z_ = starting_speed_z_;
+	UwMobilityManager::instance().add(this);
 }
 
 UwDriftPosition::~UwDriftPosition()
 {
+	UwMobilityManager::instance().remove(this);
 }
 
 int
@@ -117,6 +120,9 @@ UwDriftPosition::command(int argc, const char *const *argv)
 void
 UwDriftPosition::update(const double &now)
 {
+	if (updateTime_ <= 0)
+		return;
+
 	double t;
 
 	for (t = nextUpdateTime_; t < now; t += updateTime_) {
@@ -267,3 +273,24 @@ UwDriftPosition::getZ()
 		update(now);
 	return (z_);
 }
+
+void
+UwDriftPosition::setX(double x)
+{
+	Position::setX(x);
+	UwMobilityManager::instance().invalidate(this);
+}
+
+void
+UwDriftPosition::setY(double y)
+{
+	Position::setY(y);
+	UwMobilityManager::instance().invalidate(this);
+}
+
+void
+UwDriftPosition::setZ(double z)
+{
+	Position::setZ(z);
+	UwMobilityManager::instance().invalidate(this);
+}
@@ -139,6 +139,27 @@ protected:
 	 */
 	virtual double getZ();
 
+	/**
+	 * Sets the projection of the node on the x-axis.
+	 *
+	 * @param x New x-axis position value of the node
+	 */
+	virtual void setX(double x);
+
+	/**
+	 * Sets the projection of the node on the y-axis.
+	 *
+	 * @param y New y-axis position value of the node
+	 */
+	virtual void setY(double y);
+
+	/**
+	 * Sets the projection of the node on the z-axis.
+	 *
+	 * @param z New z-axis position value of the node
+	 */
+	virtual void setZ(double z);
+
 	/**
 	 * Returns a randomly <i>1</i> or <i>-</i>.
 	 * @return
@@ -38,6 +38,7 @@
  */
 
 #include "uwgmposition.h"
+#include "uwmobilitymanager.h"
 
 #include <cmath>
 #include <rng.h>
@@ -93,10 +94,12 @@ UwGMPosition::UwGMPosition()
 	bind("directionMean_", &directionMean_);
 	bind("pitchMean_", &pitchMean_);
 	bind("debug_", &debug_);
+	UwMobilityManager::instance().add(this);
 }
 
 UwGMPosition::~UwGMPosition()
 {
+	UwMobilityManager::instance().remove(this);
 }
 
 int
@@ -145,6 +148,13 @@ UwGMPosition::Gaussian()
 void
 UwGMPosition::update(double now)
 {
+	if (updateTime_ <= 0)
+		return;
+
+	// Constant terms of the Gauss Markov steps, computed once per catch-up
+	const double speedNoise = sqrt(1.0 - pow(alpha_, 2.0));
+	const double pitchNoise = sqrt(1.0 - pow(alphaPitch_, 2.0));
+
 	double t;
 	for (t = nextUpdateTime_; t < now; t += updateTime_) {
 		// calculate new sample of speed and direction
@@ -157,16 +167,16 @@ UwGMPosition::update(double now)
 					direction_,
 					pitch_);
 		speed_ = (alpha_ * speed_) + (((1.0 - alpha_)) * speedMean_) +
-				(sqrt(1.0 - pow(alpha_, 2.0)) * Gaussian());
+				(speedNoise * Gaussian());
 		direction_ = (alpha_ * direction_) +
-				(((1.0 - alpha_)) * directionMean_) +
-				(sqrt(1.0 - pow(alpha_, 2.0)) * Gaussian());
+				(((1.0 - alpha_)) * directionMean_) + (speedNoise * Gaussian());
 		pitch_ = (alphaPitch_ * pitch_) + (((1.0 - alphaPitch_)) * pitchMean_) +
-				(sqrt(1.0 - pow(alphaPitch_, 2.0)) * Gaussian());
+				(pitchNoise * Gaussian());
 
 		// calculate velocity
-		vx = speed_ * cos(direction_) * cos(pitch_);
-		vy = speed_ * sin(direction_) * cos(pitch_);
+		double cosPitch = cos(pitch_);
+		vx = speed_ * cos(direction_) * cosPitch;
+		vy = speed_ * sin(direction_) * cosPitch;
 		vz = speed_ * sin(pitch_);
 		// calculate new position
 		double newx = x_ + (vx * updateTime_);
@@ -318,3 +328,24 @@ UwGMPosition::getZ()
 		update(now);
 	return (z_);
 }
+
+void
+UwGMPosition::setX(double x)
+{
+	Position::setX(x);
+	UwMobilityManager::instance().invalidate(this);
+}
+
+void
+UwGMPosition::setY(double y)
+{
+	Position::setY(y);
+	UwMobilityManager::instance().invalidate(this);
+}
+
+void
+UwGMPosition::setZ(double z)
+{
+	Position::setZ(z);
+	UwMobilityManager::instance().invalidate(this);
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwmobilitymanager.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwMobilityManager class.
+ *
+ */
+
+#include "uwmobilitymanager.h"
+
+#include <node-core.h>
+#include <scheduler.h>
+
+UwMobilityManager &
+UwMobilityManager::instance()
+{
+	// Never destroyed: models may unregister during the exit of the process
+	static UwMobilityManager *manager = new UwMobilityManager();
+	return *manager;
+}
+
+UwMobilityManager::UwMobilityManager()
+	: positions_()
+	, index_()
+	, x_()
+	, y_()
+	, z_()
+	, time_()
+{
+}
+
+void
+UwMobilityManager::add(Position *p)
+{
+	if (index_.find(p) != index_.end())
+		return;
+
+	index_[p] = positions_.size();
+	positions_.push_back(p);
+	x_.push_back(0);
+	y_.push_back(0);
+	z_.push_back(0);
+	time_.push_back(-1);
+}
+
+void
+UwMobilityManager::remove(Position *p)
+{
+	std::map<const Position *, int>::iterator it = index_.find(p);
+	if (it == index_.end())
+		return;
+
+	// Move the last model in the slot of the removed one
+	int i = it->second;
+	int last = positions_.size() - 1;
+	if (i != last) {
+		positions_[i] = positions_[last];
+		index_[positions_[i]] = i;
+		x_[i] = x_[last];
+		y_[i] = y_[last];
+		z_[i] = z_[last];
+		time_[i] = time_[last];
+	}
+	index_.erase(it);
+	positions_.pop_back();
+	x_.pop_back();
+	y_.pop_back();
+	z_.pop_back();
+	time_.pop_back();
+}
+
+void
+UwMobilityManager::invalidate(const Position *p)
+{
+	int i = getIndex(p);
+	if (i >= 0)
+		time_[i] = -1;
+}
+
+int
+UwMobilityManager::getIndex(const Position *p) const
+{
+	std::map<const Position *, int>::const_iterator it = index_.find(p);
+	return (it == index_.end() ? -1 : it->second);
+}
+
+bool
+UwMobilityManager::getPosition(
+		const Position *p, double &x, double &y, double &z)
+{
+	int i = getIndex(p);
+	if (i < 0)
+		return false;
+
+	double now = Scheduler::instance().clock();
+	if (time_[i] != now) {
+		x_[i] = positions_[i]->getX();
+		y_[i] = positions_[i]->getY();
+		z_[i] = positions_[i]->getZ();
+		time_[i] = now;
+	}
+	x = x_[i];
+	y = y_[i];
+	z = z_[i];
+	return true;
+}
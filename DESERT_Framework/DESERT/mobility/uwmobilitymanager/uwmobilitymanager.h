@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwmobilitymanager.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwMobilityManager class, a cache of the positions of
+ * the DESERT mobility models at the current simulation time.
+ *
+ */
+
+#ifndef UWMOBILITYMANAGER_H
+#define UWMOBILITYMANAGER_H
+
+#include <map>
+#include <vector>
+
+class Position;
+
+/**
+ * Process-wide registry of the DESERT mobility models. The models register
+ * themselves when they are created. The coordinates of a model are read at
+ * most once per simulation time and kept in contiguous arrays (one per
+ * axis), so that modules that need the position of many nodes, e.g.,
+ * channels, read them without calling the model again. Only the models
+ * that are read are advanced, in the order they are read, so the random
+ * stream of the simulation does not change.
+ */
+class UwMobilityManager
+{
+public:
+	/**
+	 * @return the manager shared by all the modules of the process
+	 */
+	static UwMobilityManager &instance();
+
+	/**
+	 * Registers a mobility model. The model has to call invalidate() when
+	 * its coordinates are set.
+	 *
+	 * @param p Position to register
+	 */
+	void add(Position *p);
+
+	/**
+	 * Unregisters a mobility model.
+	 *
+	 * @param p Position to unregister
+	 */
+	void remove(Position *p);
+
+	/**
+	 * Discards the cached coordinates of a model, e.g., when it is moved
+	 * from Tcl.
+	 *
+	 * @param p Position moved
+	 */
+	void invalidate(const Position *p);
+
+	/**
+	 * @return number of registered models
+	 */
+	inline int
+	size() const
+	{
+		return positions_.size();
+	}
+
+	/**
+	 * @param p Position to search for
+	 * @return index of p in the cache, -1 if it is not registered
+	 */
+	int getIndex(const Position *p) const;
+
+	/**
+	 * Reads the coordinates of a position from the cache, reading them from
+	 * the model if they are older than the current simulation time.
+	 *
+	 * @param p Position to read
+	 * @param x Set to the x coordinate
+	 * @param y Set to the y coordinate
+	 * @param z Set to the z coordinate
+	 * @return <i>true</i> if p is registered, <i>false</i> otherwise
+	 */
+	bool getPosition(const Position *p, double &x, double &y, double &z);
+
+private:
+	/**
+	 * Constructor of UwMobilityManager class, use instance().
+	 */
+	UwMobilityManager();
+
+	std::vector<Position *> positions_; /**< Registered models. */
+	std::map<const Position *, int> index_; /**< Index of each model. */
+	std::vector<double> x_; /**< Cached x coordinates. */
+	std::vector<double> y_; /**< Cached y coordinates. */
+	std::vector<double> z_; /**< Cached z coordinates. */
+	std::vector<double> time_; /**< Time of the cached coordinates, -1 if
+								  not valid. */
+};
+
+#endif // UWMOBILITYMANAGER_H
@@ -38,6 +38,7 @@
  */
 
 #include "uwsmposition.h"
+#include "uwmobilitymanager.h"
 #include <iostream>
 
 #ifndef _USE_MATH_DEFINES
@@ -78,6 +79,12 @@ UWSMPosition::UWSMPosition()
 	, speed_(0)
 {
 	bind("debug_", &debug_);
+	UwMobilityManager::instance().add(this);
+}
+
+UWSMPosition::~UWSMPosition()
+{
+	UwMobilityManager::instance().remove(this);
 }
 
 int
@@ -136,6 +143,7 @@ UWSMPosition::setdest(double x_dest, double y_dest, double z_dest, double speed)
 	Xsorg_ = x_;
 	Ysorg_ = y_;
 	Zsorg_ = z_;
+	UwMobilityManager::instance().invalidate(this);
 
 	if (debug_)
 		printf("UWSMPosition::setdest pos (%f,%f,%f), dest(%f,%f,%f), "
@@ -170,6 +178,7 @@ UWSMPosition::setdest(double x_dest, double y_dest, double z_dest)
 	Xsorg_ = x_;
 	Ysorg_ = y_;
 	Zsorg_ = z_;
+	UwMobilityManager::instance().invalidate(this);
 
 	if (debug_)
 		printf("UWSMPosition::setdest pos (%f,%f,%f), dest(%f,%f,%f), "
@@ -274,6 +283,7 @@ UWSMPosition::setX(double x)
 	x_ = x;
 	Xdest_ = x;
 	Xsorg_ = x;
+	UwMobilityManager::instance().invalidate(this);
 }
 void
 UWSMPosition::setY(double y)
@@ -281,6 +291,7 @@ UWSMPosition::setY(double y)
 	y_ = y;
 	Ydest_ = y;
 	Ysorg_ = y;
+	UwMobilityManager::instance().invalidate(this);
 }
 void
 UWSMPosition::setZ(double z)
@@ -288,6 +299,7 @@ UWSMPosition::setZ(double z)
 	z_ = z;
 	Zdest_ = z;
 	Zsorg_ = z;
+	UwMobilityManager::instance().invalidate(this);
 }
 
 double
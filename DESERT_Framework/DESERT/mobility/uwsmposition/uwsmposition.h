@@ -61,7 +61,7 @@ public:
 	/**
 	 * UWSMPosition destructor
 	 */
-	virtual ~UWSMPosition() = default;
+	virtual ~UWSMPosition();
 
 	/**
 	 * Get the current projection on x-axis of the node postion
@@ -38,6 +38,7 @@
 
 #include "uwip-module.h"
 #include "uwip-clmsg.h"
+#include "uwlog.h"
 #include <packet.h>
 #include <sstream>
 
@@ -170,7 +171,7 @@ UWIPModule::recv(Packet *p)
 		}
 
 		if (ch->next_hop() == 0 && iph->daddr() != 0) {
-			printOnLog(Logger::LogLevel::ERROR,
+			UWLOG(Logger::LogLevel::ERROR,
 					"UWIP",
 					"recv(Packet *)::packet sent with next_hop equals to 0");
 
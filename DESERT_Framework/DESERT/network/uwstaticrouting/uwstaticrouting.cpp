@@ -38,6 +38,7 @@
  */
 
 #include "uwstaticrouting.h"
+#include "uwlog.h"
 #include <string>
 
 /**
@@ -136,7 +137,7 @@ UwStaticRoutingModule::recv(Packet *p)
 	hdr_cmn *ch = HDR_CMN(p);
 	hdr_uwip *uwiph = HDR_UWIP(p);
 
-	printOnLog(Logger::LogLevel::DEBUG,
+	UWLOG(Logger::LogLevel::DEBUG,
 			"UWSTATICROUTING",
 			"recv(Packet *)::next hop " + to_string(ch->next_hop()) +
 					" destination ip = " + to_string((uint) uwiph->daddr()));
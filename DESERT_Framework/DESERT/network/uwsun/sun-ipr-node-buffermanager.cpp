@@ -62,35 +62,18 @@ SunIPRoutingNode::bufferManager()
 	double delay_tx_ = this->getDelay(period_data_);
 	if (buffer_data.size() >= 1) { // There is at least 1 pkt in the buffer.
 
-		buffer_element _tmp =
-				buffer_data
-						.front(); // Pointer to the first element in the buffer.
+		// The first element in the buffer, updated in place.
+		buffer_element &_tmp = buffer_data.front();
 
 		// If the first pkt is valid.
 		if (_tmp.retx_ <= max_retx_ && _tmp.num_attempts_ < max_ack_error_) {
-			Packet *p = _tmp.p_->copy();
+			Packet *p = _tmp.p_;
 
 			hdr_cmn *ch = HDR_CMN(p);
 			hdr_uwip *iph = HDR_UWIP(p);
 			hdr_sun_data *hdata = HDR_SUN_DATA(p);
 			hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 
-			//            cout << printIP(ipAddr_) << ":hc:" <<
-			//            this->getNumberOfHopToSink() << ":destination:" <<
-			//            printIP(iph->daddr()) << ":source:" <<
-			//            printIP(iph->saddr()) << endl;
-			//            cout << "--->";
-			//            for (int i = 0; i < hdata->list_of_hops_length(); i++)
-			//            {
-			//                cout << printIP(hdata->list_of_hops()[i]) << "-";
-			//            }
-			//            cout << endl;
-			//            cout << "---#";
-			//            for (int i = 0; i < hop_table_length; i++) {
-			//                cout << printIP(hop_table[i]) << "-";
-			//            }
-			//            cout << endl;
-
 			if (this->getNumberOfHopToSink() == 1) {
 
 				if (iph->daddr() == 0) { // The packet is not initialized.
@@ -100,10 +83,6 @@ SunIPRoutingNode::bufferManager()
 					ch->next_hop() = sink_associated;
 					ch->prev_hop_ = ipAddr_;
 					iph->daddr() = sink_associated;
-					_tmp.p_ = p->copy();
-					Packet::free(((buffer_element) buffer_data.front()).p_);
-					buffer_data.erase(buffer_data.begin());
-					buffer_data.insert(buffer_data.begin(), _tmp);
 					number_of_datapkt_++;
 					data_and_hops[0]++; // The node is directly connected to the
 										// sink, the hop count is 1; In the
@@ -113,27 +92,23 @@ SunIPRoutingNode::bufferManager()
 										// because the buffer can be full.
 					pkt_tx_++;
 					if (trace_)
-						this->tracePacket(_tmp.p_, "SEND_DTA");
-					sendDown(_tmp.p_->copy(), delay_tx_);
+						this->tracePacket(p, "SEND_DTA");
+					sendDown(this->copyBufferedPacket(p), delay_tx_);
 				} else { // The packet was previously initialized.
 					_tmp.retx_++;
+					pkt_retx_++;
 					_tmp.t_last_tx_ = Scheduler::instance().clock();
 					ch->next_hop() = sink_associated;
 					ch->prev_hop_ = ipAddr_;
 					iph->daddr() = sink_associated;
-					_tmp.p_ = p->copy();
-					Packet::free(((buffer_element) buffer_data.front())
-									.p_); // FF: to fix a mem leak
-					buffer_data.erase(buffer_data.begin());
-					buffer_data.insert(buffer_data.begin(), _tmp);
 					if (iph->saddr() != ipAddr_) {
 						number_of_pkt_forwarded_++;
 					}
 					number_of_datapkt_++;
 					pkt_tx_++;
 					if (trace_)
-						this->tracePacket(_tmp.p_, "SEND_DTA");
-					sendDown(_tmp.p_->copy(), delay_tx_);
+						this->tracePacket(p, "SEND_DTA");
+					sendDown(this->copyBufferedPacket(p), delay_tx_);
 				}
 				if (printDebug_ > 5) {
 					std::cout << "[" << NOW
@@ -162,10 +137,6 @@ SunIPRoutingNode::bufferManager()
 					ch->prev_hop_ = ipAddr_;
 					_tmp.num_attempts_++;
 					_tmp.t_last_tx_ = Scheduler::instance().clock();
-					_tmp.p_ = p->copy();
-					Packet::free(((buffer_element) buffer_data.front()).p_);
-					buffer_data.erase(buffer_data.begin());
-					buffer_data.insert(buffer_data.begin(), _tmp);
 				} else {
 					if (iph->saddr() == ipAddr_) { // The current node created a
 												   // packet but now it doesn't
@@ -174,19 +145,11 @@ SunIPRoutingNode::bufferManager()
 						iph->daddr() = 0;
 						_tmp.num_attempts_++;
 						_tmp.t_last_tx_ = Scheduler::instance().clock();
-						_tmp.p_ = p->copy();
-						Packet::free(((buffer_element) buffer_data.front()).p_);
-						buffer_data.erase(buffer_data.begin());
-						buffer_data.insert(buffer_data.begin(), _tmp);
 						pkt_tx_++;
 					} else { // Otherwise forward.
 						_tmp.num_attempts_++;
 						_tmp.t_last_tx_ = Scheduler::instance().clock();
-						_tmp.p_ = p->copy();
-						Packet::free(((buffer_element) buffer_data.front()).p_);
-						buffer_data.erase(buffer_data.begin());
-						buffer_data.insert(buffer_data.begin(), _tmp);
-						this->forwardDataPacket(_tmp.p_->copy());
+						this->forwardDataPacket(this->copyBufferedPacket(p));
 					}
 				}
 				if (printDebug_ > 5) {
@@ -201,48 +164,32 @@ SunIPRoutingNode::bufferManager()
 			if (this->getNumberOfHopToSink() > 1) {
 
 				if (iph->daddr() == 0) { // The packet is not initialized.
-					//                    cout << "node:" << printIP(ipAddr_) <<
-					//                    "-bufsize:" << buffer_data.size() <<
-					//                    "-hop:" <<
-					//                    this->getNumberOfHopToSink() <<
-					//                    "-init." << endl;
 					this->initPktDataPacket(p);
 					ch->next_hop() = this->hop_table[0];
 					ch->prev_hop_ = ipAddr_;
 					iph->daddr() = sink_associated;
 					number_of_datapkt_++;
 					_tmp.retx_++;
+					pkt_retx_++;
 					_tmp.t_last_tx_ = Scheduler::instance().clock();
-					_tmp.p_ = p->copy();
-					Packet::free(((buffer_element) buffer_data.front()).p_);
-					buffer_data.erase(buffer_data.begin());
-					buffer_data.insert(buffer_data.begin(), _tmp);
 					data_and_hops[int(hdata->list_of_hops_length())]++;
 					pkt_tx_++;
 					if (trace_)
-						this->tracePacket(_tmp.p_, "SEND_DTA");
-					sendDown(_tmp.p_->copy(), delay_tx_);
+						this->tracePacket(p, "SEND_DTA");
+					sendDown(this->copyBufferedPacket(p), delay_tx_);
 				} else {
-					//                    cout << "node:" << printIP(ipAddr_) <<
-					//                    "-bufsize:" << buffer_data.size() <<
-					//                    "-hop:" <<
-					//                    this->getNumberOfHopToSink() <<
-					//                    "-send." << endl;
 					ch->prev_hop_ = ipAddr_;
 					_tmp.retx_++;
+					pkt_retx_++;
 					_tmp.t_last_tx_ = Scheduler::instance().clock();
-					_tmp.p_ = p->copy();
-					Packet::free(((buffer_element) buffer_data.front()).p_);
-					buffer_data.erase(buffer_data.begin());
-					buffer_data.insert(buffer_data.begin(), _tmp);
 					if (iph->saddr() == ipAddr_) { // Send.
 						number_of_datapkt_++;
 						pkt_tx_++;
 						if (trace_)
-							this->tracePacket(_tmp.p_, "SEND_DTA");
-						sendDown(_tmp.p_->copy(), delay_tx_);
+							this->tracePacket(p, "SEND_DTA");
+						sendDown(this->copyBufferedPacket(p), delay_tx_);
 					} else { // Otherwise forward.
-						this->forwardDataPacket(_tmp.p_->copy());
+						this->forwardDataPacket(this->copyBufferedPacket(p));
 					}
 				}
 				if (printDebug_ > 5) {
@@ -259,12 +206,13 @@ SunIPRoutingNode::bufferManager()
 					std::cout << std::endl;
 				}
 			}
-			Packet::free(p);
 		} else { // The first packet in the buffer is invalid.
-			Packet *p = _tmp.p_->copy();
+			Packet *p = _tmp.p_;
 			hdr_cmn *ch = HDR_CMN(p);
 			hdr_uwip *iph = HDR_UWIP(p);
 			hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
+			int uid = ch->uid();
+			int sn = uwcbrh->sn();
 
 			if (iph->saddr() == ipAddr_) { // Current node creates the packet
 										   // that generated an error: remove
@@ -293,30 +241,38 @@ SunIPRoutingNode::bufferManager()
 					}
 					if (trace_)
 						this->tracePacket(p_error, "SEND_ERR");
-					sendDown(p_error->copy());
-					Packet::free(p_error);
+					sendDown(p_error);
 				}
 			}
 			number_of_drops_maxretx_++;
-			Packet::free(((buffer_element) buffer_data.front()).p_);
-			buffer_data.erase(buffer_data.begin()); // Remove the first pkt.
 			Packet::free(p);
+			buffer_data.pop_front(); // Remove the first pkt.
 			if (reset_buffer_if_error_) { // If == 1 all the packets in the
 										  // buffer will be removed.
 				while (!buffer_data.empty()) {
-					Packet::free(((buffer_element) buffer_data.front()).p_);
-					buffer_data.erase(buffer_data.begin());
+					Packet::free(buffer_data.front().p_);
+					buffer_data.pop_front();
 				}
 			}
 			if (printDebug_ > 5) {
 				std::cout << "[" << NOW
 						  << "]::Node[IP:" << this->printIP(ipAddr_)
 						  << "||hops:" << this->getNumberOfHopToSink()
-						  << "]::INVALID_PACKET::UID:" << ch->uid()
-						  << "::SN:" << uwcbrh->sn() << std::endl;
+						  << "]::INVALID_PACKET::UID:" << uid << "::SN:" << sn
+						  << std::endl;
 			}
 		}
 	}
 	bufferTmr_.resched(timer_buffer_ + delay_tx_);
 	return;
 }
+
+void
+SunIPRoutingNode::bufferPacket(Packet *p, int id_pkt)
+{
+	pkt_stored_++;
+	buffer_data.push_back(
+			buffer_element(p, id_pkt, Scheduler::instance().clock()));
+	if (buffer_data.size() > buffer_max_occupancy_)
+		buffer_max_occupancy_ = buffer_data.size();
+}
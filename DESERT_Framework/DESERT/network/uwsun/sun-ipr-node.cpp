@@ -113,6 +113,11 @@ SunIPRoutingNode::SunIPRoutingNode()
 	, ack_warnings_counter_(0)
 	, ack_error_state(false)
 	, buffer_max_size_(1)
+	, pkt_stored_(0)
+	, pkt_tx_(0)
+	, buffer_max_occupancy_(0)
+	, pkt_copies_(0)
+	, pkt_retx_(0)
 	, safe_timer_buffer_(0)
 	, timer_route_validity_(5)
 	, timer_sink_probe_validity_(200)
@@ -122,6 +127,9 @@ SunIPRoutingNode::SunIPRoutingNode()
 	, sinkProbeTimer_(this)
 	, bufferTmr_(this)
 	, searchPathTmr_(this)
+	, trace_(false)
+	, trace_writer_(NULL)
+	, trace_format_(SunTraceWriter::TRACE_TEXT)
 	, paths_selected()
 	, n_paths_established(0)
 	, max_retx_(1)
@@ -336,6 +344,9 @@ SunIPRoutingNode::command(int argc, const char *const *argv)
 		if (strcasecmp(argv[1], "initialize") == 0) {
 			this->initialize();
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "flushtrace") == 0) {
+			SunTraceWriter::flushAll();
+			return TCL_OK;
 		} else if (strcasecmp(argv[1], "clearhops") == 0) {
 			this->clearHops();
 			return TCL_OK;
@@ -412,6 +423,15 @@ SunIPRoutingNode::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "gettransmittedpackets") == 0) {
 			tcl.resultf("%d", pkt_tx_);
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getbuffermaxoccupancy") == 0) {
+			tcl.resultf("%lu", buffer_max_occupancy_);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getbufferpktcopies") == 0) {
+			tcl.resultf("%lu", pkt_copies_);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getbufferretx") == 0) {
+			tcl.resultf("%lu", pkt_retx_);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "getstats") == 0) {
@@ -438,9 +458,24 @@ SunIPRoutingNode::command(int argc, const char *const *argv)
 				return TCL_ERROR;
 			}
 			trace_ = true;
-			remove(trace_file_name_);
-			trace_file_.open(trace_file_name_);
-			trace_file_.close();
+			trace_writer_ =
+					SunTraceWriter::getWriter(trace_file_name_, trace_format_);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "traceformat") == 0) {
+			if (strcasecmp(argv[2], "text") == 0) {
+				trace_format_ = SunTraceWriter::TRACE_TEXT;
+			} else if (strcasecmp(argv[2], "binary") == 0) {
+				trace_format_ = SunTraceWriter::TRACE_BINARY;
+			} else {
+				fprintf(stderr, "Trace format must be text or binary\n");
+				return TCL_ERROR;
+			}
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "tracebuffersize") == 0) {
+			SunTraceWriter::setBufferSize(atoi(argv[2]));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "traceflushperiod") == 0) {
+			SunTraceWriter::setFlushPeriod(atof(argv[2]));
 			return TCL_OK;
 		}
 	}
@@ -566,11 +601,8 @@ SunIPRoutingNode::recv(Packet *p)
 								this->sendRouteErrorBack(p->copy());
 								if (reset_buffer_if_error_) {
 									while (!buffer_data.empty()) {
-										Packet::free((
-												(buffer_element)
-														buffer_data.front())
-														.p_);
-										buffer_data.erase(buffer_data.begin());
+										Packet::free(buffer_data.front().p_);
+										buffer_data.pop_front();
 										Packet::free(p);
 										return;
 									}
@@ -601,10 +633,12 @@ SunIPRoutingNode::recv(Packet *p)
 						if (trace_)
 							this->tracePacket(p, "RECV_ACK");
 						this->updateAcksCount();
-						buffer_element _tmp = buffer_data.front();
-						if (hack->uid() == _tmp.id_pkt_) { // Ack for the first
-														   // packet in the
-														   // buffer.
+						if (!buffer_data.empty() &&
+								hack->uid() ==
+										buffer_data.front()
+												.id_pkt_) { // Ack for the first
+															// packet in the
+															// buffer.
 							ack_warnings_counter_ = 0;
 							ack_error_state = false;
 							if (buffer_data.size() > 0) { // There is at least
@@ -636,12 +670,9 @@ SunIPRoutingNode::recv(Packet *p)
 											<< "::PACKET_REMOVED:" << ch->uid()
 											<< std::endl;
 								}
-								Packet::free(
-										((buffer_element) buffer_data.front())
-												.p_);
-								buffer_data.erase(
-										buffer_data.begin()); // Remove the
-															  // first packet.
+								Packet::free(buffer_data.front().p_);
+								buffer_data.pop_front(); // Remove the first
+														 // packet.
 							}
 						} else {
 							;
@@ -728,11 +759,7 @@ SunIPRoutingNode::recv(Packet *p)
 							//                                = false;
 							//                                searchPathTmr_.resched(timer_search_path_);
 							//                            }
-							pkt_stored_++;
-							buffer_data.push_back(buffer_element(p->copy(),
-									uwcbrh->sn(),
-									Scheduler::instance().clock()));
-							Packet::free(p);
+							this->bufferPacket(p, uwcbrh->sn());
 						} else {
 							if (printDebug_ > 5) {
 								std::cout << "[" << NOW << "]::Node[IP:"
@@ -774,11 +801,7 @@ SunIPRoutingNode::recv(Packet *p)
 								  << "]::TO_SEND::PACKET_BUFFERED"
 								  << "::UID:" << ch->uid()
 								  << "::SN::" << uwcbrh->sn() << std::endl;
-					pkt_stored_++;
-					buffer_data.push_back(buffer_element(p->copy(),
-							uwcbrh->sn(),
-							Scheduler::instance().clock()));
-					Packet::free(p);
+					this->bufferPacket(p, uwcbrh->sn());
 				} else {
 					if (printDebug_ > 5)
 						std::cout << "[" << NOW
@@ -803,11 +826,7 @@ SunIPRoutingNode::recv(Packet *p)
 								  << "]::TO_SEND::PACKET_BUFFERED"
 								  << "::UID:" << ch->uid()
 								  << "::SN::" << uwcbrh->sn() << std::endl;
-					pkt_stored_++;
-					buffer_data.push_back(buffer_element(p->copy(),
-							uwcbrh->sn(),
-							Scheduler::instance().clock()));
-					Packet::free(p);
+					this->bufferPacket(p, uwcbrh->sn());
 				} else {
 					if (printDebug_ > 5)
 						std::cout << "[" << NOW
@@ -971,72 +990,26 @@ SunIPRoutingNode::tracePacket(const Packet *const p, const string &position)
 	hdr_sun_ack *hack = HDR_SUN_ACK(p);
 	hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 	if (trace_) {
-		double snr_ = 0;
+		SunTraceRecord record;
+		record.event = position.c_str();
+		record.time = Scheduler::instance().clock();
+		record.node = ipAddr_;
+		record.pkt_id = ch->uid();
+		if (ch->ptype() == PT_SUN_ACK)
+			record.pkt_sn = hack->uid();
+		else
+			record.pkt_sn = uwcbrh->sn();
+		record.from = ch->prev_hop_;
+		record.next_hop = ch->next_hop();
+		record.source = iph->saddr();
+		record.destination = iph->daddr();
 		if (ph->Pn == 0) { // TODO: trick for CMRE logs
-			snr_ = -999;
-		} else {
-			snr_ = 10 * log10(ph->Pr / ph->Pn);
-		}
-		if (ch->ptype() == PT_SUN_ACK) {
-			this->writeInTrace(this->createTraceString(position,
-					Scheduler::instance().clock(),
-					ipAddr_,
-					ch->uid(),
-					hack->uid(),
-					ch->prev_hop_,
-					ch->next_hop(),
-					iph->saddr(),
-					iph->daddr(),
-					snr_,
-					ch->direction(),
-					ch->ptype()));
+			record.snr = -999;
 		} else {
-			this->writeInTrace(this->createTraceString(position,
-					Scheduler::instance().clock(),
-					ipAddr_,
-					ch->uid(),
-					uwcbrh->sn(),
-					ch->prev_hop_,
-					ch->next_hop(),
-					iph->saddr(),
-					iph->daddr(),
-					snr_,
-					ch->direction(),
-					ch->ptype()));
+			record.snr = 10 * log10(ph->Pr / ph->Pn);
 		}
+		record.direction = ch->direction();
+		record.ptype = ch->ptype();
+		trace_writer_->writeRecord(record, trace_separator_);
 	}
 } /* SunIPRoutingNode::tracePacket */
-
-string
-SunIPRoutingNode::createTraceString(const string &info_string,
-		const double &simulation_time_, const int &node_id_, const int &pkt_id_,
-		const int &pkt_sn_, const int &pkt_from_, const int &pkt_next_hop,
-		const int &pkt_source_, const int &pkt_destination_, const double &snr_,
-		const int &direction_, const int &pkt_type)
-{
-	if (STACK_TRACE)
-		std::cout << "> createTraceString()" << std::endl;
-	osstream_.clear();
-	osstream_.str("");
-	osstream_ << info_string << this->trace_separator_ << simulation_time_
-			  << this->trace_separator_ << (node_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_sn_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_from_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_next_hop & 0x000000ff)
-			  << this->trace_separator_ << (pkt_source_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_destination_ & 0x000000ff)
-			  << this->trace_separator_ << snr_ << this->trace_separator_
-			  << direction_ << this->trace_separator_ << pkt_type;
-	return osstream_.str();
-} /* SunIPRoutingNode::createTraceString */
-
-void
-SunIPRoutingNode::writeInTrace(const string &string_to_write_)
-{
-	if (STACK_TRACE)
-		std::cout << "> writeInTrace()" << std::endl;
-	trace_file_.open(trace_file_name_, fstream::app);
-	trace_file_ << string_to_write_ << endl;
-	trace_file_.close();
-} /* SunIPRoutingNode::writeInTrace */
@@ -45,6 +45,7 @@
 #include "sun-hdr-data.h"
 #include "sun-hdr-pathestablishment.h"
 #include "sun-ipr-common-structures.h"
+#include "sun-trace-writer.h"
 
 #include <uwcbr-module.h>
 #include <uwip-clmsg.h>
@@ -57,6 +58,7 @@
 
 #include <cmath>
 #include <ctime>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <limits>
@@ -660,6 +662,28 @@ protected:
 	 */
 	virtual void bufferManager();
 
+	/**
+	 * Appends a data packet to the buffer. The buffer takes the ownership of
+	 * the packet.
+	 *
+	 * @param Packet to buffer.
+	 * @param ID of the packet, used to match the acks.
+	 */
+	virtual void bufferPacket(Packet *, int);
+
+	/**
+	 * Returns a copy of a buffered packet, to be sent down or forwarded.
+	 *
+	 * @param Packet of the buffer.
+	 * @return Copy of the packet.
+	 */
+	inline Packet *
+	copyBufferedPacket(const Packet *p)
+	{
+		pkt_copies_++;
+		return p->copy();
+	}
+
 	/*****************************
 	 |        Statistics         |
 	 *****************************/
@@ -807,22 +831,6 @@ protected:
 	virtual void tracePacket(
 			const Packet *const, const string &position = "UNDEF___");
 
-	/**
-	 * Function that accepts a list of string and create an entry for the trace
-	 * file.
-	 */
-	virtual string createTraceString(const string &, const double &,
-			const int &, const int &, const int &, const int &, const int &,
-			const int &, const int &, const double &, const int &, const int &);
-
-	/**
-	 * Opens the trace file, writes the string passed as input and closes the
-	 * file.
-	 *
-	 * @param String to write in the trace file.
-	 */
-	virtual void writeInTrace(const string &);
-
 	enum {
 		HOPCOUNT = 1,
 		SNR,
@@ -894,13 +902,20 @@ protected:
 						   */
 
 	// Buffer
-	vector<buffer_element>
-			buffer_data; /**< Buffer used to store data packets. */
+	std::deque<buffer_element>
+			buffer_data; /**< Buffer used to store data packets. The packets
+							are owned by the buffer and updated in place. */
 	uint32_t buffer_max_size_; /**< Maximum length of the data buffer. */
 	long pkt_stored_; /**< Keep track of the total number of packet
 						 transmitted. */
 	long pkt_tx_; /**< Keep track of the total number of packet retransmitted.
 				   */
+	unsigned long buffer_max_occupancy_; /**< Maximum number of packets
+											stored in the buffer. */
+	unsigned long pkt_copies_; /**< Number of copies of buffered packets
+								  sent down or forwarded. */
+	unsigned long pkt_retx_; /**< Number of increments of the retransmission
+								counters of the buffered packets. */
 	int safe_timer_buffer_; /**< Enables a mechanism used to modify the
 							   <i>timer_buffer_</i> in case of the sending
 							   time is shorter than the time needed to
@@ -924,9 +939,9 @@ protected:
 				  */
 	char *trace_file_name_; /**< Name of the trace file writter for the
 							   current node. */
-	ostringstream osstream_; /**< Used to convert to string. */
-	ofstream trace_file_; /**< Ofstream used to write the trace file in the
-							 disk. */
+	SunTraceWriter *trace_writer_; /**< Shared writer of the trace file. */
+	SunTraceWriter::TraceFormat trace_format_; /**< Format of the trace file,
+												  set with traceformat. */
 	char trace_separator_; /**< Used as separator among elements in an entr of
 							  the tracefile. */
 
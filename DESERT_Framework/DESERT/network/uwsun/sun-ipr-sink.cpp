@@ -79,6 +79,9 @@ SunIPRoutingSink::SunIPRoutingSink()
 	, sendTmr_(this)
 	, trace_(false)
 	, trace_path_(false)
+	, trace_writer_(NULL)
+	, trace_format_(SunTraceWriter::TRACE_TEXT)
+	, trace_path_writer_(NULL)
 { // Binding to TCL variables.
 	if (STACK_TRACE)
 		std::cout << "> SunIPRoutingSink()" << std::endl;
@@ -129,6 +132,9 @@ SunIPRoutingSink::command(int argc, const char *const *argv)
 		if (strcasecmp(argv[1], "initialize") == 0) {
 			this->initialize();
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "flushtrace") == 0) {
+			SunTraceWriter::flushAll();
+			return TCL_OK;
 		} else if (strcasecmp(argv[1], "start") == 0) { // TCL command to start
 														// the packet generation
 														// and transmission.
@@ -183,9 +189,24 @@ SunIPRoutingSink::command(int argc, const char *const *argv)
 				return TCL_ERROR;
 			}
 			trace_ = true;
-			remove(trace_file_name_);
-			trace_file_.open(trace_file_name_);
-			trace_file_.close();
+			trace_writer_ =
+					SunTraceWriter::getWriter(trace_file_name_, trace_format_);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "traceformat") == 0) {
+			if (strcasecmp(argv[2], "text") == 0) {
+				trace_format_ = SunTraceWriter::TRACE_TEXT;
+			} else if (strcasecmp(argv[2], "binary") == 0) {
+				trace_format_ = SunTraceWriter::TRACE_BINARY;
+			} else {
+				fprintf(stderr, "Trace format must be text or binary\n");
+				return TCL_ERROR;
+			}
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "tracebuffersize") == 0) {
+			SunTraceWriter::setBufferSize(atoi(argv[2]));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "traceflushperiod") == 0) {
+			SunTraceWriter::setFlushPeriod(atof(argv[2]));
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "tracepaths") == 0) {
 			string tmp_ = ((char *) argv[2]);
@@ -196,9 +217,8 @@ SunIPRoutingSink::command(int argc, const char *const *argv)
 				return TCL_ERROR;
 			}
 			trace_path_ = true;
-			remove(trace_file_path_name_);
-			trace_file_path_.open(trace_file_path_name_);
-			trace_file_path_.close();
+			trace_path_writer_ =
+					SunTraceWriter::getWriter(trace_file_path_name_);
 			return TCL_OK;
 		}
 	} else if (argc == 4) {
@@ -498,77 +518,30 @@ SunIPRoutingSink::tracePacket(const Packet *const p, const string &position)
 	hdr_sun_ack *hack = HDR_SUN_ACK(p);
 	hdr_uwcbr *uwcbrh = HDR_UWCBR(p);
 	if (trace_) {
-		double snr_ = 0;
+		SunTraceRecord record;
+		record.event = position.c_str();
+		record.time = Scheduler::instance().clock();
+		record.node = ipAddr_;
+		record.pkt_id = ch->uid();
+		if (ch->ptype() == PT_SUN_ACK)
+			record.pkt_sn = hack->uid();
+		else
+			record.pkt_sn = uwcbrh->sn();
+		record.from = ch->prev_hop_;
+		record.next_hop = ch->next_hop();
+		record.source = iph->saddr();
+		record.destination = iph->daddr();
 		if (ph->Pn == 0) { // TODO: trick for CMRE logs
-			snr_ = -999;
+			record.snr = -999;
 		} else {
-			snr_ = 10 * log10(ph->Pr / ph->Pn);
-		}
-		if (ch->ptype() == PT_SUN_ACK) {
-			this->writeInTrace(this->createTraceString(position,
-					Scheduler::instance().clock(),
-					ipAddr_,
-					ch->uid(),
-					hack->uid(),
-					ch->prev_hop_,
-					ch->next_hop(),
-					iph->saddr(),
-					iph->daddr(),
-					snr_,
-					ch->direction(),
-					ch->ptype()));
-		} else {
-			this->writeInTrace(this->createTraceString(position,
-					Scheduler::instance().clock(),
-					ipAddr_,
-					ch->uid(),
-					uwcbrh->sn(),
-					ch->prev_hop_,
-					ch->next_hop(),
-					iph->saddr(),
-					iph->daddr(),
-					snr_,
-					ch->direction(),
-					ch->ptype()));
+			record.snr = 10 * log10(ph->Pr / ph->Pn);
 		}
+		record.direction = ch->direction();
+		record.ptype = ch->ptype();
+		trace_writer_->writeRecord(record, trace_separator_);
 	}
 } /* SunIPRoutingSink::tracePacket */
 
-string
-SunIPRoutingSink::createTraceString(const string &info_string,
-		const double &simulation_time_, const int &node_id_, const int &pkt_id_,
-		const int &pkt_sn_, const int &pkt_from_, const int &pkt_next_hop,
-		const int &pkt_source_, const int &pkt_destination_, const double &snr_,
-		const int &direction_, const int &pkt_type)
-{
-	if (STACK_TRACE)
-		std::cout << "> createTraceString()" << std::endl;
-	osstream_.clear();
-	osstream_.str("");
-	osstream_ << info_string << this->trace_separator_ << simulation_time_
-			  << this->trace_separator_ << (node_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_sn_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_from_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_next_hop & 0x000000ff)
-			  << this->trace_separator_ << (pkt_source_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_destination_ & 0x000000ff)
-			  << this->trace_separator_ << snr_ << this->trace_separator_
-			  << direction_ << this->trace_separator_ << pkt_type;
-	return osstream_.str();
-} /* SunIPRoutingSink::createTraceString */
-
-void
-SunIPRoutingSink::writeInTrace(const string &string_to_write_)
-{
-	if (STACK_TRACE)
-		std::cout << "> writeInTrace()" << std::endl;
-
-	trace_file_.open(trace_file_name_, fstream::app);
-	trace_file_ << string_to_write_ << endl;
-	trace_file_.close();
-} /* SunIPRoutingNode::writeInTrace */
-
 void
 SunIPRoutingSink::writePathInTrace(const Packet *p)
 {
@@ -579,7 +552,6 @@ SunIPRoutingSink::writePathInTrace(const Packet *p)
 	hdr_cmn *ch = HDR_CMN(p);
 	hdr_sun_data *hdata = HDR_SUN_DATA(p);
 
-	trace_file_path_.open(trace_file_path_name_, fstream::app);
 	osstream_.clear();
 	osstream_.str("");
 	osstream_ << Scheduler::instance().clock() << '\t' << ch->uid() << '\t'
@@ -589,6 +561,6 @@ SunIPRoutingSink::writePathInTrace(const Packet *p)
 		osstream_ << '\t' << this->printIP(hdata->list_of_hops()[i]);
 	}
 	osstream_ << '\t' << this->printIP(iph->daddr());
-	trace_file_path_ << osstream_.str() << endl;
-	trace_file_path_.close();
+	trace_path_writer_->writeLine(
+			osstream_.str(), Scheduler::instance().clock());
 } /*  SunIPRoutingSink::writePathInTrace */
@@ -46,6 +46,7 @@
 #include "sun-hdr-pathestablishment.h"
 #include "sun-hdr-probe.h"
 #include "sun-ipr-common-structures.h"
+#include "sun-trace-writer.h"
 
 #include <uwcbr-module.h>
 #include <uwip-clmsg.h>
@@ -320,22 +321,6 @@ protected:
 	virtual void tracePacket(
 			const Packet *const, const string &position = "UNDEF___");
 
-	/**
-	 * Function that accept a list of string and create an entry for the trace
-	 * file.
-	 */
-	virtual string createTraceString(const string &, const double &,
-			const int &, const int &, const int &, const int &, const int &,
-			const int &, const int &, const double &, const int &, const int &);
-
-	/**
-	 * Opens the trace file, writes the string passed as input and closes the
-	 * file.
-	 *
-	 * @param String to write in the trace file.
-	 */
-	virtual void writeInTrace(const string &);
-
 	/**
 	 * Writes in the Path Trace file the path contained in the Packet
 	 *
@@ -380,10 +365,11 @@ protected:
 									the list of paths of the data packets
 									received. */
 	ostringstream osstream_; /**< Used to convert to string. */
-	ofstream trace_file_; /**< Ofstream used to write the trace file in the
-							 disk. */
-	ofstream trace_file_path_; /**< Ofstream used to write the path trace file
-								  in the disk. */
+	SunTraceWriter *trace_writer_; /**< Shared writer of the trace file. */
+	SunTraceWriter::TraceFormat trace_format_; /**< Format of the trace file,
+												  set with traceformat. */
+	SunTraceWriter *trace_path_writer_; /**< Shared writer of the path trace
+										   file. */
 	char trace_separator_; /**< Used as separator among elements in an entr of
 							  the tracefile. */
 
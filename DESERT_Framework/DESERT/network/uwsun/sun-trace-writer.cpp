@@ -0,0 +1,201 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   sun-trace-writer.cpp
+ * @version 1.0.0
+ *
+ * \brief Implements a SunTraceWriter.
+ *
+ */
+
+#include "sun-trace-writer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+std::map<std::string, SunTraceWriter *> SunTraceWriter::writers_;
+size_t SunTraceWriter::buffer_size_ = SUN_TRACE_DEFAULT_BUFFER_SIZE;
+double SunTraceWriter::flush_period_ = 0;
+
+SunTraceWriter *
+SunTraceWriter::getWriter(const std::string &file_name, TraceFormat format)
+{
+	std::map<std::string, SunTraceWriter *>::iterator it =
+			writers_.find(file_name);
+	if (it != writers_.end()) {
+		if (it->second->format() != format)
+			fprintf(stderr,
+					"SunTraceWriter: %s already opened with another format\n",
+					file_name.c_str());
+		return it->second;
+	}
+
+	if (writers_.empty())
+		atexit(SunTraceWriter::flushAll);
+
+	SunTraceWriter *writer = new SunTraceWriter(file_name, format);
+	writers_[file_name] = writer;
+	return writer;
+}
+
+void
+SunTraceWriter::flushAll()
+{
+	for (std::map<std::string, SunTraceWriter *>::iterator it =
+					writers_.begin();
+			it != writers_.end();
+			++it)
+		it->second->flush();
+}
+
+void
+SunTraceWriter::setBufferSize(size_t bytes)
+{
+	buffer_size_ = bytes;
+}
+
+void
+SunTraceWriter::setFlushPeriod(double period)
+{
+	flush_period_ = period;
+}
+
+SunTraceWriter::SunTraceWriter(
+		const std::string &file_name, TraceFormat format)
+	: file_name_(file_name)
+	, format_(format)
+	, buffer_()
+	, last_flush_(0)
+{
+	remove(file_name_.c_str());
+	FILE *file = fopen(file_name_.c_str(), "w");
+	if (file)
+		fclose(file);
+	buffer_.reserve(buffer_size_);
+}
+
+void
+SunTraceWriter::writeLine(const std::string &line, double now)
+{
+	buffer_.append(line);
+	buffer_.push_back('\n');
+	checkFlush(now);
+}
+
+void
+SunTraceWriter::writeRecord(const SunTraceRecord &record, char separator)
+{
+	if (format_ == TRACE_TEXT) {
+		char fields[128];
+		int n = snprintf(fields,
+				sizeof(fields),
+				"%c%g%c%d%c%d%c%d%c%d%c%d%c%d%c%d%c%g%c%d%c%d\n",
+				separator,
+				record.time,
+				separator,
+				record.node & 0x000000ff,
+				separator,
+				record.pkt_id & 0x000000ff,
+				separator,
+				record.pkt_sn & 0x000000ff,
+				separator,
+				record.from & 0x000000ff,
+				separator,
+				record.next_hop & 0x000000ff,
+				separator,
+				record.source & 0x000000ff,
+				separator,
+				record.destination & 0x000000ff,
+				separator,
+				record.snr,
+				separator,
+				record.direction,
+				separator,
+				record.ptype);
+		buffer_.append(record.event);
+		buffer_.append(fields, n);
+	} else {
+		char bin[SUN_TRACE_RECORD_SIZE];
+		char *pos = bin;
+		float snr = (float) record.snr;
+		uint8_t ids[] = {(uint8_t) record.node,
+				(uint8_t) record.pkt_id,
+				(uint8_t) record.pkt_sn,
+				(uint8_t) record.from,
+				(uint8_t) record.next_hop,
+				(uint8_t) record.source,
+				(uint8_t) record.destination};
+		int8_t direction = (int8_t) record.direction;
+		int32_t ptype = (int32_t) record.ptype;
+
+		memcpy(pos, &record.time, sizeof(record.time));
+		pos += sizeof(record.time);
+		memcpy(pos, &snr, sizeof(snr));
+		pos += sizeof(snr);
+		memset(pos, '\0', SUN_TRACE_EVENT_LENGTH);
+		strncpy(pos, record.event, SUN_TRACE_EVENT_LENGTH);
+		pos += SUN_TRACE_EVENT_LENGTH;
+		memcpy(pos, ids, sizeof(ids));
+		pos += sizeof(ids);
+		memcpy(pos, &direction, sizeof(direction));
+		pos += sizeof(direction);
+		memcpy(pos, &ptype, sizeof(ptype));
+		buffer_.append(bin, SUN_TRACE_RECORD_SIZE);
+	}
+	checkFlush(record.time);
+}
+
+void
+SunTraceWriter::flush()
+{
+	if (buffer_.empty())
+		return;
+	FILE *file = fopen(file_name_.c_str(), "ab");
+	if (file) {
+		fwrite(buffer_.data(), 1, buffer_.size(), file);
+		fclose(file);
+	} else {
+		fprintf(stderr,
+				"SunTraceWriter: cannot open %s, trace entries lost\n",
+				file_name_.c_str());
+	}
+	buffer_.clear();
+}
+
+void
+SunTraceWriter::checkFlush(double now)
+{
+	if (buffer_.size() >= buffer_size_ ||
+			(flush_period_ > 0 && now - last_flush_ >= flush_period_)) {
+		flush();
+		last_flush_ = now;
+	}
+}
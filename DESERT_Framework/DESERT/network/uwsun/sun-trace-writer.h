@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   sun-trace-writer.h
+ * @version 1.0.0
+ *
+ * \brief Buffered trace files shared by the SUN nodes and sinks.
+ *
+ * All the SunIPRoutingNode and SunIPRoutingSink objects tracing to the same
+ * file append to the same SunTraceWriter, whose buffer is written to disk
+ * only when it is full, when the flush period elapses or at exit.
+ */
+
+#ifndef SUN_TRACE_WRITER_H
+#define SUN_TRACE_WRITER_H
+
+#include <map>
+#include <stdint.h>
+#include <string>
+
+#define SUN_TRACE_DEFAULT_BUFFER_SIZE \
+	(1 << 20) /**< Default size in bytes of the buffer of a trace file. */
+#define SUN_TRACE_EVENT_LENGTH \
+	8 /**< Length of the event field of a binary trace record. */
+#define SUN_TRACE_RECORD_SIZE \
+	32 /**< Size in bytes of a binary trace record. */
+
+/**
+ * Entry of the trace file of SUN.
+ */
+typedef struct SunTraceRecord {
+	const char *event; /**< Event, e.g., RECV_PKT. */
+	double time; /**< Simulation time. */
+	int node; /**< IP of the tracing node. */
+	int pkt_id; /**< Unique ID of the packet. */
+	int pkt_sn; /**< Serial number of the packet. */
+	int from; /**< Previous hop. */
+	int next_hop; /**< Next hop. */
+	int source; /**< IP source of the packet. */
+	int destination; /**< IP destination of the packet. */
+	double snr; /**< SNR of the packet. */
+	int direction; /**< Direction of the packet. */
+	int ptype; /**< Type of the packet. */
+} SunTraceRecord;
+
+/**
+ * SunTraceWriter buffers the entries of a trace file. The writers are
+ * process-wide and identified by the name of their file.
+ *
+ * In TRACE_TEXT format an entry is the line written by the previous SUN
+ * versions, i.e., the tab separated fields of SunTraceRecord with the IPs and
+ * packet IDs truncated to their lowest byte. In TRACE_BINARY format an entry
+ * is a SUN_TRACE_RECORD_SIZE bytes record, in host byte order:
+ * time (double), snr (float), event (SUN_TRACE_EVENT_LENGTH chars, zero
+ * padded), node, pkt_id, pkt_sn, from, next_hop, source, destination (uint8
+ * each), direction (int8), ptype (int32).
+ */
+class SunTraceWriter
+{
+public:
+	enum TraceFormat { TRACE_TEXT = 0, TRACE_BINARY };
+
+	/**
+	 * Returns the writer of a trace file. The file is truncated when its
+	 * writer is created.
+	 *
+	 * @param file_name Name of the trace file.
+	 * @param format Format of the entries, used only when the writer is
+	 * created.
+	 * @return Pointer to the writer.
+	 */
+	static SunTraceWriter *getWriter(
+			const std::string &file_name, TraceFormat format = TRACE_TEXT);
+
+	/**
+	 * Writes to disk the buffers of all the writers.
+	 */
+	static void flushAll();
+
+	/**
+	 * Sets the size of the buffer of the writers.
+	 *
+	 * @param bytes Number of buffered bytes that triggers a flush.
+	 */
+	static void setBufferSize(size_t bytes);
+
+	/**
+	 * Sets the flush period of the writers.
+	 *
+	 * @param period Simulation time after which the buffer is flushed,
+	 * 0 to flush only when the buffer is full.
+	 */
+	static void setFlushPeriod(double period);
+
+	/**
+	 * Appends a line to the trace file.
+	 *
+	 * @param line Line to write, without the trailing new line.
+	 * @param now Current simulation time.
+	 */
+	void writeLine(const std::string &line, double now);
+
+	/**
+	 * Appends an entry to the trace file, in the format of the writer.
+	 *
+	 * @param record Entry to write.
+	 * @param separator Separator of the fields in TRACE_TEXT format.
+	 */
+	void writeRecord(const SunTraceRecord &record, char separator);
+
+	/**
+	 * Writes the buffer to disk.
+	 */
+	void flush();
+
+	/**
+	 * Returns the format of the writer.
+	 */
+	inline TraceFormat
+	format() const
+	{
+		return format_;
+	}
+
+private:
+	/**
+	 * Constructor of the SunTraceWriter class.
+	 */
+	SunTraceWriter(const std::string &file_name, TraceFormat format);
+
+	/**
+	 * Flushes the buffer if it is full or if the flush period elapsed.
+	 *
+	 * @param now Current simulation time.
+	 */
+	void checkFlush(double now);
+
+	std::string file_name_; /**< Name of the trace file. */
+	TraceFormat format_; /**< Format of the entries. */
+	std::string buffer_; /**< Entries not yet written to disk. */
+	double last_flush_; /**< Simulation time of the last flush. */
+
+	static std::map<std::string, SunTraceWriter *>
+			writers_; /**< Writers indexed by file name. */
+	static size_t buffer_size_; /**< Size of the buffers. */
+	static double flush_period_; /**< Flush period, 0 if disabled. */
+};
+
+#endif // SUN_TRACE_WRITER_H
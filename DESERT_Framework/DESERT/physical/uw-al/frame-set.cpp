@@ -92,10 +92,13 @@ RxFrameSetKey::displayKey() const
 	return str;
 }
 
-RxFrameSet::RxFrameSet()
+RxFrameSet::RxFrameSet(Packet *p)
 {
 
-	memset(binPayload_, '\0', MAX_BIN_PAYLOAD_ARRAY_LENGTH);
+	hdr_uwal *hal = HDR_UWAL(p);
+
+	pkt_ = p;
+	binPayload_ = hal->binPkt() + hal->binHdrLength();
 	memset(binPayloadCheck_, '\0', MAX_BIN_PAYLOAD_CHECK_ARRAY_LENGTH);
 	tot_length_ = -1;
 	curr_length_ = 0;
@@ -117,7 +120,8 @@ RxFrameSet::displaySet()
 	sstr << "binPayload_:" << packer::hexdump_nice(binPayload(false))
 		 << "binPayloadCheck_:"
 		 << packer::bindump(
-					binPayloadCheck_, MAX_BIN_PAYLOAD_CHECK_ARRAY_LENGTH)
+					(const char *) binPayloadCheck_,
+					MAX_BIN_PAYLOAD_CHECK_ARRAY_LENGTH)
 		 << ",tot_length_:" << tot_length() << ",curr_length_:" << curr_length()
 		 << ",t_last_rx_frame_:" << t_last_rx_frame();
 
@@ -146,6 +150,30 @@ RxFrameSet::binPayload(bool extract) const
 	return res;
 }
 
+void
+RxFrameSet::setReceived(size_t offset, size_t length)
+{
+
+	size_t end = offset + length;
+
+	// leading bits up to the first byte boundary
+	for (; offset < end && BARR_BITNUM(offset) != 0; offset++) {
+		BARR_SET(binPayloadCheck_, offset);
+	}
+
+	// whole bytes of the bitmap
+	size_t full = BARR_ELNUM(end) - BARR_ELNUM(offset);
+	if (full > 0) {
+		memset(binPayloadCheck_ + BARR_ELNUM(offset), 0xff, full);
+		offset += full * BARR_ELBITS;
+	}
+
+	// trailing bits
+	for (; offset < end; offset++) {
+		BARR_SET(binPayloadCheck_, offset);
+	}
+}
+
 void
 RxFrameSet::UpdateRxFrameSet(
 		char *frame, size_t offset, size_t length, int tot_length, double time)
@@ -172,9 +200,7 @@ RxFrameSet::UpdateRxFrameSet(
 		return;
 	}
 
-	for (int i = offset; i < offset + length; i++) {
-		BARR_SET(binPayloadCheck_, i);
-	}
+	setReceived(offset, length);
 
 	memcpy(binPayload_ + offset, frame, length);
 
@@ -38,6 +38,11 @@
 #ifndef FRAMESET_H
 #define FRAMESET_H
 
+#include "hdr-uwal.h"
+
+#include <packet.h>
+
+#include <climits>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -50,7 +55,7 @@
 #define MAX_BIN_PAYLOAD_ARRAY_LENGTH 2240
 
 #define MAX_BIN_PAYLOAD_CHECK_ARRAY_LENGTH \
-	((MAX_BIN_PAYLOAD_ARRAY_LENGTH + sizeof(char) - 1) / sizeof(char))
+	((MAX_BIN_PAYLOAD_ARRAY_LENGTH + CHAR_BIT - 1) / CHAR_BIT)
 
 class RxFrameSetKey
 {
@@ -86,25 +91,69 @@ public:
 	std::string displayKey() const;
 };
 
+/**
+ * Set of frames of the same packet being reassembled. The frames are copied
+ * at their offset directly into the binary payload of the packet that will be
+ * sent up once the set is complete, so that no intermediate copy is needed.
+ * The packet is not owned by the set: Uwal either sends it up or frees it.
+ */
 class RxFrameSet
 {
 
-	char binPayload_[MAX_BIN_PAYLOAD_ARRAY_LENGTH]; /**< array to store
-													   binary data received
-													   as frames. */
-	char binPayloadCheck_
-			[MAX_BIN_PAYLOAD_CHECK_ARRAY_LENGTH]; /**< array to count already
-													 received frames. */
+	Packet *pkt_; /**< packet the frames are reassembled into. */
+	char *binPayload_; /**< binary payload of pkt_, where the frames are
+						  stored at their offset. */
+	unsigned char binPayloadCheck_
+			[MAX_BIN_PAYLOAD_CHECK_ARRAY_LENGTH]; /**< bitmap of the bytes of
+													 binPayload_ already
+													 received. */
 	int tot_length_;
 	size_t curr_length_;
 	double t_last_rx_frame_;
 	bool error_;
 
+	/**
+	 * Mark as received the bytes [offset, offset + length) of binPayload_.
+	 */
+	void setReceived(size_t offset, size_t length);
+
 public:
-	RxFrameSet();
+	/**
+	 * Constructor of the RxFrameSet class.
+	 * @param p packet, with an initialized uwal header, the frames are
+	 * reassembled into.
+	 */
+	RxFrameSet(Packet *p);
 
 	~RxFrameSet();
 
+	/**
+	 * Return the packet the frames are reassembled into.
+	 */
+	inline Packet *
+	pkt() const
+	{
+		return pkt_;
+	}
+
+	/**
+	 * Return the reassembled binary payload, valid up to tot_length_.
+	 */
+	inline const char *
+	data() const
+	{
+		return binPayload_;
+	}
+
+	/**
+	 * Return true if the last frame has been received and no byte is missing.
+	 */
+	inline bool
+	isComplete() const
+	{
+		return tot_length_ > -1 && (size_t) tot_length_ == curr_length_;
+	}
+
 	/**
 	 * Reference to the tot_length_ variable.
 	 */
@@ -0,0 +1,364 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file packer-bits-check.cpp
+ * \version 1.0.0
+ * \brief Check program of packer::put and packer::get: a synthetic set of
+ * header layouts is packed and unpacked with PackerBits::copy and with the
+ * bit by bit copy it replaced, and the two must match bit for bit.
+ */
+
+#include "packer-check.h"
+#include "packer-schema.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Header field as serialized by a packer: size of the field in the header
+ * and number of bits written with the default Tcl settings.
+ */
+struct CheckField {
+	const char *name;
+	size_t bytes;
+	size_t bits;
+};
+
+/**
+ * Sequence of the fields packed by a packer for a packet type.
+ */
+struct CheckLayout {
+	const char *name;
+	std::vector<CheckField> fields;
+};
+
+/**
+ * Synthetic layouts copied by hand from the packMyHdr() of the in-tree
+ * packers, with the widths set in their Tcl init files, or the constructor
+ * default when the init file sets none. The packers themselves are not
+ * instantiated, so a change in a packer must be mirrored here. A field may
+ * be packed on more bits than its size, as packer::put allows.
+ */
+std::vector<CheckLayout>
+inTreeLayouts()
+{
+	std::vector<CheckLayout> l;
+	l.push_back({"UW/AL",
+			{{"srcID_", 1, 8},
+					{"pktID_", 4, 32},
+					{"framePayloadOffset_", 2, 16},
+					{"Mbit_", 1, 1},
+					{"dummyStr_", 2240, 256}}});
+	// addr_type_ at the 32 bits of ADRR_TYPE_Bits in the init file
+	l.push_back({"NS2/COMMON",
+			{{"ptype_", 4, 32},
+					{"size_", 4, 32},
+					{"uid_", 4, 32},
+					{"error_", 4, 0},
+					{"ts_", 8, 64},
+					{"direction_", 4, 0},
+					{"prev_hop_", 4, 32},
+					{"next_hop_", 4, 32},
+					{"addr_type_", 4, 32},
+					{"last_hop_", 4, 32},
+					{"txtime_", 8, 64},
+					{"errbitcnt_", 4, 0},
+					{"fecsize_", 4, 0},
+					{"iface_", 4, 0},
+					{"src_rt_valid", 4, 0},
+					{"ts_arr_", 8, 0},
+					{"xmit_failure_", 8, 0},
+					{"xmit_failure_data_", 8, 0},
+					{"xmit_reason_", 4, 0},
+					{"num_forwards_", 4, 0},
+					{"opt_num_forwards_", 4, 0}}});
+	l.push_back({"NS2/MAC",
+			{{"ftype_", 4, 0},
+					{"macSA_", 4, 32},
+					{"macDA_", 4, 32},
+					{"hdr_type_", 2, 0},
+					{"txtime_", 8, 0},
+					{"sstime_", 8, 0},
+					{"padding_", 4, 0}}});
+	l.push_back({"UW/CBR",
+			{{"sn_", 2, 32},
+					{"rftt_", 4, 0},
+					{"rftt_valid_", 1, 0},
+					{"traffic_type_", 2, 0}}});
+	l.push_back({"UW/IP", {{"saddr_", 1, 32}, {"daddr_", 1, 32}}});
+	l.push_back({"UW/UDP", {{"sport_", 1, 8}, {"dport_", 1, 8}}});
+	l.push_back({"UW/FLOODING", {{"ttl_", 1, 8}}});
+	l.push_back({"UW-CSMA-CA RTS", {{"tx_time", 1, 8}}});
+	l.push_back({"UW-CSMA-CA CTS", {{"tx_time", 1, 8}}});
+	l.push_back({"Uwpolling TRIGGER",
+			{{"t_in_", 2, 16}, {"t_fin_", 2, 16}, {"TRIGGER_uid_", 4, 16}}});
+	l.push_back({"Uwpolling POLL",
+			{{"id_", 4, 8}, {"POLL_uid_", 4, 16}, {"POLL_time_", 2, 0}}});
+	l.push_back({"Uwpolling PROBE",
+			{{"ts_", 2, 16},
+					{"n_pkts_", 4, 16},
+					{"id_node_", 4, 8},
+					{"PROBE_uid_", 4, 16}}});
+	l.push_back({"Uwpolling PROBE_SINK",
+			{{"id_sink_", 4, 0}, {"PROBE_uid_", 4, 0}, {"id_ack_", 2, 0}}});
+	l.push_back({"Uwpolling ACK_SINK", {{"actual_size", 8, 0}}});
+	l.push_back({"Uwpolling AUV_MULE",
+			{{"pkt_uid_", 2, 0}, {"last_pkt_uid_", 2, 0}}});
+	// widths of the init file, whose names differ from the bound ones
+	l.push_back({"uwUFetch BEACON",
+			{{"t_max_bc_", 4, 16},
+					{"t_min_bc_", 4, 16},
+					{"num_Max_CBEACON_tx_by_HN_", 4, 8}}});
+	l.push_back({"uwUFetch PROBE",
+			{{"backoff_time_PROBE_", 4, 16},
+					{"n_DATA_pcks_Node_tx_", 4, 8}}});
+	l.push_back({"uwUFetch POLL",
+			{{"mac_addr_Node_polled_", 4, 2},
+					{"num_DATA_pcks_MAX_rx_", 4, 8}}});
+	l.push_back({"uwUFetch CBEACON",
+			{{"num_Max_CBEACON_tx_by_HN_", 4, 8},
+					{"t_max_bc_", 4, 16},
+					{"t_min_bc_", 4, 16}}});
+	l.push_back({"uwUFetch TRIGGER",
+			{{"t_max_", 4, 16},
+					{"t_min_", 4, 16},
+					{"max_pck_want_rx_", 4, 16}}});
+	l.push_back({"uwUFetch RTS",
+			{{"backoff_time_RTS_", 4, 16}, {"num_DATA_pcks_", 4, 16}}});
+	l.push_back({"uwUFetch CTS",
+			{{"mac_addr_HN_ctsed_", 4, 16},
+					{"num_DATA_pcks_MAX_rx_", 4, 16}}});
+	// payload of 32 bytes
+	l.push_back({"uwApplication DATA",
+			{{"sn_", 2, 16},
+					{"rftt_", 4, 16},
+					{"rftt_valid_", 1, 4},
+					{"priority_", 1, 4},
+					{"payload_size_", 2, 16},
+					{"payload_msg", 4096, 256}}});
+	// 4 entries of the holdover times
+	l.push_back({"UW/RANGING_TDOA",
+			{{"source_pkt_id", 1, 5},
+					{"source_node_id", 1, 3},
+					{"times_size_", 1, 8},
+					{"times_", 32 * 8, 4 * 8 * 8}}});
+	return l;
+}
+
+const int TRIALS = 200; /**< Random headers checked for each layout. */
+const size_t MAX_OFFSET = 16; /**< Offsets of the header in the payload. */
+const size_t REPEAT = 20000; /**< Runs timed for each layout. */
+
+/**
+ * Header of a layout, with its fields and the packed bits.
+ */
+struct CheckHeader {
+	std::vector<std::vector<unsigned char> > fields;
+	std::vector<unsigned char> buf;
+	size_t offset;
+
+	CheckHeader(const CheckLayout &layout, size_t offset)
+		: offset(offset)
+	{
+		size_t bits = offset;
+		for (const CheckField &f : layout.fields) {
+			size_t bytes =
+					std::max(f.bytes, (f.bits + CHAR_BIT - 1) / CHAR_BIT);
+			fields.push_back(std::vector<unsigned char>(bytes));
+			bits += f.bits;
+		}
+		buf.resize((bits + CHAR_BIT - 1) / CHAR_BIT + 1);
+	}
+};
+
+/**
+ * Pack the fields of \e h, as packer::packMyHdr does with packer::put.
+ */
+template <typename Put>
+void
+pack(const CheckLayout &layout, CheckHeader &h, Put put)
+{
+	size_t offset = h.offset;
+	for (size_t i = 0; i < layout.fields.size(); i++)
+		offset += put(&h.buf[0], offset, &h.fields[i][0],
+				layout.fields[i].bits);
+}
+
+/**
+ * Unpack the fields of \e h, as packer::unpackMyHdr does with packer::get.
+ */
+template <typename Get>
+void
+unpack(const CheckLayout &layout, CheckHeader &h, Get get)
+{
+	size_t offset = h.offset;
+	for (size_t i = 0; i < layout.fields.size(); i++)
+		offset += get(&h.buf[0], offset, &h.fields[i][0],
+				layout.fields[i].bits);
+}
+
+size_t
+wordPut(unsigned char *buffer, size_t offset, const void *val, size_t h)
+{
+	PackerBits::copy(buffer, offset, (const unsigned char *) val, 0, h);
+	return h;
+}
+
+size_t
+wordGet(const unsigned char *buffer, size_t offset, void *val, size_t h)
+{
+	PackerBits::copy((unsigned char *) val, 0, buffer, offset, h);
+	return h;
+}
+
+/**
+ * Return true if the first \e bits bits of \e a and \e b are equal.
+ */
+bool
+sameBits(const std::vector<unsigned char> &a,
+		const std::vector<unsigned char> &b, size_t bits)
+{
+	for (size_t j = 0; j < bits; j++)
+		if (PackerBitLoop::test(&a[0], j) != PackerBitLoop::test(&b[0], j))
+			return false;
+	return true;
+}
+
+/**
+ * Check a layout on random headers, at random offsets in the payload.
+ * @return the number of mismatches.
+ */
+int
+checkLayout(const CheckLayout &layout)
+{
+	int errors = 0;
+
+	for (int t = 0; t < TRIALS && errors == 0; t++) {
+		CheckHeader sent(layout, rand() % MAX_OFFSET);
+		for (auto &f : sent.fields)
+			packerCheckRandomize(&f[0], f.size());
+		// bits of the payload around the header must be left untouched
+		packerCheckRandomize(&sent.buf[0], sent.buf.size());
+
+		CheckHeader by_bit = sent;
+		CheckHeader by_word = sent;
+		pack(layout, by_bit, PackerBitLoop::put);
+		pack(layout, by_word, wordPut);
+		if (by_bit.buf != by_word.buf) {
+			fprintf(stderr,
+					"%s: packed bits differ at offset %zu\n",
+					layout.name,
+					sent.offset);
+			errors++;
+			continue;
+		}
+
+		// unpack into fields holding different garbage
+		CheckHeader recv_bit = by_bit;
+		for (auto &f : recv_bit.fields)
+			packerCheckRandomize(&f[0], f.size());
+		CheckHeader recv_word = recv_bit;
+		unpack(layout, recv_bit, PackerBitLoop::get);
+		unpack(layout, recv_word, wordGet);
+
+		for (size_t i = 0; i < layout.fields.size(); i++) {
+			const CheckField &f = layout.fields[i];
+			if (recv_bit.fields[i] != recv_word.fields[i]) {
+				fprintf(stderr,
+						"%s: field %s unpacked differently at offset %zu\n",
+						layout.name,
+						f.name,
+						sent.offset);
+				errors++;
+			} else if (!sameBits(sent.fields[i], recv_word.fields[i],
+							   f.bits)) {
+				fprintf(stderr,
+						"%s: field %s does not round trip at offset %zu\n",
+						layout.name,
+						f.name,
+						sent.offset);
+				errors++;
+			}
+		}
+	}
+
+	return errors;
+}
+
+} // namespace
+
+int
+main()
+{
+	srand(1);
+	std::vector<CheckLayout> layouts = inTreeLayouts();
+
+	int errors = 0;
+	for (const CheckLayout &layout : layouts)
+		errors += checkLayout(layout);
+	if (errors > 0) {
+		fprintf(stderr, "%d mismatches\n", errors);
+		return 1;
+	}
+	printf("%zu packer layouts match the bit by bit copy\n", layouts.size());
+
+	printf("%-22s %6s %14s %14s\n", "layout", "bits", "bit loop [ns]",
+			"word [ns]");
+	double total_bit = 0;
+	double total_word = 0;
+	for (const CheckLayout &layout : layouts) {
+		CheckHeader h(layout, 3);
+		size_t bits = 0;
+		for (const CheckField &f : layout.fields)
+			bits += f.bits;
+
+		double by_bit = packerCheckTime(REPEAT, [&]() {
+			pack(layout, h, PackerBitLoop::put);
+			unpack(layout, h, PackerBitLoop::get);
+		});
+		double by_word = packerCheckTime(REPEAT, [&]() {
+			pack(layout, h, wordPut);
+			unpack(layout, h, wordGet);
+		});
+		printf("%-22s %6zu %14.1f %14.1f\n", layout.name, bits, by_bit,
+				by_word);
+		total_bit += by_bit;
+		total_word += by_word;
+	}
+	printf("%-22s %6s %14.1f %14.1f\n", "total", "", total_bit, total_word);
+
+	return 0;
+}
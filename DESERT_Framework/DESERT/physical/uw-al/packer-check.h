@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file packer-check.h
+ * \version 1.0.0
+ * \brief Helpers shared by the check programs of the packers: the bit by
+ * bit copy used by packer::put and packer::get before the word-level
+ * PackerBits::copy, a comparison of a PackerSchema with the handwritten
+ * code it replaced, and a timer for the benchmarks.
+ */
+
+#ifndef PACKER_CHECK_H
+#define PACKER_CHECK_H
+
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+/**
+ * Reference copy of bit strings, one bit at a time, as done by packer::put
+ * and packer::get before PackerBits. Bits are numbered from the least
+ * significant bit of the first byte.
+ */
+struct PackerBitLoop {
+	static inline bool
+	test(const unsigned char *barr, size_t n)
+	{
+		return barr[n / CHAR_BIT] & (1 << (n % CHAR_BIT));
+	}
+
+	static inline void
+	set(unsigned char *barr, size_t n, bool value)
+	{
+		if (value)
+			barr[n / CHAR_BIT] |= (unsigned char) (1 << (n % CHAR_BIT));
+		else
+			barr[n / CHAR_BIT] &= (unsigned char) ~(1 << (n % CHAR_BIT));
+	}
+
+	/**
+	 * Write \e h bits of \e val in \e buffer from \e offset.
+	 */
+	static inline size_t
+	put(unsigned char *buffer, size_t offset, const void *val, size_t h)
+	{
+		for (size_t j = 0; j < h; j++)
+			set(buffer, offset + j, test((const unsigned char *) val, j));
+		return h;
+	}
+
+	/**
+	 * Read \e h bits of \e val from \e buffer from \e offset.
+	 */
+	static inline size_t
+	get(const unsigned char *buffer, size_t offset, void *val, size_t h)
+	{
+		for (size_t j = 0; j < h; j++)
+			set((unsigned char *) val, j, test(buffer, offset + j));
+		return h;
+	}
+};
+
+/**
+ * Fill \e n bytes of \e buf with pseudo random values.
+ */
+inline void
+packerCheckRandomize(void *buf, size_t n)
+{
+	unsigned char *b = (unsigned char *) buf;
+	for (size_t i = 0; i < n; i++)
+		b[i] = (unsigned char) (rand() & 0xff);
+}
+
+/**
+ * Run \e f \e n times and return the elapsed time per run, in nanoseconds.
+ */
+template <typename F>
+double
+packerCheckTime(size_t n, F f)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < n; i++)
+		f();
+	auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count() /
+			n;
+}
+
+/**
+ * Compare Schema with the handwritten pack and unpack of a packer, on random
+ * headers at random offsets, with the widths in \e n_bits. The packed bits,
+ * including the untouched ones around the header, and the unpacked headers
+ * must be identical.
+ *
+ * @param name name of the packer, for the error messages.
+ * @param n_bits widths of the fields.
+ * @param fixed if true, the overloads of Schema with the default widths are
+ * checked, and \e n_bits must hold the default widths.
+ * @param pack handwritten pack, with the signature of Schema::pack.
+ * @param unpack handwritten unpack, with the signature of Schema::unpack.
+ * @param trials number of random headers.
+ * @return the number of mismatches.
+ */
+template <typename Schema, typename Hdr, typename Pack, typename Unpack>
+int
+packerCheckSchema(const char *name, const std::vector<size_t> &n_bits,
+		bool fixed, Pack pack, Unpack unpack, int trials)
+{
+	size_t bits = 0;
+	for (size_t n : n_bits)
+		bits += n;
+	std::vector<unsigned char> buf((CHAR_BIT + bits) / CHAR_BIT + 1);
+	std::vector<unsigned char> ref(buf.size());
+	if (fixed && !Schema::isDefault(n_bits)) {
+		fprintf(stderr, "%s: the widths are not the default ones\n", name);
+		return 1;
+	}
+
+	for (int t = 0; t < trials; t++) {
+		Hdr hdr;
+		packerCheckRandomize(&hdr, sizeof(hdr));
+		size_t offset = rand() % CHAR_BIT;
+
+		packerCheckRandomize(&ref[0], ref.size());
+		buf = ref;
+		size_t ref_end = pack(&hdr, &ref[0], offset, &n_bits[0]);
+		size_t end;
+		if (fixed)
+			end = Schema::pack(&hdr, &buf[0], offset);
+		else
+			end = Schema::pack(&hdr, &buf[0], offset, &n_bits[0]);
+		if (end != ref_end || buf != ref) {
+			fprintf(stderr, "%s: packed bits differ at offset %zu\n", name,
+					offset);
+			return 1;
+		}
+
+		Hdr ref_hdr;
+		packerCheckRandomize(&ref_hdr, sizeof(ref_hdr));
+		Hdr out_hdr = ref_hdr;
+		ref_end = unpack(&ref[0], offset, &ref_hdr, &n_bits[0]);
+		if (fixed)
+			end = Schema::unpack(&buf[0], offset, &out_hdr);
+		else
+			end = Schema::unpack(&buf[0], offset, &out_hdr, &n_bits[0]);
+		if (end != ref_end || memcmp(&ref_hdr, &out_hdr, sizeof(Hdr)) != 0) {
+			fprintf(stderr, "%s: unpacked headers differ at offset %zu\n",
+					name, offset);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+#endif /* PACKER_CHECK_H */
@@ -0,0 +1,303 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file packer-schema.h
+ * \version 1.0.0
+ * \brief Compile-time description of the header fields serialized by a
+ * packer.
+ */
+
+#ifndef PACKER_SCHEMA_H
+#define PACKER_SCHEMA_H
+
+#include "packer.h"
+
+#include <climits>
+#include <cstring>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Word-level copy of bit strings. Bits are numbered from the least
+ * significant bit of the first byte, as done by packer::put and packer::get.
+ */
+struct PackerBits {
+	/**
+	 * Maximum number of bits moved by a single word operation. A chunk
+	 * shifted by up to CHAR_BIT - 1 positions must still fit in a uint64_t.
+	 */
+	static const size_t CHUNK_BITS = 64 - CHAR_BIT;
+
+	/**
+	 * Load \e n bytes into a word, the first byte being the least
+	 * significant one.
+	 */
+	static inline uint64_t
+	load(const unsigned char *buf, size_t n)
+	{
+		uint64_t word = 0;
+		for (size_t i = 0; i < n; i++)
+			word |= (uint64_t) buf[i] << (i * CHAR_BIT);
+		return word;
+	}
+
+	/**
+	 * Store the \e n least significant bytes of a word, with the same
+	 * ordering of load().
+	 */
+	static inline void
+	store(unsigned char *buf, uint64_t word, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			buf[i] = (unsigned char) (word >> (i * CHAR_BIT));
+	}
+
+	/**
+	 * Copy \e h bits from bit \e src_off of \e src to bit \e dst_off of
+	 * \e dst, CHUNK_BITS at a time. Bits of \e dst outside the written range
+	 * are left untouched.
+	 */
+	static inline void
+	copy(unsigned char *dst, size_t dst_off, const unsigned char *src,
+			size_t src_off, size_t h)
+	{
+		while (h > 0) {
+			size_t n = h < CHUNK_BITS ? h : CHUNK_BITS;
+			const unsigned char *s = src + src_off / CHAR_BIT;
+			unsigned char *d = dst + dst_off / CHAR_BIT;
+			size_t s_shift = src_off % CHAR_BIT;
+			size_t d_shift = dst_off % CHAR_BIT;
+			uint64_t mask = ((uint64_t) 1 << n) - 1;
+
+			uint64_t bits =
+					(load(s, (s_shift + n + CHAR_BIT - 1) / CHAR_BIT) >>
+							s_shift) &
+					mask;
+
+			size_t d_len = (d_shift + n + CHAR_BIT - 1) / CHAR_BIT;
+			uint64_t word = load(d, d_len);
+			word = (word & ~(mask << d_shift)) | (bits << d_shift);
+			store(d, word, d_len);
+
+			src_off += n;
+			dst_off += n;
+			h -= n;
+		}
+	}
+};
+
+/**
+ * Header field serialized by a packer.
+ *
+ * @tparam Hdr type of the protocol header.
+ * @tparam T type of the field.
+ * @tparam Member pointer to the field.
+ * @tparam Bits default number of bits of the field in the bit stream. As for
+ * packer::put, it may exceed the size of the field.
+ * @tparam Signed if true, the sign of a compressed field is restored when
+ * unpacking (see packer::restoreSignedValue).
+ */
+template <typename Hdr, typename T, T Hdr::*Member, size_t Bits,
+		bool Signed = false>
+struct PackerField {
+	typedef Hdr hdr_type;
+
+	static const size_t bits = Bits;
+
+	/**
+	 * Write the field of \e hdr into \e n bits of \e buf from \e offset.
+	 */
+	static inline void
+	put(const Hdr *hdr, unsigned char *buf, size_t offset, size_t n)
+	{
+		PackerBits::copy(
+				buf, offset, (const unsigned char *) &(hdr->*Member), 0, n);
+	}
+
+	/**
+	 * Read the field of \e hdr from \e n bits of \e buf from \e offset.
+	 */
+	static inline void
+	get(const unsigned char *buf, size_t offset, Hdr *hdr, size_t n)
+	{
+		memset(&(hdr->*Member), 0, sizeof(T));
+		PackerBits::copy((unsigned char *) &(hdr->*Member), 0, buf, offset, n);
+		if (Signed && n > 0)
+			hdr->*Member = packer::restoreSignedValue(hdr->*Member, n);
+	}
+};
+
+/**
+ * Ordered list of the PackerField serialized by a packer. With the default
+ * widths the offset of every field is a compile-time constant; the overloads
+ * taking a vector of widths are the fallback used when the widths have been
+ * changed from Tcl.
+ *
+ * @code
+ * typedef PackerSchema<PackerField<hdr_foo, int, &hdr_foo::a_, 16>,
+ *		PackerField<hdr_foo, double, &hdr_foo::b_, 64> > FooSchema;
+ * @endcode
+ */
+template <typename... Fields>
+struct PackerSchema;
+
+template <>
+struct PackerSchema<> {
+	static const size_t n_fields = 0;
+
+	static const size_t bits = 0;
+
+	static inline void
+	defaultBits(std::vector<size_t> &)
+	{
+	}
+
+	static inline bool
+	isDefault(const std::vector<size_t> &, size_t)
+	{
+		return true;
+	}
+
+	template <typename Hdr>
+	static inline size_t
+	pack(const Hdr *, unsigned char *, size_t offset)
+	{
+		return offset;
+	}
+
+	template <typename Hdr>
+	static inline size_t
+	pack(const Hdr *, unsigned char *, size_t offset, const size_t *)
+	{
+		return offset;
+	}
+
+	template <typename Hdr>
+	static inline size_t
+	unpack(const unsigned char *, size_t offset, Hdr *)
+	{
+		return offset;
+	}
+
+	template <typename Hdr>
+	static inline size_t
+	unpack(const unsigned char *, size_t offset, Hdr *, const size_t *)
+	{
+		return offset;
+	}
+};
+
+template <typename F, typename... Rest>
+struct PackerSchema<F, Rest...> {
+	typedef PackerSchema<Rest...> Tail;
+	typedef typename F::hdr_type Hdr;
+
+	static const size_t n_fields = 1 + Tail::n_fields;
+
+	/** Length in bits of the header with the default widths. */
+	static const size_t bits = F::bits + Tail::bits;
+
+	/**
+	 * Append the default widths of the fields to \e n_bits.
+	 */
+	static inline void
+	defaultBits(std::vector<size_t> &n_bits)
+	{
+		n_bits.push_back(F::bits);
+		Tail::defaultBits(n_bits);
+	}
+
+	/**
+	 * Return true if \e n_bits, from index \e i, holds the default widths.
+	 */
+	static inline bool
+	isDefault(const std::vector<size_t> &n_bits, size_t i = 0)
+	{
+		return n_bits.size() == i + n_fields && n_bits[i] == F::bits &&
+				Tail::isDefault(n_bits, i + 1);
+	}
+
+	/**
+	 * Serialize the header with the default widths.
+	 * @return the offset after the last field.
+	 */
+	static inline size_t
+	pack(const Hdr *hdr, unsigned char *buf, size_t offset)
+	{
+		F::put(hdr, buf, offset, F::bits);
+		return Tail::pack(hdr, buf, offset + F::bits);
+	}
+
+	/**
+	 * Serialize the header with the widths in \e n_bits.
+	 * @return the offset after the last field.
+	 */
+	static inline size_t
+	pack(const Hdr *hdr, unsigned char *buf, size_t offset,
+			const size_t *n_bits)
+	{
+		F::put(hdr, buf, offset, n_bits[0]);
+		return Tail::pack(hdr, buf, offset + n_bits[0], n_bits + 1);
+	}
+
+	/**
+	 * Deserialize the header with the default widths.
+	 * @return the offset after the last field.
+	 */
+	static inline size_t
+	unpack(const unsigned char *buf, size_t offset, Hdr *hdr)
+	{
+		F::get(buf, offset, hdr, F::bits);
+		return Tail::unpack(buf, offset + F::bits, hdr);
+	}
+
+	/**
+	 * Deserialize the header with the widths in \e n_bits.
+	 * @return the offset after the last field.
+	 */
+	static inline size_t
+	unpack(const unsigned char *buf, size_t offset, Hdr *hdr,
+			const size_t *n_bits)
+	{
+		F::get(buf, offset, hdr, n_bits[0]);
+		return Tail::unpack(buf, offset + n_bits[0], hdr, n_bits + 1);
+	}
+};
+
+template <typename Hdr, typename T, T Hdr::*Member, size_t Bits, bool Signed>
+const size_t PackerField<Hdr, T, Member, Bits, Signed>::bits;
+
+template <typename F, typename... Rest>
+const size_t PackerSchema<F, Rest...>::n_fields;
+
+template <typename F, typename... Rest>
+const size_t PackerSchema<F, Rest...>::bits;
+
+#endif /* PACKER_SCHEMA_H */
@@ -36,6 +36,7 @@
  */
 
 #include "packer.h"
+#include "packer-schema.h"
 
 #include <cmath>
 #include <iomanip>
@@ -672,11 +673,7 @@ packer::getMyHdrBinLength()
 size_t
 packer::get(unsigned char *buffer, size_t offset, void *val, size_t h)
 {
-	for (size_t j = 0; j < h; j++)
-		if (BARR_TEST(buffer, (offset + j)))
-			BARR_SET(val, j);
-		else
-			BARR_CLEAR(val, j);
+	PackerBits::copy((unsigned char *) val, 0, buffer, offset, h);
 
 	return h;
 }
@@ -684,11 +681,7 @@ packer::get(unsigned char *buffer, size_t offset, void *val, size_t h)
 size_t
 packer::put(unsigned char *buffer, size_t offset, void *val, size_t h)
 {
-	for (size_t j = 0; j < h; j++)
-		if (BARR_TEST(val, j))
-			BARR_SET(buffer, (offset + j));
-		else
-			BARR_CLEAR(buffer, (offset + j));
+	PackerBits::copy(buffer, offset, (const unsigned char *) val, 0, h);
 
 	return h;
 }
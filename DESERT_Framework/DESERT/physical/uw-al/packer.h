@@ -238,7 +238,7 @@ protected:
 
 	virtual void printMyHdrField(Packet *, int);
 
-	size_t getMyHdrBinLength();
+	virtual size_t getMyHdrBinLength();
 
 	/**
 	 * Method used to retrieve a given variable from a certain number of bits
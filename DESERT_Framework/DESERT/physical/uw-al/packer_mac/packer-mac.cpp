@@ -89,6 +89,8 @@ packerMAC::packerMAC()
 	n_bits.push_back(TXtime_Bits);
 	n_bits.push_back(SStime_Bits);
 	n_bits.push_back(Padding_Bits);
+
+	default_bits_ = Schema::isDefault(n_bits);
 }
 
 packerMAC::~packerMAC()
@@ -111,6 +113,8 @@ packerMAC::init()
 	n_bits.push_back(TXtime_Bits);
 	n_bits.push_back(SStime_Bits);
 	n_bits.push_back(Padding_Bits);
+
+	default_bits_ = Schema::isDefault(n_bits);
 }
 
 size_t
@@ -120,15 +124,10 @@ packerMAC::packMyHdr(Packet *p, unsigned char *buf, size_t offset)
 	// Pointer to the MAC packet header
 	hdr_mac *hmac = HDR_MAC(p);
 
-	int field_idx = 0;
-
-	offset += put(buf, offset, &(hmac->ftype_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->macSA_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->macDA_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->hdr_type_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->txtime_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->sstime_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->padding_), n_bits[field_idx++]);
+	if (default_bits_)
+		offset = Schema::pack(hmac, buf, offset);
+	else
+		offset = Schema::pack(hmac, buf, offset, &n_bits[0]);
 
 	if (debug_) {
 		printf("\033[0;45;30m TX MAC packer hdr \033[0m \n");
@@ -144,44 +143,10 @@ packerMAC::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	// Pointer to the MAC packet header
 	hdr_mac *hmac = HDR_MAC(p);
 
-	int field_idx = 0;
-
-	memset(&(hmac->ftype_), 0, sizeof(hmac->ftype_));
-	offset += get(buf, offset, &(hmac->ftype_), n_bits[field_idx++]);
-
-	memset(&(hmac->macSA_), 0, sizeof(hmac->macSA_));
-	offset += get(buf, offset, &(hmac->macSA_), n_bits[field_idx++]);
-	hmac->macSA_ = restoreSignedValue(hmac->macSA_, n_bits[field_idx - 1]);
-
-	memset(&(hmac->macDA_), 0, sizeof(hmac->macDA_));
-	offset += get(buf, offset, &(hmac->macDA_), n_bits[field_idx++]);
-	hmac->macDA_ = restoreSignedValue(hmac->macDA_, n_bits[field_idx - 1]);
-
-	/* Old function to uncompresso signed value
-	if (n_bits[field_idx - 1] < sizeof(hmac->macDA()) * 8) { // Compression!
-		bitset<sizeof(hmac->macDA()) * 8 > my_bitset(hmac->macDA());
-		if (my_bitset[n_bits[field_idx - 1] - 1] == 1) {
-			for (int i = n_bits[field_idx - 1]; i < sizeof(hmac->macDA()) * 8;
-	++i) {
-				my_bitset.set(i,1);
-			}
-		}
-		hmac->macDA() = static_cast<int>(my_bitset.to_ulong());
-	}
-	 */
-
-	memset(&(hmac->hdr_type_), 0, sizeof(hmac->hdr_type_));
-	offset += get(buf, offset, &(hmac->hdr_type_), n_bits[field_idx++]);
-
-	memset(&(hmac->txtime_), 0, sizeof(hmac->txtime_));
-	offset += get(buf, offset, &(hmac->txtime_), n_bits[field_idx++]);
-
-	memset(&(hmac->sstime_), 0, sizeof(hmac->sstime_));
-	offset += get(buf, offset, &(hmac->sstime_), n_bits[field_idx++]);
-
-	memset(&(hmac->padding_), 0, sizeof(hmac->padding_));
-	offset += get(buf, offset, &(hmac->padding_), n_bits[field_idx++]);
-	hmac->padding_ = restoreSignedValue(hmac->padding_, n_bits[field_idx - 1]);
+	if (default_bits_)
+		offset = Schema::unpack(buf, offset, hmac);
+	else
+		offset = Schema::unpack(buf, offset, hmac, &n_bits[0]);
 
 	if (debug_) {
 		printf("\033[0;45;30m RX MAC packer hdr \033[0m \n");
@@ -191,6 +156,12 @@ packerMAC::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	return offset;
 }
 
+size_t
+packerMAC::getMyHdrBinLength()
+{
+	return default_bits_ ? Schema::bits : packer::getMyHdrBinLength();
+}
+
 void
 packerMAC::printMyHdrMap()
 {
@@ -38,6 +38,7 @@
 #ifndef PACKER_MAC_H
 #define PACKER_MAC_H
 
+#include "packer-schema.h"
 #include "packer.h"
 
 #include <mac.h>
@@ -62,6 +63,19 @@ public:
 	 */
 	~packerMAC();
 
+	/**
+	 * Fields of hdr_mac serialized by the packer, with their default widths.
+	 */
+	typedef PackerSchema<
+			PackerField<hdr_mac, MacFrameType, &hdr_mac::ftype_, 0>,
+			PackerField<hdr_mac, int, &hdr_mac::macSA_, 32, true>,
+			PackerField<hdr_mac, int, &hdr_mac::macDA_, 32, true>,
+			PackerField<hdr_mac, u_int16_t, &hdr_mac::hdr_type_, 0>,
+			PackerField<hdr_mac, double, &hdr_mac::txtime_, 0>,
+			PackerField<hdr_mac, double, &hdr_mac::sstime_, 0>,
+			PackerField<hdr_mac, int, &hdr_mac::padding_, 0, true> >
+			Schema;
+
 private:
 	/**
 	 * Init the Packer
@@ -95,7 +109,14 @@ private:
 	 * @param Pointer of the packet
 	 */
 	void printMyHdrFields(Packet *);
+	/**
+	 * Method returning the length in bits of the serialized header
+	 * @return Number of bits of the header
+	 */
+	size_t getMyHdrBinLength();
 
+	bool default_bits_; /**< True if n_bits holds the default widths of
+						   Schema. */
 	size_t Ftype_Bits; /** Bit length of the ftype_ field to be put in the
 						  header stream of bits. */
 	size_t SRC_Bits; /** Bit length of the macSA_ field to be put in the header
@@ -73,6 +73,8 @@ Uwal::Uwal()
 	, sendDownPkts()
 	, sendDownFrames()
 	, sendUpFrameSet()
+	, updatedFrameSets()
+	, frameSetExpiry()
 	, InterframeTmr(this)
 	, interframe_period(0)
 	, frame_set_validity(0)
@@ -98,6 +100,13 @@ Uwal::Uwal()
 Uwal::~Uwal()
 {
 	InterframeTmr.force_cancel();
+
+	for (std::map<RxFrameSetKey, RxFrameSet>::iterator it =
+					sendUpFrameSet.begin();
+			it != sendUpFrameSet.end();
+			it++) {
+		Packet::free(it->second.pkt());
+	}
 }
 
 int
@@ -475,83 +484,58 @@ Uwal::reassembleFrames(Packet *p)
 		std::map<RxFrameSetKey, RxFrameSet>::iterator it =
 				sendUpFrameSet.find(newKey);
 
+		if (it == sendUpFrameSet.end()) {
+			// The packet to send up is allocated with the first frame, which
+			// is then reassembled directly into its binary payload.
+			Packet *pkt = Packet::alloc();
+			initializeHdr(pkt, newKey.pktID());
+			HDR_UWAL(pkt)->srcID() = newKey.srcID();
+
+			it = sendUpFrameSet
+						 .insert(std::pair<RxFrameSetKey, RxFrameSet>(
+								 newKey, RxFrameSet(pkt)))
+						 .first;
+			frameSetExpiry.insert(std::pair<double, RxFrameSetKey>(
+					it->second.t_last_rx_frame(), newKey));
+		}
+
 		size_t framePayloadOffset =
 				hal->framePayloadOffset() * (PSDU - hal->binHdrLength());
 		// size_t framePayloadOffset = hal->framePayloadOffset()*(ch->size() -
 		// hal->binHdrLength());
-
-		if (it != sendUpFrameSet.end()) {
-			if (hal->Mbit()) { // not the last pkt frame
-				//(it->second).UpdateRxFrameSet(hal->binPkt() +
-				// hal->binHdrLength(), hal->framePayloadOffset(),
-				// hal->binPktLength() - hal->binHdrLength(), -1,
-				// Scheduler::instance().clock());
-				(it->second)
-						.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
-								framePayloadOffset,
-								hal->binPktLength() - hal->binHdrLength(),
-								-1,
-								Scheduler::instance().clock());
-			} else {
-				//(it->second).UpdateRxFrameSet(hal->binPkt() +
-				// hal->binHdrLength(), hal->framePayloadOffset(),
-				// hal->binPktLength() - hal->binHdrLength(),
-				//(hal->framePayloadOffset() + hal->binPktLength() -
-				// hal->binHdrLength()), Scheduler::instance().clock());
-				(it->second)
-						.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
-								framePayloadOffset,
-								hal->binPktLength() - hal->binHdrLength(),
-								(framePayloadOffset + hal->binPktLength() -
-										hal->binHdrLength()),
-								Scheduler::instance().clock());
-			}
-
-			if (ch->error()) {
-				if (debug_) {
-					std::cout << NOW << "  UW-AL(" << nodeID
-							  << ") - Received frame in error" << std::endl;
-				}
-				(it->second).setError();
-			}
-
+		size_t frameLength = hal->binPktLength() - hal->binHdrLength();
+		double t_last = it->second.t_last_rx_frame();
+
+		if (hal->Mbit()) { // not the unique or last pkt frame
+			(it->second)
+					.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
+							framePayloadOffset,
+							frameLength,
+							-1,
+							Scheduler::instance().clock());
 		} else {
-			RxFrameSet newSet;
-
-			if (hal->Mbit()) { // not the unique or last pkt frame
-				// newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
-				// hal->framePayloadOffset(), hal->binPktLength() -
-				// hal->binHdrLength(), -1, Scheduler::instance().clock());
-				newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
-						framePayloadOffset,
-						hal->binPktLength() - hal->binHdrLength(),
-						-1,
-						Scheduler::instance().clock());
-			} else {
-				// newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
-				// hal->framePayloadOffset(), hal->binPktLength() -
-				// hal->binHdrLength(), (hal->framePayloadOffset() +
-				// hal->binPktLength() - hal->binHdrLength()),
-				// Scheduler::instance().clock());
-				newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
-						framePayloadOffset,
-						hal->binPktLength() - hal->binHdrLength(),
-						(hal->framePayloadOffset() + hal->binPktLength() -
-								hal->binHdrLength()),
-						Scheduler::instance().clock());
-			}
+			(it->second)
+					.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
+							framePayloadOffset,
+							frameLength,
+							(framePayloadOffset + frameLength),
+							Scheduler::instance().clock());
+		}
 
-			if (ch->error()) {
-				if (debug_) {
-					std::cout << NOW << "  UW-AL(" << nodeID
-							  << ") - Received frame in error" << std::endl;
-				}
-				newSet.setError();
+		if (ch->error()) {
+			if (debug_) {
+				std::cout << NOW << "  UW-AL(" << nodeID
+						  << ") - Received frame in error" << std::endl;
 			}
+			(it->second).setError();
+		}
 
-			sendUpFrameSet.insert(
-					std::pair<RxFrameSetKey, RxFrameSet>(newKey, newSet));
+		if (it->second.t_last_rx_frame() != t_last) {
+			eraseFrameSetExpiry(newKey, t_last);
+			frameSetExpiry.insert(std::pair<double, RxFrameSetKey>(
+					it->second.t_last_rx_frame(), newKey));
 		}
+		updatedFrameSets.insert(newKey);
 
 		Packet::free(p);
 
@@ -612,95 +596,115 @@ Uwal::recvSyncClMsg(ClMessage *m)
 	return Module::recvSyncClMsg(m);
 }
 
+void
+Uwal::eraseFrameSetExpiry(const RxFrameSetKey &key, double t_last)
+{
+	std::pair<std::multimap<double, RxFrameSetKey>::iterator,
+			std::multimap<double, RxFrameSetKey>::iterator>
+			range = frameSetExpiry.equal_range(t_last);
+
+	for (std::multimap<double, RxFrameSetKey>::iterator it = range.first;
+			it != range.second;
+			it++) {
+		if (it->second.srcID() == key.srcID() &&
+				it->second.pktID() == key.pktID()) {
+			frameSetExpiry.erase(it);
+			return;
+		}
+	}
+}
+
 void
 Uwal::checkRxFrameSet()
 {
-	int fs_size = sendUpFrameSet.size();
-	std::map<RxFrameSetKey, RxFrameSet>::iterator it = sendUpFrameSet.begin();
+	// Only the sets updated since the last check may have been completed
+	for (std::set<RxFrameSetKey>::iterator key_it = updatedFrameSets.begin();
+			key_it != updatedFrameSets.end();
+			key_it++) {
+		std::map<RxFrameSetKey, RxFrameSet>::iterator it =
+				sendUpFrameSet.find(*key_it);
 
-	for (int i = 0; i < fs_size; i++) {
-		if (it->second.tot_length() == it->second.curr_length()) {
-			if (debug_) {
-				std::cout
-						<< NOW << "  UW-AL(" << nodeID
-						<< ")::checkRxFrameSet() - COMPLETE pkt RECEIVED! ****"
-						<< endl;
-				std::cout << "Number of elements in sendUpFrameSet: "
-						  << sendUpFrameSet.size() << endl;
-				std::cout << "Key: " << it->first.displayKey() << endl;
-				if (debug_ > 5) {
-					std::cout << "Set: " << it->second.displaySet() << endl;
-				}
+		if (it == sendUpFrameSet.end() || !it->second.isComplete())
+			continue;
+
+		if (debug_) {
+			std::cout << NOW << "  UW-AL(" << nodeID
+					  << ")::checkRxFrameSet() - COMPLETE pkt RECEIVED! ****"
+					  << endl;
+			std::cout << "Number of elements in sendUpFrameSet: "
+					  << sendUpFrameSet.size() << endl;
+			std::cout << "Key: " << it->first.displayKey() << endl;
+			if (debug_ > 5) {
+				std::cout << "Set: " << it->second.displaySet() << endl;
 			}
-			Packet *p = Packet::alloc();
-			initializeHdr(p, it->first.pktID());
+		}
+
+		// The frames have already been reassembled into the binary payload
+		// of the packet, only its length has to be set.
+		// (NOTE: it is not necessary to re-pack the uwal header, since the
+		// packet must be forwarded to the upper layers)
+		Packet *p = it->second.pkt();
 
-			hdr_uwal *hal = HDR_UWAL(p);
-			hdr_cmn *ch = HDR_CMN(p);
+		hdr_uwal *hal = HDR_UWAL(p);
+		hdr_cmn *ch = HDR_CMN(p);
 
-			hal->srcID() = it->first.srcID();
+		hal->binPktLength() += it->second.tot_length();
 
-			// pPacker -> packHdr(p); // (NOTE: it is not necessary to re-pack
-			// the uwal header, since the new allocated packet must be forwarded
-			// to the upper layers)
+		// Set temporary size as num_frames*payload_lenght
+		ch->size() = it->second.tot_length();
+		if (debug_) {
+			std::cout << "Packet size = " << ch->size() << std::endl;
+		}
 
-			memcpy(hal->binPkt() + hal->binHdrLength(),
-					(it->second.binPayload()).c_str(),
-					(it->second.binPayload()).size());
-			hal->binPktLength() += (it->second.binPayload()).size();
+		pPacker->unpackPayload(p);
 
-			// check if this is right
-			//            ch->uid() = hal->pktID();
-			//            if (debug_){
-			//                std::cout << "Size: " << ch->size() << endl;
-			//                std::cout << "Uid : "<< ch->uid() << std::endl;
-			//            }
+		hdr_mac *mach = HDR_MAC(p);
+		if (isInPERList(mach->macSA())) {
+			double x = RNG::defaultrng()->uniform_double();
+			cout << "x = " << x << endl;
+			double per = getPERfromID(mach->macSA());
+			cout << "PER = " << per << endl;
+			bool error = x <= per;
+			if (error)
+				ch->error() = 1;
+		}
 
-			// Set temporary size as num_frames*payload_lenght
-			ch->size() = it->second.tot_length();
+		if (it->second.getError()) {
 			if (debug_) {
-				std::cout << "Packet size = " << ch->size() << std::endl;
+				std::cout << NOW << "  UW-AL(" << nodeID
+						  << ") - Packet in error" << std::endl;
 			}
 
-			pPacker->unpackPayload(p);
-
-			hdr_mac *mach = HDR_MAC(p);
-			if (isInPERList(mach->macSA())) {
-				double x = RNG::defaultrng()->uniform_double();
-				cout << "x = " << x << endl;
-				double per = getPERfromID(mach->macSA());
-				cout << "PER = " << per << endl;
-				bool error = x <= per;
-				if (error)
-					ch->error() = 1;
-			}
+			ch->error() = 1;
+		}
 
-			if (it->second.getError()) {
-				if (debug_) {
-					std::cout << NOW << "  UW-AL(" << nodeID
-							  << ") - Packet in error" << std::endl;
-				}
+		sendUpPkts.push(p);
+		eraseFrameSetExpiry(it->first, it->second.t_last_rx_frame());
+		sendUpFrameSet.erase(it);
+	}
+	updatedFrameSets.clear();
 
-				ch->error() = 1;
-			}
+	// Discard the incomplete sets, starting from the oldest one
+	while (!frameSetExpiry.empty() &&
+			Scheduler::instance().clock() - frameSetExpiry.begin()->first >
+					frame_set_validity) {
+		std::map<RxFrameSetKey, RxFrameSet>::iterator it =
+				sendUpFrameSet.find(frameSetExpiry.begin()->second);
+		frameSetExpiry.erase(frameSetExpiry.begin());
 
-			sendUpPkts.push(p);
-			sendUpFrameSet.erase(it++);
-		} else if (Scheduler::instance().clock() -
-						it->second.t_last_rx_frame() >
-				frame_set_validity) {
-			if (debug_) {
-				printf("\033[0;0;31m WARNING: \033[0m ");
-				std::cout << "**** Uwal::checkRxFrameSet() - INCOMPLETE pkt "
-							 "DISCARDED! - frame_set_validity elapsed! ****"
-						  << endl;
-				std::cout << "Number of elements in sendUpFrameSet: "
-						  << sendUpFrameSet.size() << endl;
-			}
-			sendUpFrameSet.erase(it++);
-		} else {
-			++it;
+		if (it == sendUpFrameSet.end())
+			continue;
+
+		if (debug_) {
+			printf("\033[0;0;31m WARNING: \033[0m ");
+			std::cout << "**** Uwal::checkRxFrameSet() - INCOMPLETE pkt "
+						 "DISCARDED! - frame_set_validity elapsed! ****"
+					  << endl;
+			std::cout << "Number of elements in sendUpFrameSet: "
+					  << sendUpFrameSet.size() << endl;
 		}
+		Packet::free(it->second.pkt());
+		sendUpFrameSet.erase(it);
 	}
 }
 
@@ -55,6 +55,7 @@
 #include <map>
 #include <queue>
 #include <rng.h>
+#include <set>
 #include <sstream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -181,6 +182,12 @@ protected:
 									 Packet Error Rate associated ) */
 	std::map<RxFrameSetKey, RxFrameSet>
 			sendUpFrameSet; /**< map of the frames to send up */
+	std::set<RxFrameSetKey> updatedFrameSets; /**< keys of the frame sets
+												 updated since the last
+												 checkRxFrameSet() */
+	std::multimap<double, RxFrameSetKey>
+			frameSetExpiry; /**< keys of the frame sets ordered by the time
+							   of their last received frame */
 	/**
 	 * Method responsible to manage the queueing system of Adaptation Layer
 	 */
@@ -206,6 +213,12 @@ protected:
 	 * Method responsible to check for errors the received frames
 	 */
 	void checkRxFrameSet();
+	/**
+	 * Method responsible to remove a frame set from the time ordered index
+	 * @param key of the frame set
+	 * @param time of the last frame received by the frame set
+	 */
+	void eraseFrameSetExpiry(const RxFrameSetKey &, double);
 
 	/**
 	 *  Method to start the packet transmission.
@@ -34,3 +34,4 @@ Module/UW/AHOI/PHY set tx_power_consumption_ 3.3
 Module/UW/AHOI/PHY set rx_power_consumption_ 0.620
 Module/UW/AHOI/PHY  set AcquisitionThreshold_dB_    15.0 
 Module/UW/AHOI/PHY  set MaxTxSPL_dB_               185.8
+Module/UW/AHOI/PHY  set ber_table_step_dB_          0
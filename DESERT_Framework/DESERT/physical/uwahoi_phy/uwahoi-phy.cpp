@@ -68,8 +68,8 @@ UwAhoiPhy::UwAhoiPhy()
 	, pdr_file_name_("dbs/ahoi/default_pdr.csv")
 	, sir_file_name_("dbs/ahoi/default_sir.csv")
 	, pdr_token_separator_(',')
-	, range2pdr_()
-	, sir2pdr_()
+	, range2pdr_(&UwLut::emptyLut())
+	, sir2pdr_(&UwLut::emptyLut())
 	, initLUT_(false)
 { // binding to TCL variables
 	Interference_Model = "MEANPOWER";
@@ -120,53 +120,22 @@ UwAhoiPhy::command(int argc, const char *const *argv)
 void
 UwAhoiPhy::initializeLUT()
 {
-	ifstream input_file_;
-	string line_;
-	char *tmp_ = new char[pdr_file_name_.length() + 1];
-	strcpy(tmp_, pdr_file_name_.c_str());
-	input_file_.open(tmp_);
-	if (input_file_.is_open()) {
-		// skip first 2 lines
-		if (debug_)
-			std::cout << "UwAhoiPhy::initializeRangeLUT()" << endl;
-		while (std::getline(input_file_, line_)) {
-			// TODO: retrive the right row and break the loop
-			std::istringstream line_stream(line_);
-			std::string token;
-			std::getline(line_stream, token, pdr_token_separator_);
-			double d = stod(token);
-			std::getline(line_stream, token, pdr_token_separator_);
-			double p = stod(token);
-			range2pdr_[d] = p;
-			if (debug_)
-				std::cout << d << " " << p << endl;
-		}
-	} else {
-		cerr << "Impossible to open file " << pdr_file_name_ << endl;
+	if (debug_)
+		std::cout << "UwAhoiPhy::initializeRangeLUT()" << endl;
+	range2pdr_ = &UwLut::getLut(pdr_file_name_, pdr_token_separator_);
+	if (debug_) {
+		for (int i = 0; i < range2pdr_->size(); i++)
+			std::cout << range2pdr_->getKey(i) << " "
+					  << range2pdr_->getValue(i) << endl;
 	}
 
-	ifstream input_file_2;
-	tmp_ = new char[sir_file_name_.length() + 1];
-	strcpy(tmp_, sir_file_name_.c_str());
-	input_file_2.open(tmp_);
-	if (input_file_2.is_open()) {
-		// skip first 2 lines
-		if (debug_)
-			std::cout << "UwAhoiPhy::initializeSIRLUT()" << endl;
-		while (std::getline(input_file_2, line_)) {
-			// TODO: retrive the right row and break the loop
-			std::istringstream line_stream(line_);
-			std::string token;
-			std::getline(line_stream, token, pdr_token_separator_);
-			double sir = stod(token);
-			std::getline(line_stream, token, pdr_token_separator_);
-			double p = stod(token);
-			sir2pdr_[sir] = p;
-			if (debug_)
-				std::cout << sir << " " << p << endl;
-		}
-	} else {
-		cerr << "Impossible to open file " << sir_file_name_ << endl;
+	if (debug_)
+		std::cout << "UwAhoiPhy::initializeSIRLUT()" << endl;
+	sir2pdr_ = &UwLut::getLut(sir_file_name_, pdr_token_separator_);
+	if (debug_) {
+		for (int i = 0; i < sir2pdr_->size(); i++)
+			std::cout << sir2pdr_->getKey(i) << " " << sir2pdr_->getValue(i)
+					  << endl;
 	}
 
 	initLUT_ = true;
@@ -292,17 +261,16 @@ UwAhoiPhy::matchDistancePDR(double distance)
 	if (debug_)
 		std::cout << NOW << "  UwAhoiPhy()::matchDistancePDR(double distance)"
 				  << "distance = " << distance << std::endl;
-	if (distance <= range2pdr_.begin()->first)
-		return range2pdr_.begin()->second;
+	if (distance <= range2pdr_->getKey(0))
+		return range2pdr_->getValue(0);
 
-	PdrLut::iterator it = range2pdr_.lower_bound(distance);
-	if (it == range2pdr_.end())
-		return (--it)->second;
-	double l_sup = it->first;
-	double p_sup = it->second;
-	it--;
-	double l_inf = it->first;
-	double p_inf = it->second;
+	int i = range2pdr_->lowerBound(distance);
+	if (i == range2pdr_->size())
+		return range2pdr_->getValue(i - 1);
+	double l_sup = range2pdr_->getKey(i);
+	double p_sup = range2pdr_->getValue(i);
+	double l_inf = range2pdr_->getKey(i - 1);
+	double p_inf = range2pdr_->getValue(i - 1);
 	if (debug_) {
 		std::cout << " Distance between " << l_inf << " and " << l_sup;
 		std::cout << " Succ Prob between " << p_inf << " and " << p_sup;
@@ -317,17 +285,16 @@ UwAhoiPhy::matchSIR_PDR(double sir)
 	if (debug_)
 		std::cout << NOW << "  UwAhoiPhy()::matchSIR_PDR(double sir)"
 				  << "sir = " << sir << std::endl;
-	if (sir_db <= sir2pdr_.begin()->first)
-		return sir2pdr_.begin()->second;
+	if (sir_db <= sir2pdr_->getKey(0))
+		return sir2pdr_->getValue(0);
 
-	PdrLut::iterator it = sir2pdr_.lower_bound(sir_db);
-	if (it == sir2pdr_.end())
-		return (--it)->second;
-	double l_sup = it->first;
-	double p_sup = it->second;
-	it--;
-	double l_inf = it->first;
-	double p_inf = it->second;
+	int i = sir2pdr_->lowerBound(sir_db);
+	if (i == sir2pdr_->size())
+		return sir2pdr_->getValue(i - 1);
+	double l_sup = sir2pdr_->getKey(i);
+	double p_sup = sir2pdr_->getValue(i);
+	double l_inf = sir2pdr_->getKey(i - 1);
+	double p_inf = sir2pdr_->getValue(i - 1);
 	if (debug_) {
 		std::cout << " SIR between " << l_inf << " and " << l_sup;
 		std::cout << " Succ Prob between " << p_inf << " and " << p_sup;
@@ -41,11 +41,8 @@
 
 #include "uwphysical.h"
 #include <iostream>
-#include <map>
 #include <math.h>
-
-typedef ::std::map<double, double> PdrLut;
-typedef PdrLut::iterator PdrLutIt;
+#include <uwlut.h>
 
 class UwAhoiPhy : public UnderwaterPhysical
 {
@@ -132,8 +129,8 @@ private:
 	string pdr_file_name_; // LUT file name
 	string sir_file_name_; // LUT file name
 	char pdr_token_separator_; // LUT token separator
-	PdrLut range2pdr_; // LUT pdr vs distance
-	PdrLut sir2pdr_; // LUT pdr vs sir
+	const UwLut *range2pdr_; // LUT pdr vs distance, shared by the nodes
+	const UwLut *sir2pdr_; // LUT pdr vs sir, shared by the nodes
 	bool initLUT_;
 };
 
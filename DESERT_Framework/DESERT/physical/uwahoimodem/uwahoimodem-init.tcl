@@ -36,3 +36,4 @@ Module/UW/UwModem/AHOI set stop_bit			1
 Module/UW/UwModem/AHOI set flow_control		0
 Module/UW/UwModem/AHOI set baud_rate		115200
 Module/UW/UwModem/AHOI set period_			0.1
+Module/UW/UwModem/AHOI set event_driven_	0
@@ -308,13 +308,13 @@ UwAhoiModem::start()
 	receiving.store(true);
 	transmitting.store(true);
 
+	// the wake up pipe must be open before the threads queue events
+	startEvents();
+
 	// spawn off threads
 	rx_thread = std::thread(&UwAhoiModem::receivingData, this);
 	tx_thread = std::thread(&UwAhoiModem::transmittingData, this);
 
-	checkTimer = new CheckTimer(this);
-	checkTimer->resched(period);
-
 	printOnLog(LogLevel::INFO, "AHOIMODEM", "start::STARTING_OPERATIONS");
 }
 
@@ -335,7 +335,7 @@ UwAhoiModem::stop()
 		rx_thread.join();
 	}
 
-	checkTimer->force_cancel();
+	stopEvents();
 }
 
 void
@@ -383,7 +383,7 @@ UwAhoiModem::transmittingData()
 		std::function<void(UwModem &, Packet * p)> callback =
 				&UwModem::realTxEnded;
 		ModemEvent e = {callback, pck};
-		event_q.push(e);
+		pushEvent(e);
 
 		printOnLog(LogLevel::DEBUG,
 				"AHOIMODEM",
@@ -549,7 +549,7 @@ UwAhoiModem::updateStatus(std::shared_ptr<ahoi::packet_t> packet)
 				std::function<void(UwModem &, Packet * p)> callback =
 						&UwModem::recv;
 				ModemEvent e = {callback, p};
-				event_q.push(e);
+				pushEvent(e);
 			}
 
 			break;
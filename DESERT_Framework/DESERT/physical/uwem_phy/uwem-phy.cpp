@@ -58,6 +58,7 @@ public:
 UwElectroMagneticPhy::UwElectroMagneticPhy()
 	: lut_file_name_("")
 	, lut_token_separator_(',')
+	, lut_map(&UwLut::emptyLut())
 	, rxPowerThreshold_(-200)
 {
 	if (!MPhy_Bpsk::initialized) {
@@ -205,28 +206,29 @@ double
 UwElectroMagneticPhy::getPER(double rx_power)
 {
 	// rx_power founded in the LUT
-	RSSIMap::iterator it = lut_map.lower_bound(rx_power);
+	int i = lut_map->lowerBound(rx_power);
 
-	if (it != lut_map.end() && it->first == rx_power) {
+	if (i < lut_map->size() && lut_map->getKey(i) == rx_power) {
 		if (debug_)
-			std::cout << rx_power << " " << it->first << " " << it->second
-					  << std::endl;
-		return it->second;
+			std::cout << rx_power << " " << lut_map->getKey(i) << " "
+					  << lut_map->getValue(i) << std::endl;
+		return lut_map->getValue(i);
 	}
 
 	// rx_power exceeds the LUT
-	if (it == lut_map.end() && it->first != rx_power) {
+	if (i == lut_map->size()) {
 		return 0;
 	}
-	if (it == lut_map.begin() && it->first != rx_power) {
+	if (i == 0) {
 		return 1;
 	}
 
 	// rx_power intermediate => interpolation
-	RSSIMap::iterator u_it = it;
-	it--;
-	return linearInterpolator(
-				   rx_power, it->first, it->second, u_it->first, u_it->second) /
+	return linearInterpolator(rx_power,
+				   lut_map->getKey(i - 1),
+				   lut_map->getValue(i - 1),
+				   lut_map->getKey(i),
+				   lut_map->getValue(i)) /
 			100;
 }
 
@@ -243,21 +245,5 @@ UwElectroMagneticPhy::linearInterpolator(
 void
 UwElectroMagneticPhy::initializeLUT()
 {
-	ifstream input_file_;
-	string line_;
-	input_file_.open(lut_file_name_.c_str());
-	if (input_file_.is_open()) {
-		double d;
-		double n;
-		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			line_stream >> d;
-			line_stream.ignore(256, lut_token_separator_);
-			line_stream >> n;
-			lut_map[d] = n;
-		}
-		input_file_.close();
-	} else {
-		cerr << "Impossible to open file " << lut_file_name_ << endl;
-	}
+	lut_map = &UwLut::getLut(lut_file_name_, lut_token_separator_);
 }
@@ -40,6 +40,7 @@
 #define UWEM_PHY_H
 
 #include <bpsk.h>
+#include <uwlut.h>
 #include <module.h>
 #include <packet.h>
 #include <rng.h>
@@ -59,9 +60,6 @@
 
 #define ELECTROMAGNETIC_MODULATION_TYPE "ELECTROMAGNETIC_BPSK"
 
-typedef ::std::map<double, double> RSSIMap;
-typedef RSSIMap::iterator DMIt;
-
 class UwElectroMagneticPhy : public MPhy_Bpsk
 {
 
@@ -112,7 +110,8 @@ private:
 	// Variables
 	string lut_file_name_; // LUT file name
 	char lut_token_separator_; //
-	RSSIMap lut_map; /**< Lookup table map of the RSSI versus PER*/
+	const UwLut *lut_map; /**< Lookup table of the RSSI versus PER, shared by
+							 the nodes using the same file */
 	double rxPowerThreshold_;
 };
 
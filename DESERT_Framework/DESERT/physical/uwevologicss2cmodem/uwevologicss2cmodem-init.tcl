@@ -31,5 +31,6 @@ Module/UW/UwModem/EvoLogicsS2C set NoiseSPD_ 0
 Module/UW/UwModem/EvoLogicsS2C set modemID   0
 Module/UW/UwModem/EvoLogicsS2C set debug_    0
 Module/UW/UwModem/EvoLogicsS2C set period_    0.1
+Module/UW/UwModem/EvoLogicsS2C set event_driven_    0
 Module/UW/UwModem/EvoLogicsS2C set max_read_size    2000
 Module/UW/UwModem/EvoLogicsS2C set buffer_size    2000
@@ -562,7 +562,7 @@ UwEvoLogicsS2CModem::startTx(Packet *p)
 		std::function<void(UwModem &, Packet * p)> callback =
 				&UwModem::realTxEnded;
 		ModemEvent e = {callback, p};
-		event_q.push(e);
+		pushEvent(e);
 
 	} else {
 		printOnLog(LogLevel::ERROR,
@@ -611,13 +611,13 @@ UwEvoLogicsS2CModem::start()
 	receiving.store(true);
 	transmitting.store(true);
 
+	// the wake up pipe must be open before the threads queue events
+	startEvents();
+
 	// branch off threads
 	rx_thread = std::thread(&UwEvoLogicsS2CModem::receivingData, this);
 
 	tx_thread = std::thread(&UwEvoLogicsS2CModem::transmittingData, this);
-
-	checkTimer = new CheckTimer(this);
-	checkTimer->resched(period);
 }
 
 void
@@ -641,7 +641,7 @@ UwEvoLogicsS2CModem::stop()
 		rx_thread.join();
 	}
 
-	checkTimer->force_cancel();
+	stopEvents();
 }
 
 void
@@ -682,28 +682,41 @@ UwEvoLogicsS2CModem::receivingData()
 	std::vector<char>::iterator cmd_e = data_buffer.begin();
 	UwInterpreterS2C::Response cmd = UwInterpreterS2C::Response::NO_COMMAND;
 	int r_bytes = 0;
-	int offset = 0;
+
+	p_interpreter->resetResponseSearch();
 
 	while (receiving.load()) {
 
 		r_bytes = p_connector->readFromDevice(
-				&(*beg_it) + offset, MAX_READ_BYTES - r_bytes);
-
-		end_it = beg_it + r_bytes + offset;
+				&(*end_it), MAX_READ_BYTES - (int) (end_it - beg_it));
+		if (r_bytes > 0)
+			end_it += r_bytes;
 
+		// the search starts after the last parsed response and, if no
+		// response was found, resumes where the previous read stopped
 		while (receiving.load() && r_bytes > 0 &&
-				(cmd = p_interpreter->findResponse(beg_it, end_it, cmd_b)) !=
+				(cmd = p_interpreter->findResponse(cmd_e, end_it, cmd_b)) !=
 						UwInterpreterS2C::Response::NO_COMMAND) {
 
 			while (receiving.load() &&
 					!p_interpreter->parseResponse(
 							cmd, end_it, cmd_b, cmd_e, rx_payload)) {
 
-				int new_r_bytes = p_connector->readFromDevice(
-						&(*end_it), MAX_READ_BYTES - r_bytes);
+				// a response cut by a full buffer is moved to the beginning,
+				// to make room for the rest of it
+				if (end_it - beg_it >= MAX_READ_BYTES && cmd_b != beg_it) {
+					std::vector<char>::iterator left_it =
+							std::copy(cmd_b, end_it, beg_it);
+					std::fill(left_it, end_it, '\0');
+					end_it = left_it;
+					cmd_b = beg_it;
+					p_interpreter->resetResponseSearch();
+				}
 
-				r_bytes += new_r_bytes;
-				end_it = beg_it + r_bytes;
+				int new_r_bytes = p_connector->readFromDevice(&(*end_it),
+						MAX_READ_BYTES - (int) (end_it - beg_it));
+				if (new_r_bytes > 0)
+					end_it += new_r_bytes;
 			}
 
 			printOnLog(LogLevel::DEBUG,
@@ -712,15 +725,21 @@ UwEvoLogicsS2CModem::receivingData()
 
 			updateStatus(cmd);
 			std::fill(cmd_b, cmd_e, '\0');
-			cmd_b = cmd_e + 1;
 		}
 
-		// check if bytes are left after parsing and move them to beginning
-		if ((int) (cmd_e - beg_it) < r_bytes) {
-			offset = r_bytes - (int) (cmd_e - beg_it);
-			std::copy(cmd_e, cmd_e + offset, data_buffer.begin());
-		} else {
-			offset = 0;
+		// move the bytes left after parsing to the beginning
+		if (cmd_e != beg_it) {
+			std::vector<char>::iterator left_it =
+					std::copy(cmd_e, end_it, beg_it);
+			std::fill(left_it, end_it, '\0');
+			end_it = left_it;
+			cmd_e = beg_it;
+			p_interpreter->resetResponseSearch();
+		} else if (end_it - beg_it >= MAX_READ_BYTES) {
+			// no response in a full buffer: discard it
+			std::fill(beg_it, end_it, '\0');
+			end_it = beg_it;
+			p_interpreter->resetResponseSearch();
 		}
 	}
 }
@@ -742,7 +761,7 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			std::function<void(UwModem &, Packet * p)> callback =
 					&UwModem::recv;
 			ModemEvent e = {callback, p};
-			event_q.push(e);
+			pushEvent(e);
 			break;
 		}
 		case UwInterpreterS2C::Response::RECV: {
@@ -755,7 +774,7 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			std::function<void(UwModem &, Packet * p)> callback =
 					&UwModem::recv;
 			ModemEvent e = {callback, p};
-			event_q.push(e);
+			pushEvent(e);
 			break;
 		}
 		case UwInterpreterS2C::Response::OK: {
@@ -0,0 +1,295 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file    uwinterpreters2c-replay.cpp
+ * @version 1.0.0
+ * @brief   Check program that replays a recorded S2C transcript through
+ *          UwInterpreterS2C, matching the responses with the single-pass
+ *          findResponse() and with the sequential search it replaced.
+ */
+
+#include <uwinterpreters2c.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+
+const int DATA_BUFFER_LEN = 4096; /**< Default buffer_size of the modem. */
+const int MAX_READ_BYTES = 1024; /**< Default max_read_size of the modem. */
+const int REPEAT = 2000; /**< Replays timed for each search. */
+
+typedef std::vector<char>::iterator Iter;
+
+/**
+ * Response parsed during a replay.
+ */
+struct Parsed {
+	UwInterpreterS2C::Response rsp;
+	std::string text;
+	std::string payload;
+
+	bool
+	operator==(const Parsed &other) const
+	{
+		return rsp == other.rsp && text == other.text &&
+				payload == other.payload;
+	}
+};
+
+/**
+ * Search of the S2C responses used before findResponse() moved to a single
+ * pass: one std::search for each token of the syntax pool.
+ */
+UwInterpreterS2C::Response
+sequentialFind(UwInterpreterS2C &, Iter beg, Iter end, Iter &rsp)
+{
+	UwInterpreterS2C::Response cmd = UwInterpreterS2C::Response::NO_COMMAND;
+	Iter first = end;
+
+	for (auto &entry : UwInterpreterS2C::getSyntaxPool()) {
+		auto it = std::search(
+				beg, end, entry.first.begin(), entry.first.end());
+		if (it < first) {
+			first = it;
+			cmd = entry.second;
+		}
+	}
+	rsp = first;
+
+	return cmd;
+}
+
+UwInterpreterS2C::Response
+singlePassFind(UwInterpreterS2C &interpreter, Iter beg, Iter end, Iter &rsp)
+{
+	return interpreter.findResponse(beg, end, rsp);
+}
+
+/**
+ * Modem that reads the transcript in chunks of at most \e chunk bytes.
+ */
+class TranscriptDevice
+{
+public:
+	TranscriptDevice(const std::string &data, int chunk)
+		: data(data)
+		, chunk(chunk)
+		, pos(0)
+	{
+	}
+
+	int
+	readFromDevice(char *buf, int max)
+	{
+		int n = std::min(std::min(max, chunk), (int) (data.size() - pos));
+		if (n <= 0)
+			return 0;
+		memcpy(buf, data.data() + pos, n);
+		pos += n;
+		return n;
+	}
+
+	bool
+	exhausted() const
+	{
+		return pos >= data.size();
+	}
+
+private:
+	const std::string &data;
+	int chunk;
+	size_t pos;
+};
+
+/**
+ * Replay the transcript with the receive loop of
+ * UwEvoLogicsS2CModem::receivingData, using \e find to locate the responses.
+ */
+template <typename Find>
+std::vector<Parsed>
+replay(const std::string &transcript, int chunk, Find find)
+{
+	UwInterpreterS2C interpreter;
+	TranscriptDevice device(transcript, chunk);
+	std::vector<Parsed> parsed;
+	std::vector<char> data_buffer(DATA_BUFFER_LEN, '\0');
+	Iter beg_it = data_buffer.begin();
+	Iter end_it = data_buffer.begin();
+	Iter cmd_b = data_buffer.begin();
+	Iter cmd_e = data_buffer.begin();
+	UwInterpreterS2C::Response cmd;
+	std::string rx_payload;
+
+	interpreter.resetResponseSearch();
+
+	while (!device.exhausted()) {
+		int r_bytes = device.readFromDevice(
+				&(*end_it), MAX_READ_BYTES - (int) (end_it - beg_it));
+		if (r_bytes > 0)
+			end_it += r_bytes;
+
+		while (r_bytes > 0 &&
+				(cmd = find(interpreter, cmd_e, end_it, cmd_b)) !=
+						UwInterpreterS2C::Response::NO_COMMAND) {
+
+			while (!interpreter.parseResponse(
+					cmd, end_it, cmd_b, cmd_e, rx_payload)) {
+				if (end_it - beg_it >= MAX_READ_BYTES && cmd_b != beg_it) {
+					Iter left_it = std::copy(cmd_b, end_it, beg_it);
+					std::fill(left_it, end_it, '\0');
+					end_it = left_it;
+					cmd_b = beg_it;
+					interpreter.resetResponseSearch();
+				}
+				int new_r_bytes = device.readFromDevice(&(*end_it),
+						MAX_READ_BYTES - (int) (end_it - beg_it));
+				if (new_r_bytes <= 0)
+					return parsed;
+				end_it += new_r_bytes;
+			}
+
+			Parsed p;
+			p.rsp = cmd;
+			p.text = std::string(cmd_b, cmd_e);
+			p.payload = rx_payload;
+			parsed.push_back(p);
+			rx_payload.clear();
+			std::fill(cmd_b, cmd_e, '\0');
+		}
+
+		if (cmd_e != beg_it) {
+			Iter left_it = std::copy(cmd_e, end_it, beg_it);
+			std::fill(left_it, end_it, '\0');
+			end_it = left_it;
+			cmd_e = beg_it;
+			interpreter.resetResponseSearch();
+		} else if (end_it - beg_it >= MAX_READ_BYTES) {
+			std::fill(beg_it, end_it, '\0');
+			end_it = beg_it;
+			interpreter.resetResponseSearch();
+		}
+	}
+
+	return parsed;
+}
+
+/**
+ * Time \e REPEAT replays of the transcript, in microseconds per replay.
+ */
+template <typename Find>
+double
+timeReplay(const std::string &transcript, int chunk, Find find)
+{
+	size_t count = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < REPEAT; i++)
+		count += replay(transcript, chunk, find).size();
+	auto stop = std::chrono::steady_clock::now();
+	if (count == 0)
+		return 0;
+	return std::chrono::duration<double, std::micro>(stop - start).count() /
+			REPEAT;
+}
+
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+	std::string path;
+	if (argc > 1) {
+		path = argv[1];
+	} else {
+		const char *srcdir = getenv("srcdir");
+		path = std::string(srcdir ? srcdir : ".") +
+				"/uwinterpreters2c-transcript.log";
+	}
+
+	std::ifstream in(path.c_str(), std::ios::binary);
+	if (!in) {
+		std::cerr << "Cannot open the transcript " << path << std::endl;
+		return 1;
+	}
+	std::stringstream ss;
+	ss << in.rdbuf();
+	std::string transcript = ss.str();
+
+	// the reads of the modem may split the responses at any byte, the
+	// parsed responses must not depend on it
+	const int chunks[] = {1, 3, 16, 64, MAX_READ_BYTES};
+	int failures = 0;
+	std::vector<Parsed> reference;
+	for (int chunk : chunks) {
+		std::vector<Parsed> expected =
+				replay(transcript, chunk, sequentialFind);
+		std::vector<Parsed> actual = replay(transcript, chunk, singlePassFind);
+		if (reference.empty())
+			reference = expected;
+
+		if (expected.empty() || !(expected == reference)) {
+			std::cerr << "Reads of " << chunk << " bytes: " << expected.size()
+					  << " responses with the sequential search, "
+					  << reference.size() << " with reads of " << chunks[0]
+					  << " byte" << std::endl;
+			failures++;
+		} else if (!(expected == actual)) {
+			size_t i = 0;
+			while (i < expected.size() && i < actual.size() &&
+					expected[i] == actual[i])
+				i++;
+			std::cerr << "Reads of " << chunk << " bytes: " << expected.size()
+					  << " responses with the sequential search, "
+					  << actual.size() << " with the single pass, first "
+					  << "difference at response " << i << std::endl;
+			failures++;
+		}
+	}
+	if (failures > 0)
+		return 1;
+
+	double seq = timeReplay(transcript, 64, sequentialFind);
+	double single = timeReplay(transcript, 64, singlePassFind);
+	std::cout << "Replayed " << transcript.size() << " bytes, "
+			  << reference.size()
+			  << " responses, reads of 64 bytes" << std::endl;
+	std::cout << "  sequential search: " << seq << " us per replay"
+			  << std::endl;
+	std::cout << "  single pass:       " << single << " us per replay"
+			  << std::endl;
+
+	return 0;
+}
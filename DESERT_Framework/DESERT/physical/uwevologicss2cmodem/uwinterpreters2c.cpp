@@ -78,6 +78,12 @@ UwInterpreterS2C::UwInterpreterS2C()
 	, w_term("\n")
 	, ext_proto_mode(false)
 	, usbl_info(nullptr)
+	, search_active(false)
+	, search_beg()
+	, search_pos(0)
+	, search_state(0)
+	, match_pos(-1)
+	, match_token(-1)
 {
 	usbl_info = std::make_shared<USBLInfo>();
 }
@@ -218,30 +224,127 @@ UwInterpreterS2C::buildSetATAL(int addr)
 	return cmd;
 }
 
-UwInterpreterS2C::Response
-UwInterpreterS2C::findResponse(std::vector<char>::iterator beg,
-		std::vector<char>::iterator end, std::vector<char>::iterator &rsp)
+const UwInterpreterS2C::SyntaxMachine &
+UwInterpreterS2C::getSyntaxMachine()
 {
+	static const SyntaxMachine machine = []() {
+		SyntaxMachine m;
+		// bytes that do not appear in any token share class 0
+		std::fill(m.byte_class, m.byte_class + 256, 0);
+		m.classes = 1;
+		m.max_len = 0;
+		for (auto &entry : syntax_pool) {
+			for (unsigned char c : entry.first) {
+				if (m.byte_class[c] == 0)
+					m.byte_class[c] = m.classes++;
+			}
+			m.max_len = std::max(m.max_len, (int) entry.first.size());
+		}
 
-	Response cmd = Response::NO_COMMAND;
-	std::vector<char>::iterator first = end;
+		// trie of the tokens, -1 marks a missing transition
+		m.next.assign(m.classes, -1);
+		m.token.assign(1, -1);
+		for (uint i = 0; i < syntax_pool.size(); i++) {
+			int state = 0;
+			for (unsigned char c : syntax_pool[i].first) {
+				int &next = m.next[state * m.classes + m.byte_class[c]];
+				if (next < 0) {
+					next = m.token.size();
+					m.next.resize(m.next.size() + m.classes, -1);
+					m.token.push_back(-1);
+				}
+				state = m.next[state * m.classes + m.byte_class[c]];
+			}
+			// with duplicated tokens the first one wins, as in a linear scan
+			if (m.token[state] < 0)
+				m.token[state] = i;
+		}
 
-	for (uint i = 0; i < syntax_pool.size(); i++) {
+		// failure links, in breadth first order
+		std::vector<int> fail(m.token.size(), 0);
+		std::vector<int> queue;
+		for (int c = 0; c < m.classes; c++) {
+			int &next = m.next[c];
+			if (next < 0) {
+				next = 0;
+			} else {
+				queue.push_back(next);
+			}
+		}
+		for (uint q = 0; q < queue.size(); q++) {
+			int state = queue[q];
+			if (m.token[state] < 0)
+				m.token[state] = m.token[fail[state]];
+			for (int c = 0; c < m.classes; c++) {
+				int &next = m.next[state * m.classes + c];
+				int fallback = m.next[fail[state] * m.classes + c];
+				if (next < 0) {
+					next = fallback;
+				} else {
+					fail[next] = fallback;
+					queue.push_back(next);
+				}
+			}
+		}
+		return m;
+	}();
 
-		auto it = std::search(beg,
-				end,
-				syntax_pool[i].first.begin(),
-				syntax_pool[i].first.end());
+	return machine;
+}
 
-		if (it < first) {
-			first = it;
-			cmd = syntax_pool[i].second;
+UwInterpreterS2C::Response
+UwInterpreterS2C::findResponse(std::vector<char>::iterator beg,
+		std::vector<char>::iterator end, std::vector<char>::iterator &rsp)
+{
+	const SyntaxMachine &machine = getSyntaxMachine();
+
+	long len = end - beg;
+	if (!search_active || beg != search_beg || len < search_pos) {
+		search_active = true;
+		search_beg = beg;
+		search_pos = 0;
+		search_state = 0;
+		match_pos = -1;
+		match_token = -1;
+	}
+
+	// The response that begins first wins and, among the ones beginning at
+	// the same byte, the first one of syntax_pool. Once a token is found,
+	// only the bytes that may end an earlier token are scanned.
+	long pos = search_pos;
+	int state = search_state;
+	for (; pos < len; pos++) {
+		if (match_pos >= 0 && pos - machine.max_len >= match_pos)
+			break;
+		unsigned char c = beg[pos];
+		state = machine.next[state * machine.classes + machine.byte_class[c]];
+		int token = machine.token[state];
+		if (token >= 0) {
+			long start = pos + 1 - syntax_pool[token].first.size();
+			if (match_pos < 0 || start < match_pos ||
+					(start == match_pos && token < match_token)) {
+				match_pos = start;
+				match_token = token;
+			}
 		}
+	}
+	search_pos = pos;
+	search_state = state;
 
-		rsp = first;
+	if (match_pos < 0) {
+		rsp = end;
+		return Response::NO_COMMAND;
 	}
 
-	return cmd;
+	search_active = false;
+	rsp = beg + match_pos;
+	return syntax_pool[match_token].second;
+}
+
+void
+UwInterpreterS2C::resetResponseSearch()
+{
+	search_active = false;
 }
 
 bool
@@ -359,7 +462,10 @@ UwInterpreterS2C::parseResponse(Response rsp, std::vector<char>::iterator end,
 				return false;
 			}
 			rsp_end = payload_beg + len;
-
+			// the payload and its terminator must be complete
+			if (end - rsp_end < (long) r_term.size()) {
+				return false;
+			}
 			auto term_beg =
 					std::search(rsp_end, end, r_term.begin(), r_term.end());
 			if (rsp_end != term_beg) {
@@ -478,6 +584,10 @@ UwInterpreterS2C::parseResponse(Response rsp, std::vector<char>::iterator end,
 				return false;
 			}
 			rsp_end = payload_beg + len;
+			// the payload and its terminator must be complete
+			if (end - rsp_end < (long) r_term.size()) {
+				return false;
+			}
 			auto term_beg =
 					std::search(rsp_end, end, r_term.begin(), r_term.end());
 			if (rsp_end != term_beg) {
@@ -1307,3 +1417,9 @@ UwInterpreterS2C::getUSBLInfo()
 {
 	return usbl_info;
 }
+
+const std::vector<std::pair<std::string, UwInterpreterS2C::Response>> &
+UwInterpreterS2C::getSyntaxPool()
+{
+	return syntax_pool;
+}
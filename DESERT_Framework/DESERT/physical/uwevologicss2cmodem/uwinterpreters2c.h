@@ -193,6 +193,11 @@ public:
 	/**
 	 * Method to look for S2C response inside a provided chunk of unparsed data
 	 * This method only finds the beginning of the returned response,not the end
+	 * All the responses are searched in a single pass. If no response is
+	 * found, the next call with the same beg resumes the search from the
+	 * first byte not scanned yet, so a section can be searched again while
+	 * it grows: the bytes already scanned must not be modified meanwhile,
+	 * otherwise resetResponseSearch() has to be called.
 	 * @param beg iterator to beginning of search section
 	 * @param end iterator to end of search section
 	 * @param rsp output iterator first response found
@@ -202,6 +207,12 @@ public:
 	UwInterpreterS2C::Response findResponse(std::vector<char>::iterator beg,
 			std::vector<char>::iterator end, std::vector<char>::iterator &rsp);
 
+	/**
+	 * Method that discards the state of a search started by findResponse(),
+	 * to be called when the bytes of the search section are moved.
+	 */
+	void resetResponseSearch();
+
 	/**
 	 * Method that tries to parse a found response: if the response section
 	 * of the buffer, which needs to be passed, is found to be incomplete,
@@ -234,6 +245,15 @@ public:
 	 */
 	std::shared_ptr<USBLInfo> getUSBLInfo();
 
+	/**
+	 * Method to retrieve the tokens of the S2C responses, in the order used
+	 * by findResponse() to choose among responses beginning at the same byte
+	 * @return the tokens and the corresponding responses
+	 */
+	static const std::vector<std::pair<std::string,
+			UwInterpreterS2C::Response>> &
+	getSyntaxPool();
+
 	/** Method that sets the terminator for the AT commands wrtten to device
 	 * @param[in] terminator type of the terminator
 	 */
@@ -261,6 +281,34 @@ private:
 	 */
 	static std::vector<std::pair<std::string, UwInterpreterS2C::Response>>
 			syntax_pool;
+
+	/**
+	 * State machine that recognizes all the tokens of syntax_pool at once:
+	 * an Aho-Corasick automaton whose failure links are resolved in the
+	 * transition table, so each byte costs a single lookup.
+	 */
+	struct SyntaxMachine {
+		unsigned char byte_class[256]; /**< Class of each byte value.*/
+		int classes; /**< Number of byte classes.*/
+		std::vector<int> next; /**< Next state for each state and class.*/
+		std::vector<int> token; /**< Index in syntax_pool of the longest
+								  token ending in each state, -1 if none.*/
+		int max_len; /**< Length of the longest token.*/
+	};
+
+	/**
+	 * Method that returns the state machine of syntax_pool, built on first
+	 * use.
+	 * @return the state machine
+	 */
+	static const SyntaxMachine &getSyntaxMachine();
+
+	bool search_active; /**< True if a search can be resumed.*/
+	std::vector<char>::iterator search_beg; /**< Beginning of the search.*/
+	long search_pos; /**< Number of bytes scanned by the search.*/
+	int search_state; /**< State of the machine after the scanned bytes.*/
+	long match_pos; /**< Offset of the first token found, -1 if none.*/
+	int match_token; /**< Index in syntax_pool of the first token found.*/
 };
 
 #endif
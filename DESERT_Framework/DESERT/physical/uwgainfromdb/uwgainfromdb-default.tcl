@@ -35,3 +35,5 @@ Module/UW/GAINFROMDB set depth_roughness_ 1
 Module/UW/GAINFROMDB set distance_roughness_ 1
 Module/UW/GAINFROMDB set total_time_ 1
 Module/UW/GAINFROMDB set frequency_correction_factor_ 1
+Module/UW/GAINFROMDB set use_binary_cache_ 0
+Module/UW/GAINFROMDB set ber_table_step_dB_ 0
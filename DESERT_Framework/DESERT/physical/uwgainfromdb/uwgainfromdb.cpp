@@ -55,7 +55,8 @@ public:
 } class_UnderwaterGainFromDb;
 
 UnderwaterGainFromDb::UnderwaterGainFromDb()
-	: time_roughness_(1)
+	: use_binary_cache_(0)
+	, time_roughness_(1)
 	, depth_roughness_(1)
 	, distance_roughness_(1)
 	, total_time_(1)
@@ -66,6 +67,7 @@ UnderwaterGainFromDb::UnderwaterGainFromDb()
 	bind("distance_roughness_", &distance_roughness_);
 	bind("total_time_", &total_time_);
 	bind("frequency_correction_factor_", &frequency_correction_factor_);
+	bind("use_binary_cache_", &use_binary_cache_);
 	bind_error("token_separator_", &token_separator_);
 	token_separator_ = '\t';
 	path_ = "";
@@ -85,6 +87,12 @@ UnderwaterGainFromDb::command(int argc, const char *const *argv)
 			}
 			return TCL_OK;
 		}
+	} else if (argc == 2) {
+		if (strcasecmp(argv[1], "getLoadedGainMaps") == 0) {
+			Tcl &tcl = Tcl::instance();
+			tcl.resultf("%d", UwGainMapDb::getLoadedMaps());
+			return TCL_OK;
+		}
 	}
 	return UnderwaterPhysical::command(argc, argv);
 } /* UnderwaterGainFromDb::command */
@@ -119,6 +127,16 @@ UnderwaterGainFromDb::getPER(double _snr, int _nbits, Packet *p)
 	return UnderwaterPhysical::getPER(snir_, _nbits, p);
 } /* UnderwaterGainFromDb::getPER */
 
+void
+UnderwaterGainFromDb::getBatchPER(const double *snr, const int *nbits, int n,
+		Packet *p, double *per, double *ber)
+{
+	for (int i = 0; i < n; i++) {
+		per[i] = getPER(snr[i], nbits[i], p);
+		ber[i] = getPER(snr[i], 1, p);
+	}
+} /* UnderwaterGainFromDb::getBatchPER */
+
 void
 UnderwaterGainFromDb::setTimeRoughness(const int &_time)
 {
@@ -192,47 +210,12 @@ double
 UnderwaterGainFromDb::retriveGainFromFile(const string &_file_name,
 		const int &_row_index, const int &_column_index) const
 {
-	int row_iterator_ = 0;
-	int column_iterator_ = 0;
-	ifstream input_file_;
-	istringstream stm;
-	string line_;
-	string token_;
-	string value_;
-	double return_value_;
-
-	char *tmp_ = new char[_file_name.length() + 1];
-	strcpy(tmp_, _file_name.c_str());
-	if (tmp_ == NULL) {
-		fprintf(stderr, "Empty string for the file name");
-	}
-
-	input_file_.open(tmp_);
-	if (input_file_.is_open()) {
-		while (std::getline(input_file_, line_)) {
-			row_iterator_++;
-			if (row_iterator_ == _row_index) {
-				break;
-			}
-		}
-	} else {
-		cerr << "Impossible to open file " << _file_name << endl;
-	}
-
-	istringstream iss(line_);
-	while (getline(iss, token_, token_separator_)) {
-		column_iterator_++;
-		if (column_iterator_ == _column_index) {
-			value_ = token_;
-		}
-	}
-
-	stm.str(value_);
-	stm >> return_value_;
+	const UwGainMap &map_ = UwGainMapDb::getMap(
+			_file_name, token_separator_, use_binary_cache_ != 0);
+	double return_value_ = map_.get(_row_index, _column_index);
 	//    cout << "file:" << _file_name << ":column:" << _column_index <<
 	//    ":row:" << _row_index << ":gain:" << return_value_ << endl;
 
-	delete[] tmp_;
 	if (this->isZero(return_value_)) {
 		return (-INT_MAX);
 	} else {
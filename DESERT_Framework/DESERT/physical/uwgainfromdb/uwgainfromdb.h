@@ -39,6 +39,7 @@
 #ifndef UWGAINFROMDB_H
 #define UWGAINFROMDB_H
 
+#include "uwgainmapdb.h"
 #include <uwphysical.h>
 
 #include <module.h>
@@ -66,6 +67,7 @@ public:
 
 	/**
 	 * TCL command interpreter. It implements the following OTcl methods:
+	 * path and getLoadedGainMaps.
 	 *
 	 * @param argc Number of arguments in <i>argv</i>.
 	 * @param argv Array of strings which are the command parameters (Note that
@@ -90,6 +92,20 @@ protected:
 	 */
 	virtual double getPER(double snr, int nbits, Packet *p);
 
+	/**
+	 * Computes the PER and BER of each chunk with getPER, since the SNR is
+	 * obtained from the gain stored in the database.
+	 *
+	 * @param snr SNR of each chunk.
+	 * @param nbits Length in bits of each chunk.
+	 * @param n Number of chunks.
+	 * @param p Packet the chunks belong to.
+	 * @param per PER of each chunk (output).
+	 * @param ber BER of each chunk (output).
+	 */
+	virtual void getBatchPER(const double *snr, const int *nbits, int n,
+			Packet *p, double *per, double *ber);
+
 	/**
 	 * Sets the time_roughness_ parameter.
 	 *
@@ -192,11 +208,13 @@ protected:
 			const double &, const double &, const double &, const double &);
 
 	/**
+	 * Reads a value of a gain map. The file is loaded in memory the first
+	 * time it is used and shared by all the nodes.
 	 *
-	 * @param
-	 * @param
-	 * @param
-	 * @return
+	 * @param _file_name name of the file
+	 * @param _row_index index of the row, starting from 1
+	 * @param _column_index index of the column, starting from 1
+	 * @return the value read, -INT_MAX if it is zero or missing
 	 */
 	virtual double retriveGainFromFile(
 			const string &, const int &, const int &) const;
@@ -232,6 +250,8 @@ protected:
 	char token_separator_; /**< Token used to parse the elements in a line of
 							  the database. */
 	ostringstream osstream_; /**< Used to create strings. */
+	int use_binary_cache_; /**< If 1 the gain maps are cached in binary files
+							  next to the text ones. */
 
 private:
 	// Variables
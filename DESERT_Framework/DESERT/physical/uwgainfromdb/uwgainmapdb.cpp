@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwgainmapdb.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwGainMap and UwGainMapDb classes.
+ *
+ */
+
+#include "uwgainmapdb.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Header of the binary cache files, followed by rows * columns floats.
+ */
+struct UwGainMapHeader {
+	char magic[4]; /**< Always "UWGM". */
+	int version; /**< Version of the layout. */
+	int rows; /**< Number of rows. */
+	int columns; /**< Number of columns. */
+};
+
+static const char GAINMAP_MAGIC[4] = {'U', 'W', 'G', 'M'};
+static const int GAINMAP_VERSION = 1;
+
+std::map<std::string, UwGainMap *> UwGainMapDb::maps_;
+
+UwGainMap::UwGainMap()
+	: rows_(0)
+	, columns_(0)
+	, data_(NULL)
+	, values_()
+	, mapped_(NULL)
+	, mapped_size_(0)
+{
+}
+
+UwGainMap::~UwGainMap()
+{
+	unmap();
+}
+
+void
+UwGainMap::unmap()
+{
+	if (mapped_ != NULL) {
+		munmap(mapped_, mapped_size_);
+		mapped_ = NULL;
+		mapped_size_ = 0;
+	}
+}
+
+bool
+UwGainMap::loadText(const std::string &file_name, char separator)
+{
+	std::ifstream input_file_(file_name.c_str());
+	if (!input_file_.is_open())
+		return false;
+
+	std::vector<std::vector<float> > lines_;
+	std::string line_;
+	size_t max_columns_ = 0;
+	while (std::getline(input_file_, line_)) {
+		lines_.push_back(std::vector<float>());
+		std::vector<float> &cells_ = lines_.back();
+		// Same tokens of getline() with the separator: a trailing separator
+		// does not open a new column
+		size_t begin_ = 0;
+		while (begin_ < line_.size()) {
+			size_t end_ = line_.find(separator, begin_);
+			if (end_ == std::string::npos)
+				end_ = line_.size();
+			std::string token_ = line_.substr(begin_, end_ - begin_);
+			cells_.push_back((float) strtod(token_.c_str(), NULL));
+			begin_ = end_ + 1;
+		}
+		if (cells_.size() > max_columns_)
+			max_columns_ = cells_.size();
+	}
+
+	unmap();
+	rows_ = lines_.size();
+	columns_ = max_columns_;
+	values_.assign((size_t) rows_ * columns_, 0);
+	for (int r = 0; r < rows_; r++)
+		std::copy(lines_[r].begin(),
+				lines_[r].end(),
+				values_.begin() + (size_t) r * columns_);
+	data_ = values_.empty() ? NULL : &values_[0];
+	return true;
+}
+
+bool
+UwGainMap::loadBinary(const std::string &file_name)
+{
+	int fd = open(file_name.c_str(), O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if (fstat(fd, &st) < 0 || st.st_size < (off_t) sizeof(UwGainMapHeader)) {
+		close(fd);
+		return false;
+	}
+	void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (addr == MAP_FAILED)
+		return false;
+
+	const UwGainMapHeader *hdr = (const UwGainMapHeader *) addr;
+	size_t cells = (size_t) hdr->rows * hdr->columns;
+	if (memcmp(hdr->magic, GAINMAP_MAGIC, sizeof(GAINMAP_MAGIC)) != 0 ||
+			hdr->version != GAINMAP_VERSION || hdr->rows < 0 ||
+			hdr->columns < 0 ||
+			(size_t) st.st_size !=
+					sizeof(UwGainMapHeader) + cells * sizeof(float)) {
+		munmap(addr, st.st_size);
+		return false;
+	}
+
+	unmap();
+	values_.clear();
+	mapped_ = addr;
+	mapped_size_ = st.st_size;
+	rows_ = hdr->rows;
+	columns_ = hdr->columns;
+	data_ = (const float *) (hdr + 1);
+	return true;
+}
+
+bool
+UwGainMap::saveBinary(const std::string &file_name) const
+{
+	// Write to a temporary file, so that a concurrent run never maps a
+	// partial cache
+	std::string tmp_name_ = file_name + ".tmp";
+	std::ofstream output_file_(
+			tmp_name_.c_str(), std::ios::out | std::ios::binary);
+	if (!output_file_.is_open())
+		return false;
+
+	UwGainMapHeader hdr;
+	memcpy(hdr.magic, GAINMAP_MAGIC, sizeof(GAINMAP_MAGIC));
+	hdr.version = GAINMAP_VERSION;
+	hdr.rows = rows_;
+	hdr.columns = columns_;
+	output_file_.write((const char *) &hdr, sizeof(hdr));
+	if (data_ != NULL)
+		output_file_.write((const char *) data_,
+				(size_t) rows_ * columns_ * sizeof(float));
+	output_file_.close();
+	if (output_file_.fail() ||
+			rename(tmp_name_.c_str(), file_name.c_str()) != 0) {
+		unlink(tmp_name_.c_str());
+		return false;
+	}
+	return true;
+}
+
+const UwGainMap &
+UwGainMapDb::getMap(
+		const std::string &file_name, char separator, bool binary_cache)
+{
+	std::map<std::string, UwGainMap *>::iterator it = maps_.find(file_name);
+	if (it != maps_.end())
+		return *(it->second);
+
+	UwGainMap *map_ = new UwGainMap();
+	maps_[file_name] = map_;
+
+	std::string cache_name_ = file_name + ".bin";
+	if (binary_cache) {
+		struct stat text_st;
+		struct stat cache_st;
+		bool has_text_ = stat(file_name.c_str(), &text_st) == 0;
+		bool has_cache_ = stat(cache_name_.c_str(), &cache_st) == 0;
+		if (has_cache_ &&
+				(!has_text_ || cache_st.st_mtime >= text_st.st_mtime) &&
+				map_->loadBinary(cache_name_))
+			return *map_;
+	}
+
+	if (!map_->loadText(file_name, separator)) {
+		std::cerr << "Impossible to open file " << file_name << std::endl;
+		return *map_;
+	}
+
+	if (binary_cache && !map_->saveBinary(cache_name_))
+		std::cerr << "Impossible to write the cache file " << cache_name_
+				  << std::endl;
+	return *map_;
+}
@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwgainmapdb.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwGainMap and UwGainMapDb classes, an in-memory
+ * store of the gain maps read by UnderwaterGainFromDb and
+ * UnderwaterPhysicalfromdb.
+ *
+ */
+
+#ifndef UWGAINMAPDB_H
+#define UWGAINMAPDB_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Dense table of a gain map file, stored row by row. Rows and columns are
+ * numbered from 1, as in the lookups of the text files, and the cells that
+ * are missing in the file are set to 0.
+ */
+class UwGainMap
+{
+public:
+	/**
+	 * Constructor of UwGainMap class, the map is empty.
+	 */
+	UwGainMap();
+
+	/**
+	 * Destructor of UwGainMap class, it releases the mapped cache file.
+	 */
+	~UwGainMap();
+
+	/**
+	 * Returns the value of a cell.
+	 *
+	 * @param row Index of the row, starting from 1
+	 * @param column Index of the column, starting from 1
+	 * @return value of the cell, 0 if the cell is not in the map
+	 */
+	inline float
+	get(int row, int column) const
+	{
+		if (row < 1 || row > rows_ || column < 1 || column > columns_)
+			return 0;
+		return data_[(row - 1) * columns_ + (column - 1)];
+	}
+
+	/**
+	 * Parses a text gain map, tokens are split by the given separator.
+	 *
+	 * @param file_name Name of the text file
+	 * @param separator Token separator of the lines
+	 * @return <i>true</i> if the file has been read, <i>false</i> otherwise
+	 */
+	bool loadText(const std::string &file_name, char separator);
+
+	/**
+	 * Maps a binary cache file written by saveBinary().
+	 *
+	 * @param file_name Name of the cache file
+	 * @return <i>true</i> if the file is a valid cache, <i>false</i> otherwise
+	 */
+	bool loadBinary(const std::string &file_name);
+
+	/**
+	 * Writes the map to a binary cache file.
+	 *
+	 * @param file_name Name of the cache file
+	 * @return <i>true</i> if the file has been written, <i>false</i> otherwise
+	 */
+	bool saveBinary(const std::string &file_name) const;
+
+	/**
+	 * @return number of rows of the map
+	 */
+	inline int
+	getRows() const
+	{
+		return rows_;
+	}
+
+	/**
+	 * @return number of columns of the map
+	 */
+	inline int
+	getColumns() const
+	{
+		return columns_;
+	}
+
+private:
+	/**
+	 * Releases the mapped cache file, if any.
+	 */
+	void unmap();
+
+	int rows_; /**< Number of rows of the map. */
+	int columns_; /**< Number of columns of the map. */
+	const float *data_; /**< Cells of the map, row by row. */
+	std::vector<float> values_; /**< Cells parsed from a text file. */
+	void *mapped_; /**< Address of the mapped cache file. */
+	size_t mapped_size_; /**< Size of the mapped cache file. */
+
+	UwGainMap(const UwGainMap &);
+	UwGainMap &operator=(const UwGainMap &);
+};
+
+/**
+ * Process wide store of the gain maps. Each file is loaded the first time it
+ * is requested and then shared by all the nodes of the simulation.
+ */
+class UwGainMapDb
+{
+public:
+	/**
+	 * Returns the map of a file, loading it if needed. If the binary cache is
+	 * enabled, the map is read from <i>file_name</i>.bin when it is not older
+	 * than the text file, otherwise the cache is written after the text file
+	 * has been parsed.
+	 *
+	 * @param file_name Name of the text file
+	 * @param separator Token separator of the lines
+	 * @param binary_cache <i>true</i> to use the binary cache file
+	 * @return the map, empty if the file cannot be read
+	 */
+	static const UwGainMap &getMap(
+			const std::string &file_name, char separator, bool binary_cache);
+
+	/**
+	 * @return number of maps loaded so far
+	 */
+	static inline int
+	getLoadedMaps()
+	{
+		return maps_.size();
+	}
+
+private:
+	static std::map<std::string, UwGainMap *> maps_; /**< Loaded maps. */
+};
+
+#endif /* UWGAINMAPDB_H */
@@ -40,3 +40,4 @@ Module/UW/HERMES/PHY  set BCH_K               11
 Module/UW/HERMES/PHY  set BCH_T               1
 
 Module/UW/HERMES/PHY  set FRAME_BIT           9152
+Module/UW/HERMES/PHY  set ber_table_step_dB_  0
@@ -67,6 +67,7 @@ UwHermesPhy::UwHermesPhy()
 	: UnderwaterPhysical()
 	, pdr_file_name_("dbs/hermes/default.csv")
 	, pdr_token_separator_('\t')
+	, range2pdr_(&UwLut::emptyLut())
 	, initLUT_(false)
 { // binding to TCL variables
 	bind("BCH_N", &BCH_N);
@@ -113,28 +114,13 @@ UwHermesPhy::command(int argc, const char *const *argv)
 void
 UwHermesPhy::initializeLUT()
 {
-	ifstream input_file_;
-	string line_;
-	char *tmp_ = new char[pdr_file_name_.length() + 1];
-	strcpy(tmp_, pdr_file_name_.c_str());
-	input_file_.open(tmp_);
-	if (input_file_.is_open()) {
-		// skip first 2 lines
-		if (debug_)
-			std::cout << "UwHermesPhy::initializeLUT()" << endl;
-		while (std::getline(input_file_, line_)) {
-			// TODO: retrive the right row and break the loop
-			::std::stringstream line_stream(line_);
-			double d;
-			double p;
-			line_stream >> d;
-			line_stream >> p;
-			range2pdr_[d] = p;
-			if (debug_)
-				std::cout << d << " " << p << endl;
-		}
-	} else {
-		cerr << "Impossible to open file " << pdr_file_name_ << endl;
+	if (debug_)
+		std::cout << "UwHermesPhy::initializeLUT()" << endl;
+	range2pdr_ = &UwLut::getLut(pdr_file_name_, pdr_token_separator_);
+	if (debug_) {
+		for (int i = 0; i < range2pdr_->size(); i++)
+			std::cout << range2pdr_->getKey(i) << " "
+					  << range2pdr_->getValue(i) << endl;
 	}
 	initLUT_ = true;
 }
@@ -163,11 +149,12 @@ UwHermesPhy::endRx(Packet *p)
 			bool error_ni = 0;
 			if (!error_n) {
 				if (interference_) {
+					const InterferenceResult &interf =
+							interference_->getInterference(p);
 					if (Interference_Model == "MEANPOWER") { // only meanpower
 															 // is allow in
 															 // Hermesphy
-						double interference =
-								interference_->getInterferencePower(p);
+						double interference = interf.power;
 						per_ni = interference > 0; // the Hermes interference
 												   // model is unknown, thus it
 												   // is taken as always
@@ -180,7 +167,7 @@ UwHermesPhy::endRx(Packet *p)
 								  << std::endl;
 						exit(1);
 					}
-					interferent_pkts = interference_->getCounters(p);
+					interferent_pkts = interf.counters;
 
 				} else {
 					per_ni = getPER(ph->Pr / (ph->Pn + ph->Pi),
@@ -281,17 +268,16 @@ UwHermesPhy::matchPS(double distance, int size)
 				  << "  UwHermesPhy()::matchPS(double distance, int size)"
 				  << "distance = " << distance << " packet size = " << size
 				  << std::endl;
-	if (distance <= range2pdr_.begin()->first)
-		return chunckInterpolator(range2pdr_.begin()->second, size);
+	if (distance <= range2pdr_->getKey(0))
+		return chunckInterpolator(range2pdr_->getValue(0), size);
 
-	PdrLut::iterator it = range2pdr_.lower_bound(distance);
-	if (it == range2pdr_.end())
-		return chunckInterpolator((--it)->second, size);
-	double l_sup = it->first;
-	double p_sup = it->second;
-	it--;
-	double l_inf = it->first;
-	double p_inf = it->second;
+	int i = range2pdr_->lowerBound(distance);
+	if (i == range2pdr_->size())
+		return chunckInterpolator(range2pdr_->getValue(i - 1), size);
+	double l_sup = range2pdr_->getKey(i);
+	double p_sup = range2pdr_->getValue(i);
+	double l_inf = range2pdr_->getKey(i - 1);
+	double p_inf = range2pdr_->getValue(i - 1);
 	if (debug_) {
 		std::cout << " Distance between " << l_inf << " and " << l_sup;
 		std::cout << " Succ Prob between " << p_inf << " and " << p_sup;
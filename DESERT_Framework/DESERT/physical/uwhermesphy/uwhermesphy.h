@@ -41,11 +41,8 @@
 
 #include "uwphysical.h"
 #include <iostream>
-#include <map>
 #include <math.h>
-
-typedef ::std::map<double, double> PdrLut;
-typedef PdrLut::iterator PdrLutIt;
+#include <uwlut.h>
 
 class UwHermesPhy : public UnderwaterPhysical
 {
@@ -128,7 +125,7 @@ private:
 
 	string pdr_file_name_; // LUT file name
 	char pdr_token_separator_; // LUT token separator
-	PdrLut range2pdr_;
+	const UwLut *range2pdr_; // LUT pdr vs distance, shared by the nodes
 	bool initLUT_;
 
 	/**
@@ -33,3 +33,4 @@
 # import UwPhysical default values to mute tlc warnings
 Module/UW/HMMPHYSICAL set tx_power_consumption_ 3.3
 Module/UW/HMMPHYSICAL set rx_power_consumption_ 0.620
+Module/UW/HMMPHYSICAL set ber_table_step_dB_ 0
@@ -99,9 +99,12 @@ UnderwaterHMMPhysical::UnderwaterHMMPhysical()
 	, pkts_tot_good(0)
 	, pkts_tot_medium(0)
 	, pkts_tot_bad(0)
+	, hmm_stats_(nullptr)
 {
 	delete stats_ptr;
-	stats_ptr = new UwHMMPhysicalStats();
+	hmm_stats_ = new UwHMMPhysicalStats();
+	phy_stats_ = hmm_stats_;
+	stats_ptr = hmm_stats_;
 }
 
 UnderwaterHMMPhysical::~UnderwaterHMMPhysical()
@@ -188,9 +191,11 @@ UnderwaterHMMPhysical::endRx(Packet *p)
 				double chance_interf = RNG::defaultrng()->uniform_double();
 
 				if (interference_) {
+					const InterferenceResult &interf =
+							interference_->getInterference(
+									p, Interference_Model == "CHUNK");
 					if (Interference_Model == "CHUNK") {
-						const PowerChunkList &power_chunk_list =
-								interference_->getInterferencePowerChunkList(p);
+						const PowerChunkList &power_chunk_list = interf.chunks;
 						for (PowerChunkList::const_iterator itInterf =
 										power_chunk_list.begin();
 								itInterf != power_chunk_list.end();
@@ -209,7 +214,7 @@ UnderwaterHMMPhysical::endRx(Packet *p)
 							}
 						}
 					} else if (Interference_Model == "MEANPOWER") {
-						interf_power = interference_->getInterferencePower(p);
+						interf_power = interf.power;
 						sinr = ph->Pr / (ph->Pn + interf_power);
 						if (interf_power > 0.0) {
 							perr_interf =
@@ -222,7 +227,7 @@ UnderwaterHMMPhysical::endRx(Packet *p)
 								  << std::endl;
 						exit(1);
 					}
-					interferent_pkts = interference_->getCounters(p);
+					interferent_pkts = interf.counters;
 
 				} else {
 					interf_power = ph->Pi;
@@ -234,22 +239,17 @@ UnderwaterHMMPhysical::endRx(Packet *p)
 				} /* end of interference model */
 
 				/* update and trigger the modules that collect the stats */
-				auto uwphystats = dynamic_cast<UwHMMPhysicalStats *>(stats_ptr);
-				if (uwphystats) {
-					uwphystats->updateStats(getId(),
-							getStackId(),
-							ph->Pr,
-							ph->Pn,
-							interf_power,
-							sinr,
-							ber_hmm,
-							per_hmm,
-							(error_hmm || error_interf),
-							ch_state);
-				}
-
-				ClMsgTriggerStats m = ClMsgTriggerStats();
-				sendSyncClMsg(&m);
+				hmm_stats_->updateStats(getId(),
+						getStackId(),
+						ph->Pr,
+						ph->Pn,
+						interf_power,
+						sinr,
+						ber_hmm,
+						per_hmm,
+						(error_hmm || error_interf),
+						ch_state);
+				publishStats();
 
 				if (time_ready_to_end_rx_ > Scheduler::instance().clock()) {
 					Rx_Time_ = Rx_Time_ + ph->duration - time_ready_to_end_rx_ +
@@ -187,6 +187,8 @@ protected:
 	int pkts_tot_medium; /**< Total number of packets arrived with medium
 							channel*/
 	int pkts_tot_bad; /**< Total number of packets arrived with bad channel*/
+	UwHMMPhysicalStats *hmm_stats_; /**< Stats of the module, same object of
+									   stats_ptr. */
 
 private:
 	// Variables
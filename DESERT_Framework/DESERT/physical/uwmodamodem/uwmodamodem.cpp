@@ -264,13 +264,13 @@ UwMODAModem::start()
 	receiving.store(true);
 	transmitting.store(true);
 
+	// the wake up pipe must be open before the threads queue events
+	startEvents();
+
 	// Dispatch threads
 	sig_thread = std::thread(&UwMODAModem::receivingSignaling, this);
 	rx_thread = std::thread(&UwMODAModem::receivingData, this);
 	tx_thread = std::thread(&UwMODAModem::transmittingData, this);
-
-	checkTimer = new CheckTimer(this);
-	checkTimer->resched(period);
 }
 
 void
@@ -299,7 +299,7 @@ UwMODAModem::stop()
 	if (rx_thread.joinable())
 		rx_thread.join();
 
-	checkTimer->force_cancel();
+	stopEvents();
 }
 
 void
@@ -338,7 +338,7 @@ UwMODAModem::receivingData()
 				std::function<void(UwModem &, Packet * p)> callback =
 						&UwModem::recv;
 				ModemEvent e = {callback, p};
-				event_q.push(e);
+				pushEvent(e);
 
 				data_buffer.clear();
 			}
@@ -520,7 +520,7 @@ UwMODAModem::startTx(Packet *p)
 		std::function<void(UwModem &, Packet * p)> callback =
 				&UwModem::realTxEnded;
 		ModemEvent e = {callback, p};
-		event_q.push(e);
+		pushEvent(e);
 
 		printOnLog(LogLevel::INFO, "MODAMODEM", "startTx::PACKET_TRANSMITTED");
 	}
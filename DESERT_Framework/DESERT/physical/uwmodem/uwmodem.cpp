@@ -27,9 +27,79 @@
 // ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <chrono>
+#include <fcntl.h>
 #include <iomanip>
+#include <sstream>
+#include <unistd.h>
 #include <uwmodem.h>
 
+/**
+ * Number of bins of the latency histogram, the last one holds the
+ * latencies above 2^(LATENCY_BINS - 1) microseconds
+ */
+static const int LATENCY_BINS = 32;
+
+ModemEventQueue::ModemEventQueue()
+	: head(&stub)
+	, tail(&stub)
+	, stub()
+{
+	stub.next.store(nullptr);
+}
+
+ModemEventQueue::~ModemEventQueue()
+{
+	ModemEvent e;
+	while (pop(e))
+		;
+}
+
+void
+ModemEventQueue::push(const ModemEvent &e)
+{
+	Node *n = new Node();
+	n->event = e;
+	n->next.store(nullptr, std::memory_order_relaxed);
+	// the node is visible to the consumer once linked to the previous head
+	Node *prev = head.exchange(n, std::memory_order_acq_rel);
+	prev->next.store(n, std::memory_order_release);
+}
+
+bool
+ModemEventQueue::pop(ModemEvent &e)
+{
+	Node *first = tail;
+	Node *next = first->next.load(std::memory_order_acquire);
+	if (first == &stub) {
+		if (!next)
+			return false;
+		tail = next;
+		first = next;
+		next = next->next.load(std::memory_order_acquire);
+	}
+	if (next) {
+		tail = next;
+		e = first->event;
+		delete first;
+		return true;
+	}
+	// a producer is linking a new node: the event is popped next time
+	if (first != head.load(std::memory_order_acquire))
+		return false;
+	// first is the only node left: put the stub behind it to detach it
+	stub.next.store(nullptr, std::memory_order_relaxed);
+	Node *prev = head.exchange(&stub, std::memory_order_acq_rel);
+	prev->next.store(&stub, std::memory_order_release);
+	next = first->next.load(std::memory_order_acquire);
+	if (next) {
+		tail = next;
+		e = first->event;
+		delete first;
+		return true;
+	}
+	return false;
+}
+
 bool
 UwModem::string2log(const std::string &ll_string, LogLevel &ll)
 {
@@ -83,10 +153,17 @@ UwModem::UwModem()
 	, log_is_open(false)
 	, checkTimer(NULL)
 	, period(0.01)
+	, event_driven(0)
 	, event_q()
+	, wakeup_fd{-1, -1}
+	, wakeup_pending(false)
+	, latency_hist(LATENCY_BINS, 0)
+	, latency_sum(0)
+	, latency_max(0)
 {
 	bind("debug_", (int *) &debug_);
 	bind("period_", (double *) &period);
+	bind("event_driven_", (int *) &event_driven);
 	bind("buffer_size", (unsigned int *) &DATA_BUFFER_LEN);
 	bind("max_read_size", (int *) &MAX_READ_BYTES);
 	bind("ID_", (int *) &modemID);
@@ -137,6 +214,23 @@ UwModem::command(int argc, const char *const *argv)
 			stop();
 			return TCL_OK;
 		}
+		if (!strcmp(argv[1], "getEventLatency")) {
+			unsigned long count = 0;
+			for (unsigned long n : latency_hist)
+				count += n;
+			tcl.resultf("%lu %f %f",
+					count,
+					count > 0 ? latency_sum / count : 0.0,
+					latency_max);
+			return TCL_OK;
+		}
+		if (!strcmp(argv[1], "getEventLatencyHist")) {
+			std::stringstream hist;
+			for (int i = 0; i < LATENCY_BINS; i++)
+				hist << (i > 0 ? " " : "") << latency_hist[i];
+			tcl.result(hist.str().c_str());
+			return TCL_OK;
+		}
 	} else if (argc == 3) {
 		if (!strcmp(argv[1], "setModemAddress")) {
 			modem_address = argv[2];
@@ -166,17 +260,95 @@ UwModem::endTx(Packet *p)
 	Packet::free(p);
 }
 
+void
+UwModem::pushEvent(const ModemEvent &e)
+{
+	ModemEvent queued = e;
+	queued.t = std::chrono::steady_clock::now();
+	event_q.push(queued);
+	// one byte in the pipe is enough to wake up the simulator
+	if (wakeup_fd[1] >= 0 && !wakeup_pending.exchange(true)) {
+		char c = 0;
+		if (write(wakeup_fd[1], &c, 1) < 0)
+			wakeup_pending.store(false);
+	}
+}
+
 void
 UwModem::checkEvent()
 {
-	while (event_q.size() > 0) {
-		ModemEvent e = event_q.front();
+	dispatchEvents();
+	checkTimer->resched(period);
+}
+
+void
+UwModem::dispatchEvents()
+{
+	ModemEvent e;
+	while (event_q.pop(e)) {
 		e.f(*this, e.p);
-		event_q.pop();
+
+		double latency = std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - e.t)
+								 .count();
+		int bin = 0;
+		for (double us = latency * 1e6; us >= 2 && bin < LATENCY_BINS - 1;
+				us /= 2)
+			bin++;
+		latency_hist[bin]++;
+		latency_sum += latency;
+		if (latency > latency_max)
+			latency_max = latency;
 	}
+}
+
+void
+UwModem::startEvents()
+{
+	if (event_driven) {
+		if (pipe(wakeup_fd) == 0) {
+			fcntl(wakeup_fd[0], F_SETFL, O_NONBLOCK);
+			fcntl(wakeup_fd[1], F_SETFL, O_NONBLOCK);
+			Tcl_CreateFileHandler(wakeup_fd[0],
+					TCL_READABLE,
+					&UwModem::wakeupHandler,
+					(ClientData) this);
+			return;
+		}
+		wakeup_fd[0] = wakeup_fd[1] = -1;
+		printOnLog(LogLevel::ERROR, "UWMODEM", "startEvents::PIPE_FAILED");
+	}
+	checkTimer = new CheckTimer(this);
 	checkTimer->resched(period);
 }
 
+void
+UwModem::stopEvents()
+{
+	if (wakeup_fd[0] >= 0) {
+		Tcl_DeleteFileHandler(wakeup_fd[0]);
+		close(wakeup_fd[0]);
+		close(wakeup_fd[1]);
+		wakeup_fd[0] = wakeup_fd[1] = -1;
+		wakeup_pending.store(false);
+	} else if (checkTimer) {
+		checkTimer->force_cancel();
+	}
+}
+
+void
+UwModem::wakeupHandler(ClientData data, int mask)
+{
+	UwModem *modem = (UwModem *) data;
+	char buf[64];
+	while (read(modem->wakeup_fd[0], buf, sizeof(buf)) > 0)
+		;
+	// cleared before dispatching, so that a push racing with the dispatch
+	// writes a new byte
+	modem->wakeup_pending.store(false);
+	modem->dispatchEvents();
+}
+
 void
 CheckTimer::expire(Event *e)
 {
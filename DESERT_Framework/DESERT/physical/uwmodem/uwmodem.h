@@ -37,10 +37,13 @@
 #ifndef UWMODEM_H
 #define UWMODEM_H
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <queue>
 #include <string>
+#include <vector>
 
 #include <functional>
 #include <hdr-uwal.h>
@@ -51,7 +54,66 @@
 #include <uwip-module.h>
 
 class CheckTimer;
-struct ModemEvent;
+class UwModem;
+
+/**
+ * Event scheduled by the driver threads for NS2 to execute (callback).
+ */
+struct ModemEvent {
+	std::function<void(UwModem &, Packet *p)> f;
+	Packet *p;
+	std::chrono::steady_clock::time_point
+			t; /**< Time the event was queued by the driver. */
+};
+
+/**
+ * Unbounded lock-free queue of ModemEvent, with many producers (the driver
+ * threads) and a single consumer (the simulator).
+ */
+class ModemEventQueue
+{
+public:
+	/**
+	 * Class constructor: the queue is empty.
+	 */
+	ModemEventQueue();
+
+	/**
+	 * Class destructor: the events left are discarded.
+	 */
+	~ModemEventQueue();
+
+	/**
+	 * Method that appends an event, it can be called by any thread.
+	 * @param e event to be queued
+	 */
+	void push(const ModemEvent &e);
+
+	/**
+	 * Method that removes the oldest event, it must be called only by the
+	 * consumer thread.
+	 * @param e return parameter holding the event removed
+	 * @return true if an event was removed, false if the queue is empty
+	 */
+	bool pop(ModemEvent &e);
+
+private:
+	/**
+	 * Element of the queue.
+	 */
+	struct Node {
+		std::atomic<Node *> next; /**< Next element, toward the head. */
+		ModemEvent event; /**< Event held by the element. */
+	};
+
+	std::atomic<Node *> head; /**< Last element pushed. */
+	Node *tail; /**< Oldest element, owned by the consumer. */
+	Node stub; /**< Placeholder that keeps the queue never empty. */
+
+	ModemEventQueue(const ModemEventQueue &) = delete;
+	ModemEventQueue &operator=(const ModemEventQueue &) = delete;
+};
+
 /**
  * Class that implements the interface to DESERT, as used through Tcl scripts.
  * This class provides common functions to operate as a physical layer;
@@ -221,6 +283,14 @@ public:
 		endTx(p);
 	}
 
+	/**
+	 * Method that queues an event for NS2 to execute. It can be called by
+	 * any thread: in event driven mode the simulator is woken up at once,
+	 * otherwise the event waits for the next check of CheckTimer.
+	 * @param e event to be executed
+	 */
+	void pushEvent(const ModemEvent &e);
+
 protected:
 	int modemID; /**< Number used for identification purposes: not specified */
 
@@ -265,8 +335,20 @@ protected:
 	CheckTimer *checkTimer; /**< Pointer to an object to schedule the
 							  "check-modem" events. */
 	double period; /**< Checking period of the modem's buffer. */
+	int event_driven; /**< If 1 the events are executed as soon as they are
+						 queued, otherwise every period. */
 	/** Queue of events that are scheduled for NS2 to execute (callbacks) */
-	std::queue<ModemEvent> event_q;
+	ModemEventQueue event_q;
+	int wakeup_fd[2]; /**< Pipe used to wake up the simulator, -1 if closed. */
+	std::atomic<bool> wakeup_pending; /**< True if a wake up byte is in the
+										 pipe and not handled yet. */
+
+	/** Number of events executed for each latency range: bin i counts the
+	 * latencies, in microseconds, in [2^i, 2^(i+1)), bin 0 also the ones
+	 * below 1 */
+	std::vector<unsigned long> latency_hist;
+	double latency_sum; /**< Sum of the latencies of the events [s]. */
+	double latency_max; /**< Maximum latency of the events [s]. */
 
 	/**
 	 * Method that triggers the transmission of a packet through a specified
@@ -315,6 +397,34 @@ protected:
 	 * Method to check if any event from real world has to go to ns
 	 */
 	void checkEvent();
+
+	/**
+	 * Method that executes all the queued events and records the time
+	 * they waited since they were queued by the driver.
+	 */
+	void dispatchEvents();
+
+	/**
+	 * Method that starts the execution of the events queued by the driver:
+	 * through the wake up pipe if event_driven is set, otherwise every
+	 * period through CheckTimer. To be called in start(), before the
+	 * driver threads are spawned, since they read wakeup_fd unlocked.
+	 */
+	void startEvents();
+
+	/**
+	 * Method that stops the execution of the queued events. To be called in
+	 * stop(), once the driver threads are over.
+	 */
+	void stopEvents();
+
+	/**
+	 * Handler of the wake up pipe, called by the Tcl event loop of the
+	 * real time scheduler.
+	 * @param data pointer to the UwModem
+	 * @param mask Tcl mask of the file event
+	 */
+	static void wakeupHandler(ClientData data, int mask);
 };
 
 /**
@@ -356,9 +466,4 @@ protected:
 						   expires.*/
 };
 
-struct ModemEvent {
-	std::function<void(UwModem &, Packet *p)> f;
-	Packet *p;
-};
-
 #endif
@@ -29,4 +29,5 @@
 Module/UW/UwModem/ModemCSA set debug_    0
 Module/UW/UwModem/ModemCSA set max_read_size    2000
 Module/UW/UwModem/ModemCSA set period_    0.01
+Module/UW/UwModem/ModemCSA set event_driven_    0
 Module/UW/UwModem/ModemCSA set buffer_size    2000
@@ -238,7 +238,7 @@ UwModemCSA::startTx(Packet *p)
 		std::function<void(UwModem &, Packet * p)> callback =
 				&UwModem::realTxEnded;
 		ModemEvent e = {callback, p};
-		event_q.push(e);
+		pushEvent(e);
 	}
 
 	return;
@@ -294,13 +294,13 @@ UwModemCSA::start()
 	receiving.store(true);
 	transmitting.store(true);
 
+	// the wake up pipe must be open before the threads queue events
+	startEvents();
+
 	// branch off threads
 	rx_thread = std::thread(&UwModemCSA::receivingData, this);
 
 	tx_thread = std::thread(&UwModemCSA::transmittingData, this);
-
-	checkTimer = new CheckTimer(this);
-	checkTimer->resched(period);
 }
 
 void
@@ -321,7 +321,7 @@ UwModemCSA::stop()
 		rx_thread.join();
 	}
 
-	checkTimer->force_cancel();
+	stopEvents();
 }
 
 void
@@ -458,7 +458,7 @@ UwModemCSA::startRealRx(const std::string &cmd)
 	createRxPacket(p);
 	std::function<void(UwModem &, Packet * p)> callback = &UwModem::recv;
 	ModemEvent e = {callback, p};
-	event_q.push(e);
+	pushEvent(e);
 	// recv(p);
 }
 
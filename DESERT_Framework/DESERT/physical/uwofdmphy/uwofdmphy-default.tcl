@@ -47,3 +47,4 @@ Module/UW/OFDM/PHY  set BCH_T               1
 
 Module/UW/OFDM/PHY  set FRAME_BIT           9152
 
+Module/UW/OFDM/PHY  set ber_table_step_dB_  0
@@ -76,6 +76,8 @@ UwOFDMPhy::UwOFDMPhy()
 	bind("FRAME_BIT", &FRAME_BIT);
 	bind("powerScaling_", (int *) &powerScaling);
 	Interference_Model = "MEANPOWER";
+	for (int i = 0; i < UwBerKernel::MOD_NUMBER; i++)
+		carrier_ber_[i].setModulation(UwBerKernel::Modulation(i));
 }
 
 UwOFDMPhy::~UwOFDMPhy()
@@ -604,6 +606,8 @@ UwOFDMPhy::endRx(Packet *p)
 
 			if (!error_n) {
 				if (interference_) {
+					const InterferenceResult &interf =
+							interference_->getInterference(p);
 					if (Interference_Model ==
 							"MEANPOWER") { // only meanpower
 										   // is allow in right now
@@ -617,8 +621,7 @@ UwOFDMPhy::endRx(Packet *p)
 						// WARNING: this only uses the interference power on the
 						// used subcarriers the problem is that it averages it
 						// which is not always the case in real life
-						interference_power =
-								interference_->getInterferencePower(p);
+						interference_power = interf.power;
 						// per_ni = interference > 0; // this if model unknown
 						// and interf always distructive
 						msgDisp.printStatus("getOFDMPER with Interference",
@@ -649,7 +652,7 @@ UwOFDMPhy::endRx(Packet *p)
 								  << std::endl;
 						exit(1);
 					}
-					interferent_pkts = interference_->getCounters(p);
+					interferent_pkts = interf.counters;
 
 				} else {
 					if (ofdmph->nativeOFDM)
@@ -880,46 +883,40 @@ UwOFDMPhy::getOFDMPER(double _snr, int _nbits, Packet *p)
 	assert(sm);
 
 	int ncarriers = sm->getBandwidth() / ofdmph->carrierSize;
-	double snr_with_penalty = _snr * pow(10, RxSnrPenalty_dB_ / 10.0);
 	double ber_ = 0;
 	int usedCarriers = 0;
-	double tber_ = 0;
+	int modCarriers[UwBerKernel::MOD_NUMBER] = {0};
+	UwBerKernel::Modulation mod = UwBerKernel::MOD_NONE;
 	int brokenProb = 10; // out of 100
 
 	for (int i = 0; i < ofdmph->carrierNum; i++) {
 		// set the associated modulation with something like ph->modulationType
 		// = subCarMod
+		// a carrier with an unknown modulation keeps the previous BER
+		UwBerKernel::Modulation carMod =
+				UwBerKernel::getModulation(ofdmph->carMod[i]);
+		if (carMod != UwBerKernel::MOD_NONE)
+			mod = carMod;
 
-		if (ofdmph->carMod[i] == "BPSK") {
-			tber_ = 0.5 * erfc(sqrt(snr_with_penalty));
-		} else if (ofdmph->carMod[i] == "QPSK") {
-			tber_ = erfc(sqrt(snr_with_penalty));
-		} else if (ofdmph->carMod[i] == "BFSK") {
-			tber_ = 0.5 * exp(-snr_with_penalty / 2);
-		} else if (ofdmph->carMod[i] == "8PSK") {
-			double const M = 8;
-			tber_ = (1 / this->log2(M)) *
-					get_prob_error_symbol_mpsk(snr_with_penalty, M);
-		} else if (ofdmph->carMod[i] == "16PSK") {
-			double const M = 16;
-			tber_ = (1 / this->log2(M)) *
-					get_prob_error_symbol_mpsk(snr_with_penalty, M);
-		} else if (ofdmph->carMod[i] == "32PSK") {
-			double const M = 32;
-			tber_ = (1 / this->log2(M)) *
-					get_prob_error_symbol_mpsk(snr_with_penalty, M);
-		}
-
-		ber_ += tber_ * ofdmph->carriers[i];
+		modCarriers[mod] += ofdmph->carriers[i];
 		usedCarriers += ofdmph->carriers[i];
 	}
+	// the SNR is the same on all the carriers, so the BER is computed once
+	// for each modulation in use
+	for (int m = UwBerKernel::MOD_NONE + 1; m < UwBerKernel::MOD_NUMBER; m++) {
+		if (modCarriers[m] == 0)
+			continue;
+		carrier_ber_[m].setSnrPenalty(RxSnrPenalty_dB_);
+		carrier_ber_[m].setTableStep(ber_table_step_db_);
+		ber_ += carrier_ber_[m].getBer(_snr) * modCarriers[m];
+	}
 	ber_ = ber_ / usedCarriers;
 	// WARNING: the BER calculated carrier by carrier makes sense if there are
 	// weird thinngs in the network, otherwise, since the noise it's already
 	// scaled, it's the same as computing on total snr
 
 	// PER calculation
-	double per = 1 - pow(1 - ber_, _nbits);
+	double per = UwBerKernel::berToPer(ber_, _nbits);
 	if (debug_)
 		std::cout << NOW << " UwOFDMPhy(" << nodeID_
 				  << ")::getOFDMPER BER = " << ber_ << " PER = " << per
@@ -349,6 +349,9 @@ private:
 	int tx_busy_; // 1 if a transmission in happening, 0 otherwise
 
 	MsgDisplayer msgDisp; // object of MsgDisplayer type
+
+	UwBerKernel carrier_ber_[UwBerKernel::MOD_NUMBER]; // BER of each
+													   // carrier modulation
 };
 
 #endif /* UWOFDMPHY_H  */
@@ -58,9 +58,10 @@ public:
 } class_module_optical;
 
 UwOpticalPhy::UwOpticalPhy()
-	: lut_file_name_("")
+	: use_woss_(false)
+	, lut_file_name_("")
 	, lut_token_separator_('\t')
-	, use_woss_(false)
+	, lut_map(&UwLut::emptyLut())
 	, variable_temperature_(false)
 {
 	if (!MPhy_Bpsk::initialized) {
@@ -170,7 +171,7 @@ UwOpticalPhy::getNoisePower(Packet *p)
 	Position *dest = ph->dstPosition;
 	assert(dest);
 	double depth = use_woss_ ? -dest->getAltitude() : -dest->getZ();
-	double lut_value = lut_map.empty() ? 0 : lookUpLightNoiseE(depth);
+	double lut_value = lut_map->empty() ? 0 : lookUpLightNoiseE(depth);
 	double t = variable_temperature_ ? getVarTemperature(p) : T;
 	double il = (Il == IL_ILLEGAL ? S * ph->Pr : Il);
 	t = t > NOT_VARIABLE_TEMPERATURE ? t : T;
@@ -190,8 +191,9 @@ UwOpticalPhy::endRx(Packet *p)
 	if (MPhy_Bpsk::PktRx != 0) {
 		if (MPhy_Bpsk::PktRx == p) {
 			if (interference_) {
-				double interference_power =
-						interference_->getInterferencePower(p);
+				// ph->Pi has just been computed by MPhyRxTimer, do not query
+				// the interference model again
+				double interference_power = HDR_MPHY(p)->Pi;
 				if (interference_power == 0) {
 					// no interference
 					ch->error() = 0;
@@ -220,28 +222,29 @@ UwOpticalPhy::endRx(Packet *p)
 double
 UwOpticalPhy::lookUpLightNoiseE(double depth)
 {
-	// TODO: search noise Energy in the lookup table
-	DepthMap::iterator it = lut_map.lower_bound(depth);
-	if (it != lut_map.end() && it->first == depth) {
+	int i = lut_map->lowerBound(depth);
+	if (i < lut_map->size() && lut_map->getKey(i) == depth) {
 		if (debug_)
-			std::cout << depth << " " << it->first << " " << it->second
-					  << std::endl;
-		return it->second;
+			std::cout << depth << " " << lut_map->getKey(i) << " "
+					  << lut_map->getValue(i) << std::endl;
+		return lut_map->getValue(i);
 	}
-	if (it == lut_map.end() || it == lut_map.begin()) {
+	if (i == lut_map->size() || i == 0) {
 		if (debug_)
 			std::cout << depth << " Nothing returned depth = " << depth
 					  << std::endl;
 
 		return NOT_FOUND_VALUE;
 	}
-	DepthMap::iterator u_it = it;
-	it--;
 	if (debug_)
-		std::cout << depth << " " << it->first << " " << it->second << " "
-				  << u_it->first << " " << u_it->second << std::endl;
-	return linearInterpolator(
-			depth, it->first, it->second, u_it->first, u_it->second);
+		std::cout << depth << " " << lut_map->getKey(i - 1) << " "
+				  << lut_map->getValue(i - 1) << " " << lut_map->getKey(i)
+				  << " " << lut_map->getValue(i) << std::endl;
+	return linearInterpolator(depth,
+			lut_map->getKey(i - 1),
+			lut_map->getValue(i - 1),
+			lut_map->getKey(i),
+			lut_map->getValue(i));
 }
 
 double
@@ -257,25 +260,6 @@ UwOpticalPhy::linearInterpolator(
 void
 UwOpticalPhy::initializeLUT()
 {
-	ifstream input_file_;
-	string line_;
-	input_file_.open(lut_file_name_.c_str());
-	if (input_file_.is_open()) {
-		// skip first 2 lines
-		for (int i = 0; i < 2; ++i) {
-			std::getline(input_file_, line_);
-		}
-		double d;
-		double n;
-		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			line_stream >> d;
-			line_stream.ignore(256, lut_token_separator_);
-			line_stream >> n;
-			lut_map[d] = n;
-		}
-		input_file_.close();
-	} else {
-		cerr << "Impossible to open file " << lut_file_name_ << endl;
-	}
+	// skip first 2 lines
+	lut_map = &UwLut::getLut(lut_file_name_, lut_token_separator_, 1, 2);
 }
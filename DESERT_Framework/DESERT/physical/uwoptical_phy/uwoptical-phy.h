@@ -40,6 +40,7 @@
 #define UWOPTICAL_PHY_H
 
 #include <bpsk.h>
+#include <uwlut.h>
 
 #include <module.h>
 #include <packet.h>
@@ -62,9 +63,6 @@
 #define NOT_FOUND_VALUE 0
 #define IL_ILLEGAL -1
 
-typedef ::std::map<double, double> DepthMap;
-typedef DepthMap::iterator DMIt;
-
 class UwOpticalPhy : public MPhy_Bpsk
 {
 
@@ -127,8 +125,8 @@ private:
 	double Ar_; // receiver area [m^2]
 	string lut_file_name_; // LUT file name
 	char lut_token_separator_; //
-	DepthMap
-			lut_map; /**< Lookup table map of the solar noise versus the depth*/
+	const UwLut *lut_map; /**< Lookup table of the solar noise versus the depth,
+							 shared by the nodes using the same file */
 	bool variable_temperature_; /**< Flag to set whether the temperature is
 								   costant or varialbe with the depth*/
 };
@@ -59,14 +59,14 @@ public:
 
 UwOpticalBeamPattern::UwOpticalBeamPattern()
 	: UwOpticalPhy()
-	, beam_pattern_path_tx_("")
 	, beam_pattern_path_rx_("")
+	, beam_pattern_path_tx_("")
 	, max_dist_path_("")
 	, beam_pattern_separator_(',')
 	, max_dist_separator_(',')
-	, dist_lut_()
-	, beam_lut_tx_()
-	, beam_lut_rx_()
+	, dist_lut_(&UwLut::emptyLut())
+	, beam_lut_rx_(&UwLut::emptyLut())
+	, beam_lut_tx_(&UwLut::emptyLut())
 	, back_noise_threshold_(0)
 	, inclination_angle_(0)
 	, sameBeam(true)
@@ -229,8 +229,8 @@ UwOpticalBeamPattern::getMaxTxRange(Packet *p)
 	double dest_depth = use_woss_ ? -dest->getAltitude() : -dest->getZ();
 	double na = lookUpLightNoiseE(dest_depth); // background noise
 
-	if ((dist_lut_.empty() == true) || beam_lut_tx_.empty() == true ||
-			beam_lut_rx_.empty() == true) {
+	if ((dist_lut_->empty() == true) || beam_lut_tx_->empty() == true ||
+			beam_lut_rx_->empty() == true) {
 		cerr << "UwOpticalBeamPattern::getMaxTxRange error: LUTs not init."
 			 << endl;
 		return 0;
@@ -384,44 +384,38 @@ double
 UwOpticalBeamPattern::getLutMaxDist(double c, double na)
 {
 	double max_distance = 0;
-	CMaxDistIter c_dist_it = dist_lut_.lower_bound(c);
-	assert(c_dist_it != dist_lut_.end());
-	if (c_dist_it->first > c && c_dist_it != dist_lut_.begin()) {
-		double dist_next = na > back_noise_threshold_
-				? c_dist_it->second.max_range_with_noise
-				: c_dist_it->second.max_range;
-		double c_next = c_dist_it->first;
-		c_dist_it--;
-		double dist_prev = na > back_noise_threshold_
-				? c_dist_it->second.max_range_with_noise
-				: c_dist_it->second.max_range;
-		double c_prev = c_dist_it->first;
+	int column = na > back_noise_threshold_ ? MAX_RANGE_WITH_NOISE_COLUMN
+											: MAX_RANGE_COLUMN;
+	int i = dist_lut_->lowerBound(c);
+	assert(i != dist_lut_->size());
+	if (dist_lut_->getKey(i) > c && i != 0) {
+		double dist_next = dist_lut_->getValue(i, column);
+		double c_next = dist_lut_->getKey(i);
+		double dist_prev = dist_lut_->getValue(i - 1, column);
+		double c_prev = dist_lut_->getKey(i - 1);
 		max_distance =
 				linearInterpolator(c, c_prev, dist_prev, c_next, dist_next);
 	} else {
-		max_distance = na > back_noise_threshold_
-				? c_dist_it->second.max_range_with_noise
-				: c_dist_it->second.max_range;
+		max_distance = dist_lut_->getValue(i, column);
 	}
 	return max_distance;
 }
 
 double
-UwOpticalBeamPattern::getLutBeamFactor(BeamPattern &beam_lut_, double beta)
+UwOpticalBeamPattern::getLutBeamFactor(const UwLut *beam_lut_, double beta)
 {
 	double beam_norm_d = 0;
-	BeamPatternIter beam_it = beam_lut_.lower_bound(beta);
-	assert(beam_it != beam_lut_.end());
-	if (beam_it->first > beta && beam_it != beam_lut_.begin()) {
-		double dist_next = beam_it->second;
-		double beta_next = beam_it->first;
-		beam_it--;
-		double dist_prev = beam_it->second;
-		double beta_prev = beam_it->first;
+	int i = beam_lut_->lowerBound(beta);
+	assert(i != beam_lut_->size());
+	if (beam_lut_->getKey(i) > beta && i != 0) {
+		double dist_next = beam_lut_->getValue(i);
+		double beta_next = beam_lut_->getKey(i);
+		double dist_prev = beam_lut_->getValue(i - 1);
+		double beta_prev = beam_lut_->getKey(i - 1);
 		beam_norm_d = linearInterpolator(
 				beta, beta_prev, dist_prev, beta_next, dist_next);
 	} else {
-		beam_norm_d = beam_it->second;
+		beam_norm_d = beam_lut_->getValue(i);
 	}
 	return beam_norm_d;
 }
@@ -436,53 +430,15 @@ UwOpticalBeamPattern::initializeLUT()
 
 void
 UwOpticalBeamPattern::initializeBeamLUT(
-		BeamPattern &beam_lut_, string beam_pattern_path_)
+		const UwLut *&beam_lut_, string beam_pattern_path_)
 {
-	ifstream input_file_;
-	string line_;
-	input_file_.open(beam_pattern_path_.c_str());
-	if (input_file_.is_open()) {
-		double beta;
-		double r;
-		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			line_stream >> beta;
-			line_stream.ignore(256, beam_pattern_separator_);
-			line_stream >> r;
-			beam_lut_[beta] = r;
-		}
-		input_file_.close();
-	} else {
-		cerr << "Impossible to open file " << beam_pattern_path_ << endl;
-	}
+	beam_lut_ = &UwLut::getLut(beam_pattern_path_, beam_pattern_separator_);
 }
 
 void
 UwOpticalBeamPattern::initializeMaxRangeLUT()
 {
-	ifstream input_file_;
-	string line_;
-	input_file_.open(max_dist_path_.c_str());
-	if (input_file_.is_open()) {
-		double c;
-		double r;
-		double r_e;
-		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			line_stream >> c;
-			line_stream.ignore(256, max_dist_separator_);
-			line_stream >> r;
-			line_stream.ignore(256, max_dist_separator_);
-			line_stream >> r_e;
-			MaxDist d;
-			d.max_range = r;
-			d.max_range_with_noise = r_e;
-			dist_lut_[c] = d;
-		}
-		input_file_.close();
-	} else {
-		cerr << "Impossible to open file " << max_dist_path_ << endl;
-	}
+	dist_lut_ = &UwLut::getLut(max_dist_path_, max_dist_separator_, 2);
 }
 
 void
@@ -42,17 +42,9 @@
 #include "uwopticalbeampattern-hdr.h"
 #include <uwoptical-phy.h>
 
-// structure for max distance from LUT without noise, with noise
-struct MaxDist {
-	double max_range;
-	double max_range_with_noise;
-};
-typedef ::std::map<double, MaxDist> CMaxDist; // max distance per c
-typedef CMaxDist::iterator CMaxDistIter;
-
-// LUT of angle in radiance vs normalized beam pattern
-typedef ::std::map<double, double> BeamPattern;
-typedef BeamPattern::iterator BeamPatternIter;
+// columns of the max distance LUT: without noise, with noise
+#define MAX_RANGE_COLUMN 0
+#define MAX_RANGE_WITH_NOISE_COLUMN 1
 
 class UwOpticalBeamPattern : public UwOpticalPhy
 {
@@ -95,7 +87,7 @@ protected:
 	/**
 	 * Inizialize beam pattern LUT
 	 */
-	void initializeBeamLUT(BeamPattern &beam_lut_, string beam_pattern_path_);
+	void initializeBeamLUT(const UwLut *&beam_lut_, string beam_pattern_path_);
 
 	/**
 	 * Inizialize max range LUT
@@ -111,7 +103,7 @@ protected:
 	 * Get the maximum transmission range for these water properties.
 	 */
 	double getLutMaxDist(double c, double na);
-	double getLutBeamFactor(BeamPattern &beam_lut_, double beta);
+	double getLutBeamFactor(const UwLut *beam_lut_, double beta);
 	double getBetaRx(Packet *p);
 	double getBetaXY(Packet *p, double rotation_angle);
 	double getBetaXYRx(Packet *p);
@@ -125,10 +117,11 @@ private:
 	string max_dist_path_; // LUT file name
 	char beam_pattern_separator_; //
 	char max_dist_separator_; //
-	CMaxDist dist_lut_;
-	// BeamPattern beam_lut_;
-	BeamPattern beam_lut_rx_;
-	BeamPattern beam_lut_tx_;
+	// LUTs are shared by the nodes using the same files
+	const UwLut *dist_lut_; // max distance per c, without and with noise
+	// const UwLut *beam_lut_;
+	const UwLut *beam_lut_rx_; // angle in radiance vs normalized beam pattern
+	const UwLut *beam_lut_tx_;
 	double back_noise_threshold_;
 	double inclination_angle_; /**< Angle of inclination from the 0 Zenith*/
 
@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwberkernel.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwBerKernel class.
+ *
+ */
+
+#include "uwberkernel.h"
+
+#include <cmath>
+
+/**
+ * Lowest SNR, in dB, of the BER tables
+ */
+static const double TABLE_MIN_DB = -30;
+
+/**
+ * Highest SNR, in dB, of the BER tables
+ */
+static const double TABLE_MAX_DB = 40;
+
+std::map<UwBerKernel::TableKey, std::vector<double> *> UwBerKernel::tables_;
+
+UwBerKernel::UwBerKernel(Modulation modulation)
+	: modulation_(modulation)
+	, ber_function_(getBerFunction(modulation))
+	, penalty_db_(0)
+	, penalty_(1)
+	, step_db_(0)
+	, table_(nullptr)
+{
+}
+
+UwBerKernel::Modulation
+UwBerKernel::getModulation(const std::string &name)
+{
+	if (name == "BPSK")
+		return MOD_BPSK;
+	if (name == "QPSK")
+		return MOD_QPSK;
+	if (name == "BFSK")
+		return MOD_BFSK;
+	if (name == "8PSK")
+		return MOD_8PSK;
+	if (name == "16PSK")
+		return MOD_16PSK;
+	if (name == "32PSK")
+		return MOD_32PSK;
+	return MOD_NONE;
+}
+
+void
+UwBerKernel::setModulation(Modulation modulation)
+{
+	modulation_ = modulation;
+	ber_function_ = getBerFunction(modulation);
+	updateTable();
+}
+
+void
+UwBerKernel::getPer(const double *snr, const int *nbits, int n, double *per,
+		double *ber) const
+{
+	if (table_) {
+		for (int i = 0; i < n; i++)
+			ber[i] = lookUp(snr[i] * penalty_);
+	} else {
+		for (int i = 0; i < n; i++)
+			ber[i] = ber_function_(snr[i] * penalty_);
+	}
+	for (int i = 0; i < n; i++)
+		per[i] = (nbits[i] == 1) ? ber[i] : berToPer(ber[i], nbits[i]);
+}
+
+double
+UwBerKernel::berToPer(double ber, int nbits)
+{
+	if (nbits <= 0 || ber <= 0)
+		return 0;
+	if (ber >= 1)
+		return 1;
+	return -std::expm1(nbits * std::log1p(-ber));
+}
+
+double
+UwBerKernel::getBer(Modulation modulation, double snr)
+{
+	return getBerFunction(modulation)(snr);
+}
+
+void
+UwBerKernel::updatePenalty()
+{
+	penalty_ = std::pow(10, penalty_db_ / 10.0);
+}
+
+void
+UwBerKernel::updateTable()
+{
+	if (step_db_ <= 0 || modulation_ == MOD_NONE) {
+		table_ = nullptr;
+		return;
+	}
+	TableKey key(modulation_, step_db_);
+	std::map<TableKey, std::vector<double> *>::iterator it = tables_.find(key);
+	if (it == tables_.end()) {
+		int size = std::ceil((TABLE_MAX_DB - TABLE_MIN_DB) / step_db_) + 1;
+		std::vector<double> *table = new std::vector<double>(size);
+		for (int i = 0; i < size; i++) {
+			double snr_db = TABLE_MIN_DB + i * step_db_;
+			(*table)[i] = ber_function_(std::pow(10, snr_db / 10.0));
+		}
+		it = tables_.insert(std::make_pair(key, table)).first;
+	}
+	table_ = it->second;
+}
+
+double
+UwBerKernel::lookUp(double snr) const
+{
+	double pos = (10 * std::log10(snr) - TABLE_MIN_DB) / step_db_;
+	int last = table_->size() - 1;
+	if (!(pos >= 0 && pos < last))
+		return ber_function_(snr);
+	int i = pos;
+	double frac = pos - i;
+	return (*table_)[i] + frac * ((*table_)[i + 1] - (*table_)[i]);
+}
+
+double
+UwBerKernel::berNone(double snr)
+{
+	return 0;
+}
+
+double
+UwBerKernel::berBpsk(double snr)
+{
+	return 0.5 * std::erfc(std::sqrt(snr));
+}
+
+double
+UwBerKernel::berQpsk(double snr)
+{
+	return std::erfc(std::sqrt(snr));
+}
+
+double
+UwBerKernel::berBfsk(double snr)
+{
+	return 0.5 * std::exp(-snr / 2);
+}
+
+template <int M>
+double
+UwBerKernel::berMpsk(double snr)
+{
+	static const double bits = std::log2(M);
+	static const double sin_m = std::sin(M_PI / M);
+	return std::erfc(std::sqrt(snr * bits) * sin_m) / bits;
+}
+
+UwBerKernel::BerFunction
+UwBerKernel::getBerFunction(Modulation modulation)
+{
+	switch (modulation) {
+		case MOD_BPSK:
+			return berBpsk;
+		case MOD_QPSK:
+			return berQpsk;
+		case MOD_BFSK:
+			return berBfsk;
+		case MOD_8PSK:
+			return berMpsk<8>;
+		case MOD_16PSK:
+			return berMpsk<16>;
+		case MOD_32PSK:
+			return berMpsk<32>;
+		default:
+			return berNone;
+	}
+}
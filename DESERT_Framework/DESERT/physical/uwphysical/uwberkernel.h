@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwberkernel.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwBerKernel class, the bit and packet error rate
+ * computation of the physical layers.
+ *
+ */
+
+#ifndef UWBERKERNEL_H
+#define UWBERKERNEL_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Bit error rate of a modulation scheme versus the SNR. The modulation is
+ * resolved once, when it is configured, to the function that computes its
+ * BER. Optionally the BER is read from a table of the SNR in dB with a
+ * configurable step, shared by all the kernels with the same modulation and
+ * step. An SNR penalty in dB is applied to every SNR.
+ */
+class UwBerKernel
+{
+public:
+	/**
+	 * Modulation schemes supported by the kernel.
+	 */
+	enum Modulation {
+		MOD_NONE = 0,
+		MOD_BPSK,
+		MOD_QPSK,
+		MOD_BFSK,
+		MOD_8PSK,
+		MOD_16PSK,
+		MOD_32PSK,
+		MOD_NUMBER
+	};
+
+	/**
+	 * Constructor of UwBerKernel class.
+	 *
+	 * @param modulation Modulation scheme
+	 */
+	explicit UwBerKernel(Modulation modulation = MOD_BPSK);
+
+	/**
+	 * @param name Name of the modulation, e.g. "BPSK" or "16PSK"
+	 * @return the modulation, MOD_NONE if the name is unknown
+	 */
+	static Modulation getModulation(const std::string &name);
+
+	/**
+	 * Sets the modulation scheme.
+	 *
+	 * @param modulation Modulation scheme
+	 */
+	void setModulation(Modulation modulation);
+
+	/**
+	 * @return the modulation scheme
+	 */
+	inline Modulation
+	getModulation() const
+	{
+		return modulation_;
+	}
+
+	/**
+	 * Sets the SNR penalty, the factor is recomputed only if it changes.
+	 *
+	 * @param penalty_db SNR penalty in dB
+	 */
+	inline void
+	setSnrPenalty(double penalty_db)
+	{
+		if (penalty_db != penalty_db_) {
+			penalty_db_ = penalty_db;
+			updatePenalty();
+		}
+	}
+
+	/**
+	 * Sets the step of the BER table, the table is built only if the step
+	 * changes.
+	 *
+	 * @param step_db Step of the table in dB, 0 to use the closed forms
+	 */
+	inline void
+	setTableStep(double step_db)
+	{
+		if (step_db != step_db_) {
+			step_db_ = step_db;
+			updateTable();
+		}
+	}
+
+	/**
+	 * @param snr SNR in linear scale, without penalty
+	 * @return the bit error rate
+	 */
+	inline double
+	getBer(double snr) const
+	{
+		snr *= penalty_;
+		if (table_)
+			return lookUp(snr);
+		return ber_function_(snr);
+	}
+
+	/**
+	 * @param snr SNR in linear scale, without penalty
+	 * @param nbits Length of the packet in bits
+	 * @return the packet error rate
+	 */
+	inline double
+	getPer(double snr, int nbits) const
+	{
+		double ber = getBer(snr);
+		return (nbits == 1) ? ber : berToPer(ber, nbits);
+	}
+
+	/**
+	 * Packet error rates of many chunks at once, e.g. the chunks of
+	 * constant interference of a packet.
+	 *
+	 * @param snr SNR of each chunk, in linear scale and without penalty
+	 * @param nbits Length in bits of each chunk
+	 * @param n Number of chunks
+	 * @param per Packet error rate of each chunk (output)
+	 * @param ber Bit error rate of each chunk (output)
+	 */
+	void getPer(const double *snr, const int *nbits, int n, double *per,
+			double *ber) const;
+
+	/**
+	 * Packet error rate of independent bit errors, 1 - (1 - ber)^nbits,
+	 * computed without cancellation for small BERs.
+	 *
+	 * @param ber Bit error rate
+	 * @param nbits Length of the packet in bits
+	 * @return the packet error rate
+	 */
+	static double berToPer(double ber, int nbits);
+
+	/**
+	 * @param modulation Modulation scheme
+	 * @param snr SNR in linear scale
+	 * @return the bit error rate in closed form
+	 */
+	static double getBer(Modulation modulation, double snr);
+
+private:
+	/**
+	 * Function that computes the BER of a modulation versus the SNR.
+	 */
+	typedef double (*BerFunction)(double);
+
+	/**
+	 * Recomputes the linear SNR penalty.
+	 */
+	void updatePenalty();
+
+	/**
+	 * Selects the shared table of the modulation and step.
+	 */
+	void updateTable();
+
+	/**
+	 * @param snr SNR in linear scale
+	 * @return the BER interpolated in the table, or in closed form outside
+	 */
+	double lookUp(double snr) const;
+
+	static double berNone(double snr);
+	static double berBpsk(double snr);
+	static double berQpsk(double snr);
+	static double berBfsk(double snr);
+	template <int M> static double berMpsk(double snr);
+
+	/**
+	 * @param modulation Modulation scheme
+	 * @return the function that computes the BER of the modulation
+	 */
+	static BerFunction getBerFunction(Modulation modulation);
+
+	Modulation modulation_; /**< Modulation scheme. */
+	BerFunction ber_function_; /**< BER of the modulation in closed form. */
+	double penalty_db_; /**< SNR penalty in dB. */
+	double penalty_; /**< SNR penalty in linear scale. */
+	double step_db_; /**< Step of the BER table in dB, 0 if not used. */
+	const std::vector<double> *table_; /**< BER table, null if not used. */
+
+	typedef std::pair<int, double> TableKey; /**< Modulation and step. */
+	static std::map<TableKey, std::vector<double> *>
+			tables_; /**< BER tables built so far. */
+};
+
+#endif /* UWBERKERNEL_H */
@@ -32,3 +32,4 @@
 
 Module/UW/PHYSICAL set tx_power_consumption_ 3.3
 Module/UW/PHYSICAL set rx_power_consumption_ 0.620
+Module/UW/PHYSICAL set ber_table_step_dB_ 0
@@ -111,6 +111,8 @@ public:
 
 UnderwaterPhysical::UnderwaterPhysical()
 	: modulation_name_("BPSK")
+	, ber_kernel_(UwBerKernel::MOD_BPSK)
+	, ber_table_step_db_(0)
 	, time_ready_to_end_rx_(0)
 	, Tx_Time_(0)
 	, Rx_Time_(0)
@@ -127,14 +129,26 @@ UnderwaterPhysical::UnderwaterPhysical()
 	, collisionDATA(0)
 	, Interference_Model("CHUNK")
 	, interference_(nullptr)
+	, chunk_sinr_()
+	, chunk_nbits_()
+	, chunk_per_()
+	, chunk_ber_()
+	, phy_stats_(nullptr)
+	, stats_pub_()
+	, snapshot_timer_(this)
+	, snapshot_due_()
+	, publish_due_()
 {
 	bind("rx_power_consumption_", &rx_power_);
 	bind("tx_power_consumption_", &tx_power_);
-	stats_ptr = new UwPhysicalStats();
+	bind("ber_table_step_dB_", &ber_table_step_db_);
+	phy_stats_ = new UwPhysicalStats();
+	stats_ptr = phy_stats_;
 }
 
 UnderwaterPhysical::~UnderwaterPhysical()
 {
+	snapshot_timer_.force_cancel();
 	delete stats_ptr;
 	stats_ptr = nullptr;
 }
@@ -187,9 +201,12 @@ UnderwaterPhysical::command(int argc, const char *const *argv)
 							modulation_name_ != "8PSK" &&
 							modulation_name_ != "16PSK" &&
 							modulation_name_ != "32PSK")) {
+				ber_kernel_.setModulation(UwBerKernel::MOD_NONE);
 				tcl.result("Empty or wrong name for the modulation scheme");
 				return TCL_ERROR;
 			}
+			ber_kernel_.setModulation(
+					UwBerKernel::getModulation(modulation_name_));
 
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "setInterferenceModel") == 0) {
@@ -210,6 +227,20 @@ UnderwaterPhysical::command(int argc, const char *const *argv)
 				return TCL_ERROR;
 			}
 
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "subscribeStats") == 0) {
+			stats_pub_.subscribe(atoi(argv[2]), 0, NOW);
+			scheduleStatsSnapshot();
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "unsubscribeStats") == 0) {
+			stats_pub_.unsubscribe(atoi(argv[2]));
+			scheduleStatsSnapshot();
+			return TCL_OK;
+		}
+	} else if (argc == 4) {
+		if (strcasecmp(argv[1], "subscribeStats") == 0) {
+			stats_pub_.subscribe(atoi(argv[2]), atof(argv[3]), NOW);
+			scheduleStatsSnapshot();
 			return TCL_OK;
 		}
 	}
@@ -415,25 +446,46 @@ UnderwaterPhysical::endRx(Packet *p)
 			bool error_ni = 0;
 			double interference_power = 0;
 			if (interference_) {
+				const InterferenceResult &interf =
+						interference_->getInterference(
+								p, Interference_Model == "CHUNK");
 				if (Interference_Model == "CHUNK") {
-					const PowerChunkList &power_chunk_list =
-							interference_->getInterferencePowerChunkList(p);
+					const PowerChunkList &power_chunk_list = interf.chunks;
 					if (power_chunk_list.size() < 1) {
 						// we have no interferent
 						sinr = ph->Pr / ph->Pn;
-						per_ni = getPER(sinr, nbits, p);
-						ber_ni = getPER(sinr, 1, p);
+						getBatchPER(&sinr, &nbits, 1, p, &per_ni, &ber_ni);
 						error_ni = x <= per_ni;
 					} else {
+						int n_chunks = power_chunk_list.size();
+						chunk_sinr_.resize(n_chunks);
+						chunk_nbits_.resize(n_chunks);
+						chunk_per_.resize(n_chunks);
+						chunk_ber_.resize(n_chunks);
+						int i = 0;
+						for (PowerChunkList::const_iterator itInterf =
+										power_chunk_list.begin();
+								itInterf != power_chunk_list.end();
+								itInterf++, i++) {
+							chunk_nbits_[i] = itInterf->second * BitRate_;
+							chunk_sinr_[i] =
+									ph->Pr / (ph->Pn + itInterf->first);
+						}
+						getBatchPER(&chunk_sinr_[0],
+								&chunk_nbits_[0],
+								n_chunks,
+								p,
+								&chunk_per_[0],
+								&chunk_ber_[0]);
+						i = 0;
 						for (PowerChunkList::const_iterator itInterf =
 										power_chunk_list.begin();
 								itInterf != power_chunk_list.end();
-								itInterf++) {
-							int nbits2 = itInterf->second * BitRate_;
+								itInterf++, i++) {
 							interference_power = itInterf->first;
-							sinr = ph->Pr / (ph->Pn + itInterf->first);
-							per_ni = getPER(sinr, nbits2, p);
-							ber_ni = getPER(sinr, 1, p);
+							sinr = chunk_sinr_[i];
+							per_ni = chunk_per_[i];
+							ber_ni = chunk_ber_[i];
 							x = RNG::defaultrng()->uniform_double();
 							error_ni = x <= per_ni;
 							if (error_ni) {
@@ -442,10 +494,9 @@ UnderwaterPhysical::endRx(Packet *p)
 						}
 					}
 				} else if (Interference_Model == "MEANPOWER") {
-					interference_power = interference_->getInterferencePower(p);
+					interference_power = interf.power;
 					sinr = ph->Pr / (ph->Pn + interference_power);
-					per_ni = getPER(sinr, nbits, p);
-					ber_ni = getPER(sinr, 1, p);
+					getBatchPER(&sinr, &nbits, 1, p, &per_ni, &ber_ni);
 					error_ni = x <= per_ni;
 				} else {
 					printOnLog(Logger::LogLevel::ERROR,
@@ -456,13 +507,12 @@ UnderwaterPhysical::endRx(Packet *p)
 
 					exit(1);
 				}
-				interferent_pkts = interference_->getCounters(p);
+				interferent_pkts = interf.counters;
 
 			} else {
 				interference_power = ph->Pi;
 				sinr = ph->Pr / (ph->Pn + ph->Pi);
-				per_ni = getPER(sinr, nbits, p);
-				ber_ni = getPER(sinr, 1, p);
+				getBatchPER(&sinr, &nbits, 1, p, &per_ni, &ber_ni);
 				error_ni = x <= per_ni;
 			}
 
@@ -471,20 +521,16 @@ UnderwaterPhysical::endRx(Packet *p)
 				error_ni = 0; // error transfered on noise
 			}
 			// update stats and trigger the modules that collect the stats
-			auto uwphystats = dynamic_cast<UwPhysicalStats *>(stats_ptr);
-			if (uwphystats) {
-				uwphystats->updateStats(getId(),
-						getStackId(),
-						ph->Pr,
-						ph->Pn,
-						interference_power,
-						sinr,
-						ber_ni,
-						per_ni,
-						(error_n > 0 || error_ni > 0));
-			}
-			ClMsgTriggerStats m = ClMsgTriggerStats();
-			sendSyncClMsg(&m);
+			phy_stats_->updateStats(getId(),
+					getStackId(),
+					ph->Pr,
+					ph->Pn,
+					interference_power,
+					sinr,
+					ber_ni,
+					per_ni,
+					(error_n > 0 || error_ni > 0));
+			publishStats();
 
 			if (time_ready_to_end_rx_ > Scheduler::instance().clock()) {
 				Rx_Time_ = Rx_Time_ + ph->duration - time_ready_to_end_rx_ +
@@ -555,34 +601,18 @@ UnderwaterPhysical::endRx(Packet *p)
 double
 UnderwaterPhysical::getPER(double _snr, int _nbits, Packet *_p)
 {
-	double snr_with_penalty = _snr * pow(10, RxSnrPenalty_dB_ / 10.0);
-
-	double ber_ = 0;
-	if (modulation_name_ == "BPSK") {
-		ber_ = 0.5 * erfc(sqrt(snr_with_penalty));
-	} else if (modulation_name_ == "BFSK") {
-		ber_ = 0.5 * exp(-snr_with_penalty / 2);
-	} else if (modulation_name_ == "8PSK") {
-		double const M = 8;
-		ber_ = (1 / this->log2(M)) *
-				get_prob_error_symbol_mpsk(snr_with_penalty, M);
-	} else if (modulation_name_ == "16PSK") {
-		double const M = 16;
-		ber_ = (1 / this->log2(M)) *
-				get_prob_error_symbol_mpsk(snr_with_penalty, M);
-	} else if (modulation_name_ == "32PSK") {
-		double const M = 32;
-		ber_ = (1 / this->log2(M)) *
-				get_prob_error_symbol_mpsk(snr_with_penalty, M);
-	}
-
-	if (_nbits == 1) {
-		return ber_;
-	}
-	// PER calculation
-	return 1 - pow(1 - ber_, _nbits);
+	updateBerKernel();
+	return ber_kernel_.getPer(_snr, _nbits);
 } /* UnderwaterPhysical::getPER */
 
+void
+UnderwaterPhysical::getBatchPER(const double *snr, const int *nbits, int n,
+		Packet *_p, double *per, double *ber)
+{
+	updateBerKernel();
+	ber_kernel_.getPer(snr, nbits, n, per, ber);
+} /* UnderwaterPhysical::getBatchPER */
+
 int
 UnderwaterPhysical::recvSyncClMsg(ClMessage *m)
 {
@@ -598,9 +628,62 @@ UnderwaterPhysical::recvSyncClMsg(ClMessage *m)
 		(dynamic_cast<ClMsgStats *>(m))->setStats(stats_ptr);
 		return 0;
 	}
+	if (m->type() == CLMSG_STATS_SUBSCRIBE) {
+		ClMsgStatsSubscribe *sub = static_cast<ClMsgStatsSubscribe *>(m);
+		if (sub->isSubscribe())
+			stats_pub_.subscribe(sub->getSubscriber(), sub->getPeriod(), NOW);
+		else
+			stats_pub_.unsubscribe(sub->getSubscriber());
+		scheduleStatsSnapshot();
+		return 0;
+	}
 	return UnderwaterMPhyBpsk::recvSyncClMsg(m);
 }
 
+void
+UnderwaterPhysical::publishStats()
+{
+	if (!stats_pub_.hasSubscribers())
+		return;
+
+	// a subscriber may unsubscribe while handling the message, so the
+	// list is copied before dispatching
+	publish_due_ = stats_pub_.getSubscribers();
+	for (int id : publish_due_) {
+		ClMsgTriggerStats m(id);
+		m.setStats(stats_ptr);
+		sendSyncClMsg(&m);
+	}
+}
+
+void
+UnderwaterPhysical::statsSnapshot()
+{
+	stats_pub_.getDueSnapshots(NOW, snapshot_due_);
+
+	if (!snapshot_due_.empty()) {
+		updateInstantaneousStats();
+		for (int id : snapshot_due_) {
+			ClMsgTriggerStats m(id);
+			m.setStats(stats_ptr);
+			sendSyncClMsg(&m);
+		}
+	}
+
+	scheduleStatsSnapshot();
+}
+
+void
+UnderwaterPhysical::scheduleStatsSnapshot()
+{
+	double next = stats_pub_.nextSnapshot();
+
+	if (next >= 0)
+		snapshot_timer_.resched(next > NOW ? next - NOW : 0);
+	else
+		snapshot_timer_.force_cancel();
+}
+
 void
 UnderwaterPhysical::updateInstantaneousStats()
 {
@@ -617,7 +700,6 @@ UnderwaterPhysical::updateInstantaneousStats()
 	ph->srcPosition = getPosition();
 	assert(ph->srcSpectralMask);
 
-	(dynamic_cast<UwPhysicalStats *>(stats_ptr))->instant_noise_power =
-			getNoisePower(temp);
+	phy_stats_->instant_noise_power = getNoisePower(temp);
 	Packet::free(temp);
 }
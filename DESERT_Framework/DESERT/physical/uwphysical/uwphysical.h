@@ -41,10 +41,15 @@
 
 #include "clmsg-stats.h"
 #include "underwater-bpsk.h"
+#include "uwberkernel.h"
 #include "uwinterference.h"
+#include "uwstats-utilities.h"
+
+#include <timer-handler.h>
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 class UwPhysicalStats : public Stats
 {
@@ -139,11 +144,60 @@ public:
 	int recvSyncClMsg(ClMessage *m) override;
 
 protected:
+	/**
+	 * Timer of the periodic snapshots of the stats.
+	 */
+	class StatsSnapshotTimer : public TimerHandler
+	{
+	public:
+		/**
+		 * Constructor of StatsSnapshotTimer class.
+		 *
+		 * @param m Pointer to the module that owns the stats.
+		 */
+		StatsSnapshotTimer(UnderwaterPhysical *m)
+			: TimerHandler()
+			, module(m)
+		{
+		}
+
+	protected:
+		/**
+		 * Sends the snapshots that are due.
+		 *
+		 * @param e Pointer to the event that caused the expiration.
+		 */
+		virtual void
+		expire(Event *e)
+		{
+			module->statsSnapshot();
+		}
+
+		UnderwaterPhysical *module; /**< Module that owns the stats. */
+	};
+
 	/**
 	 * Update the stats before sending them through crosslayer message
 	 */
 	virtual void updateInstantaneousStats();
 
+	/**
+	 * Sends the stats to the modules subscribed to every update. Nothing is
+	 * done if no module is subscribed.
+	 */
+	void publishStats();
+
+	/**
+	 * Sends a snapshot of the stats to the periodic subscribers whose
+	 * snapshot is due, and schedules the next one.
+	 */
+	void statsSnapshot();
+
+	/**
+	 * Schedules the snapshot timer at the next snapshot, if any.
+	 */
+	void scheduleStatsSnapshot();
+
 	/**
 	 * Handles the end of a packet transmission
 	 *
@@ -207,6 +261,31 @@ protected:
 	 */
 	virtual double getPER(double snr, int nbits, Packet *_p);
 
+	/**
+	 * Computes the packet and bit error rates of many chunks of the same
+	 * packet at once, e.g. the chunks of constant interference of the CHUNK
+	 * model. The result of each chunk is the same of getPER.
+	 *
+	 * @param snr SNR of each chunk.
+	 * @param nbits Length in bits of each chunk.
+	 * @param n Number of chunks.
+	 * @param _p Packet the chunks belong to.
+	 * @param per PER of each chunk (output).
+	 * @param ber BER of each chunk (output).
+	 */
+	virtual void getBatchPER(const double *snr, const int *nbits, int n,
+			Packet *_p, double *per, double *ber);
+
+	/**
+	 * Updates the BER kernel with the current SNR penalty and table step.
+	 */
+	inline void
+	updateBerKernel()
+	{
+		ber_kernel_.setSnrPenalty(RxSnrPenalty_dB_);
+		ber_kernel_.setTableStep(ber_table_step_db_);
+	}
+
 	/**
 	 * Evaluates is the number passed as input is equal to zero. When C++ works
 	 * with
@@ -417,6 +496,9 @@ protected:
 	}
 
 	std::string modulation_name_; /**< Modulation scheme name. */
+	UwBerKernel ber_kernel_; /**< BER of the modulation scheme. */
+	double ber_table_step_db_; /**< Step in dB of the BER table, 0 to compute
+								  the BER in closed form. */
 	double time_ready_to_end_rx_; /**< Used to keep track of the rx time.*/
 	double Tx_Time_; /**< Time (in seconds) spent by the node in transmission.
 					  */
@@ -442,6 +524,20 @@ protected:
 										CHUNK model or MEANPOWER model */
 
 	uwinterference *interference_; /**< Pointer to the interference module. */
+
+	std::vector<double> chunk_sinr_; /**< SINR of the interference chunks. */
+	std::vector<int> chunk_nbits_; /**< Bits of the interference chunks. */
+	std::vector<double> chunk_per_; /**< PER of the interference chunks. */
+	std::vector<double> chunk_ber_; /**< BER of the interference chunks. */
+
+	UwPhysicalStats *phy_stats_; /**< Stats of the module, same object of
+									stats_ptr. */
+	UwStatsPublisher stats_pub_; /**< Modules subscribed to the stats. */
+	StatsSnapshotTimer snapshot_timer_; /**< Timer of the periodic
+										   snapshots. */
+	std::vector<int> snapshot_due_; /**< Subscribers of the current
+									   snapshot. */
+	std::vector<int> publish_due_; /**< Subscribers of the current update. */
 };
 
 #endif /* UWPHYSICAL_H  */
@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwpertable.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwPerTable class.
+ *
+ */
+
+#include "uwpertable.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+std::map<std::string, UwPerTable *> UwPerTable::tables_;
+
+UwPerTable::UwPerTable()
+	: keys_()
+	, pers_()
+{
+}
+
+bool
+UwPerTable::load(const std::string &file_name, char separator)
+{
+	std::ifstream input_file_(file_name.c_str());
+	if (!input_file_.is_open())
+		return false;
+
+	std::vector<std::pair<double, double> > rows_;
+	std::string line_;
+	std::string token_;
+	while (std::getline(input_file_, line_)) {
+		std::istringstream iss_(line_);
+		getline(iss_, token_, separator);
+		char *end_;
+		double key_ = strtod(token_.c_str(), &end_);
+		if (end_ == token_.c_str())
+			continue;
+		token_.clear();
+		getline(iss_, token_, separator);
+		rows_.push_back(std::make_pair(key_, strtod(token_.c_str(), NULL)));
+	}
+
+	// Stable sort keeps the first line of a repeated key in front
+	std::stable_sort(rows_.begin(),
+			rows_.end(),
+			[](const std::pair<double, double> &a,
+					const std::pair<double, double> &b) {
+				return a.first < b.first;
+			});
+	keys_.clear();
+	pers_.clear();
+	for (size_t i = 0; i < rows_.size(); i++) {
+		if (!keys_.empty() && keys_.back() == rows_[i].first)
+			continue;
+		keys_.push_back(rows_[i].first);
+		pers_.push_back(rows_[i].second);
+	}
+	return true;
+}
+
+double
+UwPerTable::getPer(double key) const
+{
+	std::vector<double>::const_iterator it =
+			std::lower_bound(keys_.begin(), keys_.end(), key);
+	if (it == keys_.end() || *it != key)
+		return (-INT_MAX);
+	return pers_[it - keys_.begin()];
+}
+
+double
+UwPerTable::interpolatePer(double key) const
+{
+	if (keys_.empty())
+		return (-INT_MAX);
+	if (key <= keys_.front())
+		return pers_.front();
+	if (key >= keys_.back())
+		return pers_.back();
+
+	size_t hi = std::upper_bound(keys_.begin(), keys_.end(), key) -
+			keys_.begin();
+	size_t lo = hi - 1;
+	double w = (key - keys_[lo]) / (keys_[hi] - keys_[lo]);
+	return pers_[lo] + w * (pers_[hi] - pers_[lo]);
+}
+
+const UwPerTable &
+UwPerTable::getTable(const std::string &file_name, char separator)
+{
+	std::map<std::string, UwPerTable *>::iterator it =
+			tables_.find(file_name);
+	if (it != tables_.end())
+		return *(it->second);
+
+	UwPerTable *table_ = new UwPerTable();
+	if (!table_->load(file_name, separator)) {
+		std::cerr << "Impossible to open file " << file_name << std::endl;
+		exit(1);
+	}
+	tables_[file_name] = table_;
+	return *table_;
+}
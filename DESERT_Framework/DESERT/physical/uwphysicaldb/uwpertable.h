@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwpertable.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwPerTable class, a PER curve of UnderwaterPhysicaldb
+ * loaded once and shared by all the nodes.
+ *
+ */
+
+#ifndef UWPERTABLE_H
+#define UWPERTABLE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * PER curve read from a file whose lines hold a key (SNR or SIR) and the
+ * corresponding PER. The keys are kept sorted in a contiguous array.
+ */
+class UwPerTable
+{
+public:
+	/**
+	 * Constructor of UwPerTable class, the table is empty.
+	 */
+	UwPerTable();
+
+	/**
+	 * Parses a PER file. When a key is repeated the first line is kept.
+	 *
+	 * @param file_name Name of the file
+	 * @param separator Token separator of the lines
+	 * @return <i>true</i> if the file has been read, <i>false</i> otherwise
+	 */
+	bool load(const std::string &file_name, char separator);
+
+	/**
+	 * Returns the PER of a key of the table.
+	 *
+	 * @param key SNR or SIR value, it has to match a key of the file
+	 * @return the PER, -INT_MAX if the key is not in the table
+	 */
+	double getPer(double key) const;
+
+	/**
+	 * Returns the PER of any key, linearly interpolated between the two
+	 * nearest keys of the table and clamped to the first and last one.
+	 *
+	 * @param key SNR or SIR value
+	 * @return the PER, -INT_MAX if the table is empty
+	 */
+	double interpolatePer(double key) const;
+
+	/**
+	 * Returns the table of a file, loading it the first time it is used. The
+	 * simulation is stopped if the file cannot be read.
+	 *
+	 * @param file_name Name of the file
+	 * @param separator Token separator of the lines
+	 * @return the table
+	 */
+	static const UwPerTable &getTable(
+			const std::string &file_name, char separator);
+
+private:
+	std::vector<double> keys_; /**< Sorted keys of the curve. */
+	std::vector<double> pers_; /**< PER of each key. */
+
+	static std::map<std::string, UwPerTable *>
+			tables_; /**< Tables loaded so far, by file name. */
+};
+
+#endif /* UWPERTABLE_H */
@@ -29,3 +29,6 @@
 # @file   uwgainfromdb-default.tcl
 # @author Giovanni Toso
 # @version 1.0.0
+
+Module/UW/PHYSICALDB set interpolate_per_ 0
+Module/UW/PHYSICALDB set ber_table_step_dB_ 0
@@ -67,10 +67,14 @@ UnderwaterPhysicaldb::UnderwaterPhysicaldb()
 	, modulation(nullptr)
 	, interf_val({0.0, 0.0})
 	, token_separator(0)
+	, interpolate_per(0)
+	, snr_tables({})
+	, sir_tables({})
 	, osstream(0)
 
 {
 	bind_error("token_separator_", &token_separator);
+	bind("interpolate_per_", &interpolate_per);
 	path_ = "";
 	token_separator = '\t';
 }
@@ -263,7 +267,7 @@ UnderwaterPhysicaldb::endRx(Packet *p)
 				double endrx_time = ph->rxtime + duration;
 				if (interference_) {
 					double interference_power_ =
-							interference_->getInterferencePower(p);
+							interference_->getInterference(p).power;
 					double interference_start_time_ =
 							interference_->getInitialInterferenceTime();
 					if (interference_power_ > 0) {
@@ -406,18 +410,31 @@ UnderwaterPhysicaldb::getPERfromSNR(
 		//        exit(1);
 	}
 
-	// File's name.
-	osstream.clear();
-	osstream.str("");
-	osstream << path_ << country << "_" << modulation << "_" << type_ << "_"
-			 << nn_range_;
-	const string file_name_ = osstream.str();
+	// Table of the path type and range, the file's name is built only the
+	// first time it is used by this node.
+	const std::pair<string, double> key_(type_, nn_range_);
+	std::map<std::pair<string, double>, const UwPerTable *>::iterator it3 =
+			snr_tables.find(key_);
+	const UwPerTable *table_;
+	if (it3 != snr_tables.end()) {
+		table_ = it3->second;
+	} else {
+		osstream.clear();
+		osstream.str("");
+		osstream << path_ << country << "_" << modulation << "_" << type_
+				 << "_" << nn_range_;
+		table_ = &UwPerTable::getTable(osstream.str(), token_separator);
+		snr_tables[key_] = table_;
+	}
+
+	if (interpolate_per)
+		return table_->interpolatePer(10 * log10(_snr));
 
 	// Nearest neighbor snr.
 	const double nn_snr_ = this->getNearestNeighbor(snr, 10 * log10(_snr));
 
-	// Open the file and get the per that corresponds to the nn_snr_ value.
-	const double per_ = this->retrievePerFromFile(file_name_, nn_snr_);
+	// Get the per that corresponds to the nn_snr_ value.
+	const double per_ = table_->getPer(nn_snr_);
 
 	return per_;
 } /* UnderwaterPhysicaldb::getPERfromSNR */
@@ -430,18 +447,30 @@ UnderwaterPhysicaldb::getPERfromSIR(const double &_sir, const double &_overlap)
 	const double nn_overlap_ = this->getNearestNeighbor(
 			overlap, _overlap * 100); // From [0; 1]  to [0; 100] scale.
 
-	// File's name.
-	osstream.clear();
-	osstream.str("");
-	osstream << path_ << "SIR"
-			 << "_" << modulation << "_" << nn_overlap_;
-	const string file_name_ = osstream.str();
+	// Table of the overlap, the file's name is built only the first time it
+	// is used by this node.
+	std::map<double, const UwPerTable *>::iterator it =
+			sir_tables.find(nn_overlap_);
+	const UwPerTable *table_;
+	if (it != sir_tables.end()) {
+		table_ = it->second;
+	} else {
+		osstream.clear();
+		osstream.str("");
+		osstream << path_ << "SIR"
+				 << "_" << modulation << "_" << nn_overlap_;
+		table_ = &UwPerTable::getTable(osstream.str(), token_separator);
+		sir_tables[nn_overlap_] = table_;
+	}
+
+	if (interpolate_per)
+		return table_->interpolatePer(_sir);
 
 	// Nearest neighbor SIR.
 	const double nn_sir_ = this->getNearestNeighbor(sir, _sir);
 
-	// Open the file and get the per that corresponds to the nn_snr_ value.
-	const double per_ = this->retrievePerFromFile(file_name_, nn_sir_);
+	// Get the per that corresponds to the nn_sir_ value.
+	const double per_ = table_->getPer(nn_sir_);
 
 	return per_;
 } /* UnderwaterPhysicaldb::getPERfromSNR */
@@ -452,30 +481,23 @@ UnderwaterPhysicaldb::getNearestNeighbor(
 {
 	// Check if the value to search for is smaller than the min or greater than
 	// the max.
-	std::set<double>::iterator it_ = _set.begin();
+	std::set<double>::const_iterator it_ = _set.begin();
 	if (_value <= *it_) {
 		return *it_;
 	}
 	it_ = --_set.end();
 	if (_value >= *it_) {
 		return *it_;
+	}
+
+	// First element greater than the value, the previous one is not greater.
+	std::set<double>::const_iterator it_next_ = _set.upper_bound(_value);
+	it_ = it_next_;
+	--it_;
+	if (std::fabs(_value - *it_) <= std::fabs(_value - *it_next_)) {
+		return *it_;
 	} else {
-		for (std::set<double>::const_iterator it_ = _set.begin();
-				it_ != _set.end();
-				it_++) {
-			std::set<double>::const_iterator it_next_ = it_;
-			it_next_++;
-			if (_value >= *it_next_) {
-				continue;
-			} else {
-				if (abs(_value - *it_) <= abs(_value - *it_next_)) {
-					return *it_;
-				} else {
-					return *it_next_;
-				}
-			}
-		}
-		return 0;
+		return *it_next_;
 	}
 } /* UnderwaterPhysicaldb::findNearestNeightbor */
 
@@ -483,38 +505,5 @@ const double
 UnderwaterPhysicaldb::retrievePerFromFile(
 		const std::string &_file_name, const double &_snr) const
 {
-	std::ifstream input_file_;
-	std::string line_;
-	std::string token_;
-
-	// Convert the file name to a char*.
-	char *tmp_ = new char[_file_name.length() + 1];
-	strcpy(tmp_, _file_name.c_str());
-	if (tmp_ == NULL) {
-		fprintf(stderr, "Empty string for the file name");
-	}
-
-	// Open the file, scan for the line and get the per.
-	input_file_.open(tmp_);
-	if (input_file_.is_open()) {
-		while (std::getline(input_file_, line_)) {
-			std::istringstream iss_(line_);
-			getline(iss_, token_, token_separator);
-			std::stringstream ss_(token_);
-			double token_double_;
-			ss_ >> token_double_;
-			if (token_double_ == _snr) {
-				getline(iss_, token_, token_separator);
-				delete[] tmp_;
-				std::stringstream ss_(token_);
-				ss_ >> token_double_;
-				return token_double_;
-			}
-		}
-	} else {
-		cerr << "Impossible to open file " << _file_name << endl;
-		exit(1);
-	}
-	delete[] tmp_;
-	return (-INT_MAX);
+	return UwPerTable::getTable(_file_name, token_separator).getPer(_snr);
 }
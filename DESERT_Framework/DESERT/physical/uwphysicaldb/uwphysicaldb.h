@@ -40,6 +40,7 @@
 #define UWPHYSICALDB_H
 
 #include "uwinterference.h"
+#include "uwpertable.h"
 #include <uwip-module.h>
 #include <uwphysical.h>
 
@@ -119,6 +120,14 @@ protected:
 	 */
 	virtual double getNearestNeighbor(const std::set<double> &, const double &);
 
+	/**
+	 * PER of a value of a file. The file is loaded the first time it is used
+	 * and shared by all the nodes.
+	 *
+	 * @param Name of the file.
+	 * @param SNR or SIR value, it has to match a key of the file.
+	 * @return PER of the value, -INT_MAX if it is not in the file.
+	 */
 	virtual const double retrievePerFromFile(
 			const std::string &, const double &) const;
 
@@ -172,6 +181,12 @@ protected:
 
 	char token_separator; /**< Token used to parse the elements in a line of
 							 the database. */
+	int interpolate_per; /**< If 1 the PER is interpolated between the values
+							of the file instead of taken at the nearest one. */
+	std::map<std::pair<string, double>, const UwPerTable *>
+			snr_tables; /**< PER vs SNR tables by path type and range. */
+	std::map<double, const UwPerTable *>
+			sir_tables; /**< PER vs SIR tables by overlap. */
 
 private:
 	ostringstream osstream;
@@ -31,3 +31,5 @@
 # @version 1.0.0
 
 Module/UW/PHYSICALFROMDB set tau_index_ 1
+Module/UW/PHYSICALFROMDB set use_binary_cache_ 0
+Module/UW/PHYSICALFROMDB set ber_table_step_dB_ 0
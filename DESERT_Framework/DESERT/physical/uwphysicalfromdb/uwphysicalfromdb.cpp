@@ -218,48 +218,12 @@ double
 UnderwaterPhysicalfromdb::retrieveFromFile(const string &_file_name,
 		const int &_row_index, const int &_column_index) const
 {
-	int row_iterator_ = 0;
-	int column_iterator_ = 0;
-	ifstream input_file_;
-	istringstream stm;
-	string line_;
-	string token_;
-	string value_;
-	double return_value_;
-
-	char *tmp_ = new char[_file_name.length() + 1];
-	strcpy(tmp_, _file_name.c_str());
-	if (tmp_ == NULL) {
-		std::cerr << "Impossible to open file " << _file_name << std::endl;
-		fprintf(stderr, "Empty string for the file name");
-	}
-
-	input_file_.open(tmp_);
-	if (input_file_.is_open()) {
-		while (std::getline(input_file_, line_)) {
-			row_iterator_++;
-			if (row_iterator_ == _row_index) {
-				break;
-			}
-		}
-	} else {
-		std::cerr << "Impossible to open file " << _file_name << std::endl;
-	}
-
-	istringstream iss(line_);
-	while (getline(iss, token_, token_separator_)) {
-		column_iterator_++;
-		if (column_iterator_ == _column_index) {
-			value_ = token_;
-		}
-	}
-
-	stm.str(value_);
-	stm >> return_value_;
+	const UwGainMap &map_ = UwGainMapDb::getMap(
+			_file_name, token_separator_, use_binary_cache_ != 0);
+	double return_value_ = map_.get(_row_index, _column_index);
 	// std::cout << "file:" << _file_name << ":column:" << _column_index <<
 	// ":row:" << _row_index << ":gain:" << return_value_ << std::endl;
 
-	delete[] tmp_;
 	if (this->isZero(return_value_)) {
 		return (-INT_MAX);
 	} else {
@@ -121,7 +121,8 @@ protected:
 			const int &_source_depth, const int &_tau_index);
 
 	/**
-	 * Read from a file the value in a specific row - column.
+	 * Read from a file the value in a specific row - column. The file is
+	 * loaded in memory the first time it is used and shared by all the nodes.
 	 *
 	 * @param _file_name name of the file
 	 * @param _row_index index of the row
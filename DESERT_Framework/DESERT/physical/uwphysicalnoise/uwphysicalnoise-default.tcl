@@ -33,3 +33,6 @@
 Module/UW/PHYSICALNOISE set ship_stop			0
 Module/UW/PHYSICALNOISE set debug_noise_			0
 Module/UW/PHYSICALNOISE set granularity			100
+Module/UW/PHYSICALNOISE set ber_table_step_dB_	0
+Module/UW/PHYSICALNOISE set noise_dist_tol_	0
+Module/UW/PHYSICALNOISE set noise_time_tol_	0
@@ -60,11 +60,18 @@ UnderwaterPhysicalNoise::UnderwaterPhysicalNoise()
 	: debug_noise(0)
 	, ship_stop(0)
 	, granularity(100)
+	, noise_dist_tol(0)
+	, noise_time_tol(0)
 	, noise_src()
+	, noise_band()
+	, noise_prop(NULL)
+	, noise_uwmp(NULL)
 {
 	bind("ship_stop", &ship_stop);
 	bind("debug_noise_", &debug_noise);
 	bind("granularity", &granularity);
+	bind("noise_dist_tol_", &noise_dist_tol);
+	bind("noise_time_tol_", &noise_time_tol);
 }
 
 int
@@ -121,8 +128,7 @@ UnderwaterPhysicalNoise::addNoiseSource(
 	sendSyncClMsg(&msg);
 	mac_addr = msg.getAddr();
 
-	Noisesource src{id, len, cat, pos};
-	noise_src.emplace_back(src);
+	noise_src.emplace_back(id, len, cat, pos);
 
 	if (debug_noise)
 		cout << "MAC: " << mac_addr
@@ -138,64 +144,131 @@ UnderwaterPhysicalNoise::removeNoiseSourcefromID(size_t id)
 			noise_src.end());
 }
 
+void
+UnderwaterPhysicalNoise::updateNoiseBand(
+		double f_c, double bw, double spreading)
+{
+	if (noise_band.version >= 0 && noise_band.f_c == f_c &&
+			noise_band.bw == bw && noise_band.granularity == granularity &&
+			noise_band.spreading == spreading)
+		return;
+
+	noise_band.f_c = f_c;
+	noise_band.bw = bw;
+	noise_band.granularity = granularity;
+	noise_band.spreading = spreading;
+	noise_band.sub_bw = bw / granularity;
+	noise_band.freqs.clear();
+	noise_band.thorp.clear();
+
+	double sub_bw = noise_band.sub_bw;
+	for (double freq = f_c - (bw / 2); freq < f_c + (bw / 2);
+			freq += sub_bw) {
+		noise_band.freqs.push_back(freq + sub_bw / 2);
+		noise_band.thorp.push_back(uwlib_Thorp((freq + sub_bw / 2) / 1000.0));
+	}
+
+	noise_band.version++;
+}
+
+double
+UnderwaterPhysicalNoise::sourceNoisePower(
+		const Noisesource &src, double dist) const
+{
+	const size_t n = noise_band.freqs.size();
+	const double *spectrum = src.spectrum.data();
+	const double *thorp = noise_band.thorp.data();
+	double d = dist / 1000.0;
+	double total = 0;
+
+	// Same attenuation as uwlib_AInv, with the spreading loss computed once
+	if (d > 0) {
+		double spreading = noise_band.spreading * 10 * log10(1000 * d);
+		for (size_t i = 0; i < n; i++) {
+			if (spectrum[i] < 0)
+				continue;
+			double gain = pow(10, -0.1 * (d * thorp[i] + spreading));
+			total += spectrum[i] * (gain < 1.0 ? gain : 1.0) *
+					noise_band.sub_bw;
+		}
+	} else {
+		for (size_t i = 0; i < n; i++) {
+			if (spectrum[i] >= 0)
+				total += spectrum[i] * noise_band.sub_bw;
+		}
+	}
+
+	return total;
+}
+
 double
 UnderwaterPhysicalNoise::vesselNoisePower(Packet *p)
 {
 	static int mac_addr = -1;
 
-	ClMsgPhy2MacAddr msg;
-	sendSyncClMsg(&msg);
-	mac_addr = msg.getAddr();
+	if (noise_src.empty())
+		return 0;
+
+	if (debug_noise) {
+		ClMsgPhy2MacAddr msg;
+		sendSyncClMsg(&msg);
+		mac_addr = msg.getAddr();
+	}
 
 	MSpectralMask *sm = getRxSpectralMask(p);
 	assert(sm);
 
-	double f_c = sm->getFreq();
-	double bw = sm->getBandwidth();
-	double sub_bw = bw / granularity;
-	double total = 0;
+	if (propagation_ != noise_prop) {
+		noise_prop = propagation_;
+		noise_uwmp = dynamic_cast<UnderwaterMPropagation *>(propagation_);
+	}
 
-	if (debug_noise)
-		cout << NOW << " MAC Addr: " << mac_addr << ", f_c: " << f_c
-			 << ", bandwidth: " << bw << ", sub_bandwidth: " << sub_bw
-			 << ", granularity: " << granularity << endl;
+	assert(noise_uwmp);
 
-	for (const auto &elem : noise_src) {
+	updateNoiseBand(sm->getFreq(),
+			sm->getBandwidth(),
+			noise_uwmp->uw.practical_spreading);
 
-		Position *dstPos = getPosition();
-		double speed = getSpeedKnots(elem.pos);
+	double total = 0;
 
-		assert(dstPos);
-		assert(propagation_);
+	if (debug_noise)
+		cout << NOW << " MAC Addr: " << mac_addr << ", f_c: " << noise_band.f_c
+			 << ", bandwidth: " << noise_band.bw
+			 << ", sub_bandwidth: " << noise_band.sub_bw
+			 << ", granularity: " << granularity << endl;
 
-		UnderwaterMPropagation *uwmp =
-				dynamic_cast<UnderwaterMPropagation *>(propagation_);
+	Position *dstPos = getPosition();
+	assert(dstPos);
 
-		assert(uwmp);
+	for (auto &elem : noise_src) {
 
+		double speed = getSpeedKnots(elem.pos);
 		double dist = elem.pos->getDist(dstPos);
 
-		for (double freq = f_c - (bw / 2); freq < f_c + (bw / 2);
-				freq += sub_bw) {
+		// Source level of each sub-band, depends only on the vessel speed
+		if (elem.band_version != noise_band.version || elem.speed != speed) {
+			elem.spectrum.resize(noise_band.freqs.size());
+			for (size_t i = 0; i < noise_band.freqs.size(); i++) {
+				elem.spectrum[i] = ship_noise::getNoisefromCategory(
+						elem.category, noise_band.freqs[i], speed, elem.length);
 
-			double noiseTx = ship_noise::getNoisefromCategory(
-					elem.category, (freq + sub_bw / 2), speed, elem.length);
-
-			if (noiseTx < 0) {
-				if (debug_noise)
+				if (elem.spectrum[i] < 0 && debug_noise)
 					std::cout << "ERR: Undefined or wrong ship type!"
 							  << std::endl;
-
-				continue;
 			}
+			elem.band_version = noise_band.version;
+			elem.speed = speed;
+			elem.dist = -1;
+		}
 
-			double gain = uwlib_AInv(dist / 1000.0,
-					uwmp->uw.practical_spreading,
-					(freq + sub_bw / 2) / 1000.0);
-			double noiseRx = noiseTx * gain * sub_bw;
-
-			total += noiseRx;
+		if (elem.dist < 0 || fabs(dist - elem.dist) > noise_dist_tol ||
+				(noise_time_tol > 0 && NOW - elem.time > noise_time_tol)) {
+			elem.power = sourceNoisePower(elem, dist);
+			elem.dist = dist;
+			elem.time = NOW;
 		}
+
+		total += elem.power;
 	}
 
 	if (debug_noise)
@@ -43,6 +43,10 @@
 #include "uwphysical.h"
 #include "uwsmposition.h"
 
+#include <vector>
+
+class UnderwaterMPropagation;
+
 class UnderwaterPhysicalNoise : public UnderwaterPhysical
 {
 
@@ -103,15 +107,85 @@ public:
 
 protected:
 	/**
-	 * Struct that contains the parameters of a vessel.
+	 * Struct that contains the parameters of a vessel and the cache of the
+	 * noise power it generates at this receiver.
 	 */
 	struct Noisesource {
 		size_t id;
 		double length;
 		ship_noise::ShipCategory category;
 		Position *pos;
+		double speed; /**< Speed used to compute the spectrum [knots]. */
+		int band_version; /**< Band of the spectrum, -1 if not computed. */
+		std::vector<double> spectrum; /**< Source level of each sub-band. */
+		double power; /**< Cached received noise power. */
+		double dist; /**< Distance used to compute the cached power [m]. */
+		double time; /**< Time the cached power was computed. */
+
+		Noisesource(size_t id, double len, ship_noise::ShipCategory cat,
+				Position *pos)
+			: id(id)
+			, length(len)
+			, category(cat)
+			, pos(pos)
+			, speed(0)
+			, band_version(-1)
+			, spectrum()
+			, power(0)
+			, dist(-1)
+			, time(0)
+		{
+		}
 	};
 
+	/**
+	 * Sub-bands of the receiver band, with the terms of the attenuation that
+	 * depend only on the frequency.
+	 */
+	struct NoiseBand {
+		double f_c; /**< Carrier frequency [Hz]. */
+		double bw; /**< Bandwidth [Hz]. */
+		double granularity; /**< Number of sub-bands. */
+		double spreading; /**< Spreading factor of the propagation. */
+		double sub_bw; /**< Bandwidth of a sub-band [Hz]. */
+		std::vector<double> freqs; /**< Centre of each sub-band [Hz]. */
+		std::vector<double> thorp; /**< Thorp absorption of each sub-band
+									  [dB/km]. */
+		int version; /**< Incremented at each change of the band. */
+
+		NoiseBand()
+			: f_c(0)
+			, bw(0)
+			, granularity(0)
+			, spreading(0)
+			, sub_bw(0)
+			, freqs()
+			, thorp()
+			, version(-1)
+		{
+		}
+	};
+
+	/**
+	 * Updates the sub-bands if the band of the receiver, the granularity or
+	 * the spreading factor changed.
+	 *
+	 * @param f_c Carrier frequency [Hz]
+	 * @param bw Bandwidth [Hz]
+	 * @param spreading Spreading factor of the propagation
+	 */
+	void updateNoiseBand(double f_c, double bw, double spreading);
+
+	/**
+	 * Computes the noise power of a vessel at the given distance, summing
+	 * the attenuated source level of every sub-band.
+	 *
+	 * @param src Vessel, with an up to date spectrum
+	 * @param dist Distance from the vessel [m]
+	 * @return double Noise power of the vessel
+	 */
+	double sourceNoisePower(const Noisesource &src, double dist) const;
+
 	/**
 	 * Compute the noise power, considering also vessels noise if needed.
 	 *
@@ -132,8 +206,15 @@ protected:
 	int ship_stop; /**< If enabled, the speed is set to zero when the ship
 					  reaches its destination. */
 	double granularity; /**< Number of step for the integration. */
+	double noise_dist_tol; /**< The noise of a vessel is recomputed only if
+							  its distance changed more than this [m]. */
+	double noise_time_tol; /**< The noise of a vessel is recomputed if it is
+							  older than this [s], 0 to disable. */
 	std::vector<Noisesource>
 			noise_src; /**< Vector that stores all the vessels. */
+	NoiseBand noise_band; /**< Sub-bands of the receiver band. */
+	MPropagation *noise_prop; /**< Propagation checked by noise_uwmp. */
+	UnderwaterMPropagation *noise_uwmp; /**< Underwater propagation. */
 };
 
 #endif
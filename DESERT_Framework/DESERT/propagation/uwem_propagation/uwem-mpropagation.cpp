@@ -67,6 +67,7 @@ public:
 UwElectroMagneticMPropagation::UwElectroMagneticMPropagation()
 	: T_(20)
 	, S_(0)
+	, terms_cache_()
 {
 	/*bind_error("token_separator_", &token_separator_);*/
 	bind("T_", &T_);
@@ -80,9 +81,11 @@ UwElectroMagneticMPropagation::command(int argc, const char *const *argv)
 	if (argc == 3) {
 		if (strcasecmp(argv[1], "setT") == 0) {
 			T_ = strtod(argv[2], NULL);
+			terms_cache_.clear();
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "setS") == 0) {
 			S_ = strtod(argv[2], NULL);
+			terms_cache_.clear();
 			return TCL_OK;
 		}
 	}
@@ -100,35 +103,36 @@ UwElectroMagneticMPropagation::getGain(Packet *p)
 	assert(sp);
 	assert(rp);
 
-	if (debug_) {
-		std::cout << NOW << " UwElectroMagneticMPropagation: Tx position= "
-				  << sp->getX() << " " << sp->getY() << " " << sp->getZ()
-				  << std::endl;
-		std::cout << NOW << " UwElectroMagneticMPropagation: Rx position= "
-				  << rp->getX() << " " << rp->getY() << " " << rp->getZ()
-				  << std::endl;
+	return getPathLoss(sp, rp, getTerms(f_));
+}
+
+void
+UwElectroMagneticMPropagation::getGains(Position *sp,
+		const std::vector<Position *> &rp, double f_,
+		std::vector<double> &gains)
+{
+	assert(sp);
+
+	const em_terms &terms = getTerms(f_);
+
+	gains.resize(rp.size());
+	for (size_t i = 0; i < rp.size(); i++) {
+		assert(rp[i]);
+		gains[i] = getPathLoss(sp, rp[i], terms);
 	}
+}
 
-	double duw;
-	double daw;
-	if (sp->getZ() < 0 && rp->getZ() >= 0) {
-		duw = fabs(sp->getZ());
-		daw = sqrt(pow(rp->getZ(), 2) + pow((sp->getY() - rp->getY()), 2) +
-				pow((sp->getX() - rp->getX()), 2));
-	} else {
-		if (sp->getZ() >= 0 && rp->getZ() < 0) {
-			duw = fabs(rp->getZ());
-			daw = sqrt(pow(sp->getZ(), 2) + pow((sp->getY() - rp->getY()), 2) +
-					pow((sp->getX() - rp->getX()), 2));
-		} else {
-			if (sp->getZ() < 0 && rp->getZ() < 0) {
-				duw = sqrt(pow(sp->getZ() - rp->getZ(), 2) +
-						pow((sp->getY() - rp->getY()), 2) +
-						pow((sp->getX() - rp->getX()), 2));
-				daw = 0;
-			} else
-				cerr << "Devices aren't placed in the right position" << endl;
-		}
+const UwElectroMagneticMPropagation::em_terms &
+UwElectroMagneticMPropagation::getTerms(double f_)
+{
+	std::map<double, em_terms>::iterator it = terms_cache_.find(f_);
+	if (it != terms_cache_.end() && it->second.T == T_ && it->second.S == S_)
+		return it->second;
+
+	if (it == terms_cache_.end()) {
+		if (terms_cache_.size() >= EM_TERMS_CACHE_MAX)
+			terms_cache_.clear();
+		it = terms_cache_.insert(std::make_pair(f_, em_terms())).first;
 	}
 
 	double w = 2 * M_PI * (f_);
@@ -145,18 +149,66 @@ UwElectroMagneticMPropagation::getGain(Packet *p)
 
 	double modTauSq = getModTauSquared(etaW);
 
+	em_terms &terms = it->second;
+	terms.T = T_;
+	terms.S = S_;
+	terms.alpha = alpha;
+	terms.beta_db = 20 * log10(beta);
+	terms.f_db = 20 * log10(f_);
+	terms.PLuw2aw = 10 * log10(1 / (modTauSq * (etaW[0] / ETA_A)));
+
+	return terms;
+}
+
+double
+UwElectroMagneticMPropagation::getPathLoss(
+		Position *sp, Position *rp, const em_terms &terms)
+{
+	double sx = sp->getX();
+	double sy = sp->getY();
+	double sz = sp->getZ();
+	double rx = rp->getX();
+	double ry = rp->getY();
+	double rz = rp->getZ();
+
+	if (debug_) {
+		std::cout << NOW << " UwElectroMagneticMPropagation: Tx position= "
+				  << sx << " " << sy << " " << sz << std::endl;
+		std::cout << NOW << " UwElectroMagneticMPropagation: Rx position= "
+				  << rx << " " << ry << " " << rz << std::endl;
+	}
+
+	double duw = 0;
+	double daw = 0;
+	if (sz < 0 && rz >= 0) {
+		duw = fabs(sz);
+		daw = sqrt(pow(rz, 2) + pow((sy - ry), 2) + pow((sx - rx), 2));
+	} else {
+		if (sz >= 0 && rz < 0) {
+			duw = fabs(rz);
+			daw = sqrt(pow(sz, 2) + pow((sy - ry), 2) + pow((sx - rx), 2));
+		} else {
+			if (sz < 0 && rz < 0) {
+				duw = sqrt(pow(sz - rz, 2) + pow((sy - ry), 2) +
+						pow((sx - rx), 2));
+				daw = 0;
+			} else
+				cerr << "Devices aren't placed in the right position" << endl;
+		}
+	}
+
 	double PLaw = 0;
 	double PLuw2aw = 0;
 	double PLuw = 0;
 
 	if (daw > 0)
-		PLaw = 20 * log10(daw) + 20 * log10(f_) - 147.5;
+		PLaw = 20 * log10(daw) + terms.f_db - 147.5;
 
 	if (daw > 0 && duw > 0)
-		PLuw2aw = 10 * log10(1 / (modTauSq * (etaW[0] / ETA_A)));
+		PLuw2aw = terms.PLuw2aw;
 
 	if (duw > 0)
-		PLuw = 8.69 * alpha * duw + 20 * log10(duw) + 20 * log10(beta) + 6;
+		PLuw = 8.69 * terms.alpha * duw + 20 * log10(duw) + terms.beta_db + 6;
 
 	double PLtot = PLaw + PLuw2aw + PLuw;
 
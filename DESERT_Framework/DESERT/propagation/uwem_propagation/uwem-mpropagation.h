@@ -39,11 +39,13 @@
 #include <math.h>
 #include <mphy.h>
 #include <mpropagation.h>
+#include <vector>
 
 #define NOT_FOUND_C_VALUE -1
 #define MU_0 (1.2566 * pow(10, -6)) // [H/m]
 #define E_0 (8.854187817 * pow(10, -12)) // [F/m]
 #define ETA_A 377 // [Ohm]
+#define EM_TERMS_CACHE_MAX 64 // Max carrier frequencies kept in the cache
 
 /**
  * Class used to represents the UWOPTICAL_MPROPAGATION.
@@ -85,11 +87,59 @@ public:
 
 	virtual double getGain(Packet *p);
 
+	/**
+	 * Calculate the gains of the transmissions from one transmitter to many
+	 * receivers on the same carrier frequency. The seawater terms are
+	 * evaluated once for all the receivers.
+	 *
+	 * @param sp Position of the transmitter.
+	 * @param rp Positions of the receivers.
+	 * @param f_ Carrier frequency [Hz].
+	 * @param gains Vector filled with the gain of each receiver, in the same
+	 * order of <i>rp</i>.
+	 */
+	void getGains(Position *sp, const std::vector<Position *> &rp, double f_,
+			std::vector<double> &gains);
+
 	int debug_;
 
 protected:
+	/**
+	 * Terms of the path loss that depend only on the carrier frequency,
+	 * T_ and S_.
+	 */
+	typedef struct em_terms {
+		double T; /**< Temperature used to compute the terms. */
+		double S; /**< Salinity used to compute the terms. */
+		double alpha; /**< Attenuation constant in seawater. */
+		double beta_db; /**< 20 * log10(beta). */
+		double f_db; /**< 20 * log10(f). */
+		double PLuw2aw; /**< Loss of the water to air interface [dB]. */
+	} em_terms;
+
+	/**
+	 * Returns the seawater terms for the given carrier frequency, computing
+	 * them if they are not in the cache or if T_ or S_ changed.
+	 *
+	 * @param f_ Carrier frequency [Hz].
+	 * @return the terms of the path loss for f_.
+	 */
+	const em_terms &getTerms(double f_);
+
+	/**
+	 * Calculate the path loss between two positions.
+	 *
+	 * @param sp Position of the transmitter.
+	 * @param rp Position of the receiver.
+	 * @param terms Seawater terms for the carrier frequency.
+	 * @return the attenuation [dB].
+	 */
+	double getPathLoss(Position *sp, Position *rp, const em_terms &terms);
+
 	double T_; /**< Temperature [°C] */
 	double S_; /**< Salinity [(g/kg)^2] */
+	std::map<double, em_terms>
+			terms_cache_; /**< Seawater terms of each carrier frequency. */
 
 	void getRelativePermittivity(double f_, double *rel_e);
 	double getSigmaSW();
@@ -76,6 +76,7 @@ UwOpticalMPropagation::UwOpticalMPropagation()
 	, omnidirectional_(false)
 	, variable_c_(false)
 	, use_woss_(false)
+	, lut_c_(&UwLut::emptyLut())
 	, lut_file_name_("")
 	, lut_token_separator_(',')
 
@@ -155,18 +156,17 @@ UwOpticalMPropagation::updateC(double depth)
 	std::cout << NOW << " UwOpticalMPropagation::updateC depth = " << depth
 			  << std::endl;
 
-	LUT_c_iter it = lut_c_.lower_bound(depth);
-	assert(it != lut_c_.end());
-	if (it->first == depth) {
-		c_ = it->second.first;
+	int i = lut_c_->lowerBound(depth);
+	assert(i != lut_c_->size());
+	if (lut_c_->getKey(i) == depth) {
+		c_ = lut_c_->getValue(i, LUT_C_COLUMN);
 		return;
 	}
-	assert(it != lut_c_.begin());
-	it--;
-	double d_low = it->first;
-	double c_low = it->second.first;
-	double d_up = (++it)->first;
-	double c_up = it->second.first;
+	assert(i != 0);
+	double d_low = lut_c_->getKey(i - 1);
+	double c_low = lut_c_->getValue(i - 1, LUT_C_COLUMN);
+	double d_up = lut_c_->getKey(i);
+	double c_up = lut_c_->getValue(i, LUT_C_COLUMN);
 	c_ = linearInterpolator(depth, d_low, d_up, c_low, c_up);
 }
 
@@ -228,35 +228,35 @@ UwOpticalMPropagation::getC(Packet *p)
 				use_woss_ ? -source->getAltitude() : -source->getZ();
 		double min_depth_ = min(destination_depth, source_depth);
 		double max_depth_ = max(destination_depth, source_depth);
-		if ((lut_c_.empty() == true) ||
-				(min_depth_ < ((lut_c_.begin())->first) ||
-						(max_depth_ > ((lut_c_.rbegin())->first)))) {
+		if ((lut_c_->empty() == true) ||
+				(min_depth_ < lut_c_->getKey(0) ||
+						(max_depth_ > lut_c_->getKey(lut_c_->size() - 1)))) {
 
 			goto done;
 			// return c_;
 		}
 
-		LUT_c_iter lower = lut_c_.lower_bound(min_depth_);
-		assert(lower != lut_c_.end());
-		if (lower->first > min_depth_) {
-			assert(lower != lut_c_.begin());
+		int lower = lut_c_->lowerBound(min_depth_);
+		assert(lower != lut_c_->size());
+		if (lut_c_->getKey(lower) > min_depth_) {
+			assert(lower != 0);
 			lower--;
 		}
-		double first_depth = lower->first;
-		double temp_depth = lower->first;
-		double c_temp = lower->second.first;
+		double first_depth = lut_c_->getKey(lower);
+		double temp_depth = lut_c_->getKey(lower);
+		double c_temp = lut_c_->getValue(lower, LUT_C_COLUMN);
 		++lower;
-		if (lower->first >= max_depth_) {
+		if (lower == lut_c_->size() || lut_c_->getKey(lower) >= max_depth_) {
 			return c_temp;
 		}
 
 		double average_c = 0;
-		for (; lower->first < max_depth_; ++lower) {
+		for (; lut_c_->getKey(lower) < max_depth_; ++lower) {
 			average_c = average_c +
-					(c_temp + lower->second.first) *
-							(lower->first - temp_depth) / 2;
-			temp_depth = lower->first;
-			c_temp = lower->second.first;
+					(c_temp + lut_c_->getValue(lower, LUT_C_COLUMN)) *
+							(lut_c_->getKey(lower) - temp_depth) / 2;
+			temp_depth = lut_c_->getKey(lower);
+			c_temp = lut_c_->getValue(lower, LUT_C_COLUMN);
 		}
 
 		return average_c / (temp_depth - first_depth);
@@ -328,27 +328,7 @@ UwOpticalMPropagation::getLambertBeerGain(double d, double beta_)
 void
 UwOpticalMPropagation::initializeLUT()
 {
-	ifstream input_file_;
-	string line_;
-	input_file_.open(lut_file_name_.c_str());
-	if (input_file_.is_open()) {
-		lut_c_.clear();
-		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			double d;
-			double c;
-			double t;
-			line_stream >> d;
-			line_stream.ignore(256, lut_token_separator_);
-			line_stream >> c;
-			line_stream.ignore(256, lut_token_separator_);
-			line_stream >> t;
-			lut_c_[d] = std::make_pair(c, t);
-		}
-		input_file_.close();
-	} else {
-		cerr << "Impossible to open file " << lut_file_name_ << endl;
-	}
+	lut_c_ = &UwLut::getLut(lut_file_name_, lut_token_separator_, 2);
 }
 
 double
@@ -377,43 +357,49 @@ UwOpticalMPropagation::getLambertBeerGain_variableC(
 
 	// if(min_depth_ < ((lut_c_.begin()) -> first) || max_depth_ >
 	// ((--lut_c_.end()) -> first) )
-	if ((lut_c_.empty() == true) ||
-			(min_depth_ < ((lut_c_.begin())->first) ||
-					(max_depth_ > ((lut_c_.rbegin())->first))))
+	if ((lut_c_->empty() == true) ||
+			(min_depth_ < lut_c_->getKey(0) ||
+					(max_depth_ > lut_c_->getKey(lut_c_->size() - 1))))
 		return NOT_FOUND_C_VALUE;
-	LUT_c_iter lower = lut_c_.lower_bound(min_depth_);
-	assert(lower != lut_c_.end());
-	if (lower->first > min_depth_) {
-		assert(lower != lut_c_.begin());
+	int lower = lut_c_->lowerBound(min_depth_);
+	assert(lower != lut_c_->size());
+	if (lut_c_->getKey(lower) > min_depth_) {
+		assert(lower != 0);
 		lower--;
 	}
-	LUT_c_iter upper = (--lut_c_.lower_bound(max_depth_));
-	assert(upper != lut_c_.end());
-	if (upper->first > max_depth_) {
-		assert(upper != lut_c_.begin());
+	int upper = lut_c_->lowerBound(max_depth_) - 1;
+	assert(upper >= 0);
+	if (lut_c_->getKey(upper) > max_depth_) {
+		assert(upper != 0);
 		upper--;
 	}
 
-	double temp_depth = lower->first;
-	double c_temp = lower->second.first;
+	double temp_depth = lut_c_->getKey(lower);
+	double c_temp = lut_c_->getValue(lower, LUT_C_COLUMN);
 	++lower;
-	double prev_c = linearInterpolator(
-			min_depth_, temp_depth, lower->first, c_temp, lower->second.first);
-
-	temp_depth = upper->first;
-	c_temp = upper->second.first;
+	double prev_c = linearInterpolator(min_depth_,
+			temp_depth,
+			lut_c_->getKey(lower),
+			c_temp,
+			lut_c_->getValue(lower, LUT_C_COLUMN));
+
+	temp_depth = lut_c_->getKey(upper);
+	c_temp = lut_c_->getValue(upper, LUT_C_COLUMN);
 	++upper;
-	double c_up = linearInterpolator(
-			max_depth_, temp_depth, upper->first, c_temp, upper->second.first);
+	double c_up = linearInterpolator(max_depth_,
+			temp_depth,
+			lut_c_->getKey(upper),
+			c_temp,
+			lut_c_->getValue(upper, LUT_C_COLUMN));
 
 	double temp_c = 0;
 	temp_depth = 0;
 
 	for (; lower != upper; ++lower) {
-		temp_c = lower->second.first;
+		temp_c = lut_c_->getValue(lower, LUT_C_COLUMN);
 		c_med = (prev_c + temp_c) / 2;
 		prev_c = temp_c;
-		temp_depth = lower->first;
+		temp_depth = lut_c_->getKey(lower);
 		dist_bottom = (temp_depth - min_depth_) / sin(beta_);
 		PCgain = exp(-c_med * (dist_bottom - dist_top)) * PCgain;
 		dist_top = dist_bottom;
@@ -434,17 +420,16 @@ UwOpticalMPropagation::getLambertBeerGain_variableC(
 double
 UwOpticalMPropagation::getTemperature(double depth)
 {
-	if (!variable_c_ || lut_c_.empty() == true)
+	if (!variable_c_ || lut_c_->empty() == true)
 		return NOT_VARIABLE_TEMPERATURE;
-	LUT_c_iter it = lut_c_.lower_bound(depth);
-	assert(it != lut_c_.end());
-	if (it->first == depth) {
-		return it->second.second;
+	int i = lut_c_->lowerBound(depth);
+	assert(i != lut_c_->size());
+	if (lut_c_->getKey(i) == depth) {
+		return lut_c_->getValue(i, LUT_TEMPERATURE_COLUMN);
 	}
-	it--;
-	double d_low = it->first;
-	double t_low = it->second.second;
-	double d_up = (++it)->first;
-	double t_up = it->second.second;
+	double d_low = lut_c_->getKey(i - 1);
+	double t_low = lut_c_->getValue(i - 1, LUT_TEMPERATURE_COLUMN);
+	double d_up = lut_c_->getKey(i);
+	double t_up = lut_c_->getValue(i, LUT_TEMPERATURE_COLUMN);
 	return linearInterpolator(depth, d_low, d_up, t_low, t_up);
 }
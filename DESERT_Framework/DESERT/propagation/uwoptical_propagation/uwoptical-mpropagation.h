@@ -43,14 +43,14 @@
 #include <map>
 #include <mphy.h>
 #include <mpropagation.h>
+#include <uwlut.h>
 
 #define NOT_FOUND_C_VALUE -1
 #define NOT_VARIABLE_TEMPERATURE -20
 
-/*typedef ::std::map< double, double > LUT_c;*/
-typedef ::std::pair<double, double> c_temperat;
-typedef ::std::map<double, c_temperat> LUT_c;
-typedef LUT_c::iterator LUT_c_iter;
+// columns of the LUT versus the depth
+#define LUT_C_COLUMN 0
+#define LUT_TEMPERATURE_COLUMN 1
 
 /**
  * Class used to represents the UWOPTICAL_MPROPAGATION.
@@ -201,8 +201,9 @@ protected:
 	bool variable_c_; /**< Flag to set whether the attenuation is constant or
 						 not. By default it is false */
 	bool use_woss_; /**< Flag to set the woss. By default it is false */
-	LUT_c lut_c_; /**< Lookup table map of the attenuation coefficient and the
-					 temperature versus the depth*/
+	const UwLut *lut_c_; /**< Lookup table of the attenuation coefficient and
+							the temperature versus the depth, shared by the
+							nodes using the same file */
 	string lut_file_name_; /**< LUT file name */
 	char lut_token_separator_; /**< LUT token separator */
 };
@@ -42,3 +42,4 @@ Module/UW/RANGING_TDOA  set delay_start_  0
 Module/UW/RANGING_TDOA  set poisson_traffic 0
 Module/UW/RANGING_TDOA  set range_entries 0
 Module/UW/RANGING_TDOA  set soundspeed 1500.0
+Module/UW/RANGING_TDOA  set pkt_history_ 16
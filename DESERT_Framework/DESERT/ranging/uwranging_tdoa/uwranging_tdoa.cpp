@@ -50,6 +50,8 @@
 #include <uwstats-utilities.h>
 #include <rng.h>
 
+#include <algorithm>
+
 // define a macro to print debug messages
 // 0: NONE	-	1: ERR	-	2: DBG
 #define DEBUG(level, text)                                                    \
@@ -99,6 +101,7 @@ UwRangingTDOA::UwRangingTDOA()
 	, packet_id(0)
 	, n_nodes(0)
 	, dist_num(0)
+	, pkt_history(UWRANGING_TDOA_DEFAULT_HISTORY)
 	, range_entries(0)
 	, poisson_traffic(0)
 	, range_pkts_sent(0)
@@ -117,8 +120,7 @@ UwRangingTDOA::UwRangingTDOA()
 	, full_pkt_tx_dur(0)
 	, soundspeed(1500.)
 	, tof_map()
-	, entries_mat()
-	, times_mat()
+	, pkt_store()
 	, last_ids()
 	, time_of_flights()
 	, entries_timestamps()
@@ -134,6 +136,7 @@ UwRangingTDOA::UwRangingTDOA()
 	bind("delay_start_", (double *) &delay_start);
 	bind("poisson_traffic", (int *) &poisson_traffic);
 	bind("range_entries", (int *) &range_entries);
+	bind("pkt_history_", (int *) &pkt_history);
 	bind("soundspeed", (double *) &soundspeed);
 
 	if (n_nodes < 0 || n_nodes > std::numeric_limits<uwrange_node_t>::max()) {
@@ -142,10 +145,13 @@ UwRangingTDOA::UwRangingTDOA()
 	}
 
 	dist_num = (n_nodes * (n_nodes - 1) / 2);
-	entries_mat.resize(n_nodes,
-			std::vector<std::vector<tdoa_entry>>(
-					PKTIDMAX, std::vector<tdoa_entry>(n_nodes, tdoa_entry())));
-	times_mat.resize(n_nodes, std::vector<double>(PKTIDMAX, -1.));
+	if (pkt_history <= 0 || pkt_history > (int) PKTIDMAX) {
+		DEBUG(0, "Invalid pkt_history_, setting default")
+		pkt_history = UWRANGING_TDOA_DEFAULT_HISTORY;
+	}
+
+	pkt_store.resize(n_nodes, pkt_history);
+	tx_timestamp.resize(PKTIDMAX, 0);
 	last_ids.resize(n_nodes, -1);
 	time_of_flights.resize(dist_num, -1.0);
 	entries_timestamps.resize(dist_num, -0.0);
@@ -299,43 +305,42 @@ UwRangingTDOA::entryWeight(int entry, int pkt_size, int mode) const
 int
 UwRangingTDOA::calcOptEntries(std::vector<int> *sorted_entries) const
 {
-	int opt_n_entries = (range_entries > 0 ? range_entries : n_nodes - 1);
+	int max_entries = std::min(n_nodes - 1, MAX_NUM_NODES);
+	int opt_n_entries = (range_entries > 0
+					? std::min(range_entries, max_entries)
+					: max_entries);
+	std::vector<int> candidates;
+
+	candidates.reserve(n_nodes);
+	for (int entry = 0; entry < n_nodes; entry++) {
+		if (entry != node_id)
+			candidates.push_back(entry);
+	}
 
 	if (range_entries <= 0) {
-		std::multimap<double, int, std::greater<double>> sorted_pairs;
-		double max_weight = 0.0;
+		// The PDR of an entry is decreasing in its BER for any packet size,
+		// so the best n_entries are always the first ones of this ranking.
+		std::vector<int> by_pdr(candidates);
+		std::stable_sort(by_pdr.begin(), by_pdr.end(), [this](int a, int b) {
+			return (1 - ber[a]) > (1 - ber[b]);
+		});
 
-		for (int n_entries = 1; n_entries < n_nodes; n_entries++) {
-			sorted_pairs.clear();
+		double max_weight = 0.0;
 
+		for (int n_entries = 1; n_entries <= max_entries; n_entries++) {
 			int pkt_size = 8 * hdr_ranging_tdoa::getSize(n_entries);
+			double weight = 0.0;
 
-			for (int entry = 0; entry < n_nodes; entry++) {
-				if (entry == node_id)
-					continue;
-
-				double w =
-						entryWeight(entry, pkt_size, 0); // weight is just PDR
+			for (int i = 0; i < n_entries; i++) {
+				double w = entryWeight(
+						by_pdr[i], pkt_size, 0); // weight is just PDR
 
-				sorted_pairs.insert(std::pair<double, int>(w, entry));
+				weight += w;
 				DEBUG(2,
-						"entryWeight(" << entry << "," << n_entries
+						"entryWeight(" << by_pdr[i] << "," << n_entries
 									   << ")= " << w << "")
 			}
 
-			double weight = 0.0;
-			std::multimap<double, int>::iterator iter = sorted_pairs.begin();
-
-			for (int i = 0; i < n_entries;
-					i++) // was i < n_entries for considering only best entries
-			{
-				weight += 1 * (iter->first); // was without n_entries for
-											 // considering only best entries
-				iter++;
-				if (iter == sorted_pairs.end())
-					break;
-			}
-
 			if (weight > max_weight) {
 				max_weight = weight;
 				opt_n_entries = n_entries;
@@ -345,25 +350,23 @@ UwRangingTDOA::calcOptEntries(std::vector<int> *sorted_entries) const
 		}
 	}
 
-	int pkt_size = 8 * hdr_ranging_tdoa::getSize(opt_n_entries);
-
-	std::multimap<double, int, std::greater<double>> sorted_pairs;
-
-	for (int entry = 0; entry < n_nodes; entry++) {
-		if (entry == node_id)
-			continue;
+	if (sorted_entries && opt_n_entries > 0) {
+		int pkt_size = 8 * hdr_ranging_tdoa::getSize(opt_n_entries);
+		std::vector<std::pair<double, int>> ranked;
 
-		sorted_pairs.insert(std::pair<double, int>(
-				entryWeight(entry, pkt_size, range_entries), entry));
-	}
+		// Highest weight first, ties broken by lowest node id
+		ranked.reserve(candidates.size());
+		for (size_t i = 0; i < candidates.size(); i++) {
+			ranked.push_back(std::make_pair(
+					-entryWeight(candidates[i], pkt_size, range_entries),
+					candidates[i]));
+		}
 
-	std::multimap<double, int>::iterator iter = sorted_pairs.begin();
+		std::partial_sort(
+				ranked.begin(), ranked.begin() + opt_n_entries, ranked.end());
 
-	if (sorted_entries) {
-		for (int i = 0; i < opt_n_entries; i++) {
-			sorted_entries->push_back(iter->second);
-			iter++;
-		}
+		for (int i = 0; i < opt_n_entries; i++)
+			sorted_entries->push_back(ranked[i].second);
 	}
 
 	DEBUG(2, "calcOptEntries::opt_n_entries = " << opt_n_entries)
@@ -386,7 +389,8 @@ UwRangingTDOA::rangeTX()
 	rangh->source_pkt_id = packet_id;
 	rangh->source_node_id = node_id;
 
-	tx_timestamp.emplace((tx_timestamp.begin() + rangh->source_pkt_id), NOW);
+	tx_timestamp[rangh->source_pkt_id] = NOW;
+	pkt_store.reset(node_id, packet_id);
 
 	std::vector<int> sorted_entries;
 	int j = 0;
@@ -402,26 +406,25 @@ UwRangingTDOA::rangeTX()
 								  << " n_nodes: " << n_nodes)
 
 	for (auto i : sorted_entries) {
+		double rx_time = pkt_store.getTime(i, last_ids[i]);
+
 		DEBUG(2,
-				"rangeTX::times_mat[" << i << "][" << last_ids[i]
-									  << "] = " << times_mat[i][last_ids[i]])
-		if (isValid(times_mat[i][last_ids[i]]) && isValid(last_ids[i])) {
-			tdoa_entry new_entry =
-					tdoa_entry(NOW - times_mat[i][last_ids[i]], i, last_ids[i]);
+				"rangeTX::rx time[" << i << "][" << last_ids[i]
+									<< "] = " << rx_time)
+		if (isValid(rx_time) && isValid(last_ids[i])) {
+			tdoa_entry new_entry = tdoa_entry(NOW - rx_time, i, last_ids[i]);
 
 			(*rangh).times_[j] = new_entry;
-			entries_mat[node_id][packet_id][i] = new_entry;
+			pkt_store.setEntry(node_id, packet_id, new_entry);
 			j++;
 
 			DEBUG(2,
-					"rangeTX::entries_mat["
-							<< node_id << "][" << packet_id << "][" << i
-							<< "].time\t= "
-							<< entries_mat[node_id][packet_id][i].time)
+					"rangeTX::entry[" << node_id << "][" << packet_id << "]["
+									  << i << "].time\t= " << new_entry.time)
 		} else {
 			DEBUG(1,
 					"rangeTX::entry not valid for node "
-							<< i << " times_mat:" << times_mat[i][last_ids[i]]
+							<< i << " rx time:" << rx_time
 							<< " last_ids:" << last_ids[i])
 		}
 	}
@@ -476,7 +479,10 @@ UwRangingTDOA::updateHoldoverTime(Packet *p, double tx_duration)
 
 		elem.time += NOW + tx_duration + mac2phy_delay -
 				tx_timestamp[rangh->source_pkt_id];
-		entries_mat[node_id][rangh->source_pkt_id][elem.node].time = elem.time;
+		tdoa_entry *stored =
+				pkt_store.getEntry(node_id, rangh->source_pkt_id, elem.node);
+		if (stored)
+			stored->time = elem.time;
 
 		DEBUG(2, "updateHoldoverTime::tx_duration = " << tx_duration)
 		DEBUG(2, "updateHoldoverTime::mac2phy_delay = " << mac2phy_delay)
@@ -484,19 +490,19 @@ UwRangingTDOA::updateHoldoverTime(Packet *p, double tx_duration)
 				"updateHoldoverTime::tx_timestamp = "
 						<< tx_timestamp[rangh->source_pkt_id])
 		DEBUG(2,
-				"updateHoldoverTime::entries_mat["
+				"updateHoldoverTime::entry["
 						<< node_id << "][" << (int) rangh->source_pkt_id << "]["
 						<< (int) elem.node << "].time = " << elem.time)
 
 		entry_last_tx[elem.node] = NOW;
 	}
 
-	times_mat[node_id][rangh->source_pkt_id] = NOW + tx_duration;
+	pkt_store.setTime(node_id, rangh->source_pkt_id, NOW + tx_duration);
 
 	DEBUG(2,
-			"updateHoldoverTime::times_mat["
+			"updateHoldoverTime::tx time["
 					<< node_id << "][" << (int) rangh->source_pkt_id
-					<< "] = " << times_mat[node_id][rangh->source_pkt_id])
+					<< "] = " << NOW + tx_duration)
 
 	if (rangh->times_size() == n_nodes - 1)
 		full_pkt_tx_dur = tx_duration;
@@ -509,7 +515,9 @@ UwRangingTDOA::rangeRX(const Packet *p)
 	int pkt_node_id = rangh->source_node_id;
 	int pkt_id = rangh->source_pkt_id;
 
-	times_mat[pkt_node_id][pkt_id] = NOW;
+	// reset the time and all the entries relative to the incoming packet
+	pkt_store.reset(pkt_node_id, pkt_id);
+	pkt_store.setTime(pkt_node_id, pkt_id, NOW);
 	last_ids[pkt_node_id] = pkt_id;
 
 	if (!isValid(pkt_id))
@@ -517,36 +525,30 @@ UwRangingTDOA::rangeRX(const Packet *p)
 				"ERROR! invalid pkt_id: " << pkt_id << " from node "
 										  << pkt_node_id)
 
-	for (size_t i = 0; i < entries_mat[pkt_node_id][pkt_id].size(); ++i) {
-		// reset all entries relative to the incoming packet present in the
-		// matrix
-		entries_mat[pkt_node_id][pkt_id][i] = tdoa_entry(-1, i, -1);
-	}
-
 	double spherical_tof = -1.;
 	double spherical_timestamp = -1.;
 	for (int i = 0; i < rangh->times_size(); i++) {
 		auto &elem = (*rangh).times_[i];
 
-		entries_mat[pkt_node_id][pkt_id][elem.node] = elem;
+		pkt_store.setEntry(pkt_node_id, pkt_id, elem);
 
 		DEBUG(2, "rangeRX::elem[" << i << "]")
 		DEBUG(2,
-				"rangeRX::entries_mat[" << pkt_node_id << "][" << pkt_id << "]["
-										<< (int) elem.node
-										<< "].time = " << elem.time)
+				"rangeRX::entry[" << pkt_node_id << "][" << pkt_id << "]["
+								  << (int) elem.node
+								  << "].time = " << elem.time)
 
 		if (elem.node == node_id) {
-			// if packet referred in elem.id is not too old
-			if (NOW - times_mat[node_id][elem.id] < max_age) {
-				spherical_tof =
-						(NOW - times_mat[node_id][elem.id] - elem.time) / 2.;
-				spherical_timestamp = (NOW + times_mat[node_id][elem.id]) / 2.;
+			double tx_time = pkt_store.getTime(node_id, elem.id);
+
+			// if packet referred in elem.id is still stored and not too old
+			if (isValid(tx_time) && NOW - tx_time < max_age) {
+				spherical_tof = (NOW - tx_time - elem.time) / 2.;
+				spherical_timestamp = (NOW + tx_time) / 2.;
 
 				DEBUG(2,
-						"rangeRX::times_mat["
-								<< node_id << "][" << (int) elem.id
-								<< "] = " << times_mat[node_id][elem.id])
+						"rangeRX::tx time[" << node_id << "][" << (int) elem.id
+											<< "] = " << tx_time)
 				DEBUG(2, "rangeRX::elem.time = " << elem.time)
 				DEBUG(2, "rangeRX::spherical_tof = " << spherical_tof)
 
@@ -565,14 +567,15 @@ UwRangingTDOA::rangeRX(const Packet *p)
 	for (int i = 0; i < rangh->times_size(); i++) {
 		auto &elem = (*rangh).times_[i];
 
+		double rx_time = pkt_store.getTime(elem.node, elem.id);
+
 		if (isValid(elem) && elem.node != node_id && isValid(spherical_tof) &&
-				isValid(times_mat[elem.node][elem.id]) &&
+				isValid(rx_time) &&
 				isValid(time_of_flights[tof_map[elem.node][node_id]])) {
 
 			DEBUG(2, "rangeRX::elem[" << i << "]")
 
-			double hyperbolic_tof = (NOW -
-					times_mat[elem.node][elem.id] // RX time from elem.node
+			double hyperbolic_tof = (NOW - rx_time // RX time from elem.node
 					- spherical_tof // time distance from source node
 					+ time_of_flights[tof_map[elem.node]
 											 [node_id]] // time distance from
@@ -581,9 +584,8 @@ UwRangingTDOA::rangeRX(const Packet *p)
 					+ mac2phy_delay / (n_nodes - 1));
 
 			DEBUG(2,
-					"rangeRX::times_mat[" << (int) elem.node << "]["
-										  << (int) elem.id << "] "
-										  << times_mat[elem.node][elem.id])
+					"rangeRX::rx time[" << (int) elem.node << "]["
+										<< (int) elem.id << "] " << rx_time)
 			DEBUG(2, "rangeRX::spherical_tof = " << spherical_tof)
 			DEBUG(2,
 					"rangeRX::time_of_flights["
@@ -40,11 +40,15 @@
 #define UWRANGINGTDOA_H
 
 #include "uwranging_tdoa_hdr.h"
+#include "uwranging_tdoa_store.h"
 #include <timer-handler.h>
 #include <limits>
 #include <module.h>
 #include <vector>
 
+#define UWRANGING_TDOA_DEFAULT_HISTORY \
+	16 /**< Default number of packets stored for each node. */
+
 class UwRangingTDOA;
 
 /**
@@ -155,6 +159,8 @@ protected:
 	virtual void updateHoldoverTime(Packet *p, double tx_duration);
 
 	/** Compute the optimal number of entries for the ranging message.
+	 * The entries are ranked by PDR once, then the weight of each number of
+	 * entries is the sum of the PDRs of the best ones.
 	 * @param std::vector<int> Vector of entries to sort.
 	 * @return int Number of optimal entries.
 	 */
@@ -179,6 +185,7 @@ protected:
 					  k*n_nodes)*/
 	int n_nodes; /**< Number of nodes. */
 	int dist_num; /**< Number of distances each node computes. */
+	int pkt_history; /**< Number of ranging packets stored for each node. */
 	int range_entries; /**< Number of entries per ranging packet, if <= 0 enable
 						  adaptive payload size. */
 	int poisson_traffic; /**< If true the ranging packets are sent according to
@@ -205,10 +212,8 @@ protected:
 
 	std::vector<std::vector<int>>
 			tof_map; /*< Map between couples of nodes to a distance. */
-	std::vector<std::vector<std::vector<tdoa_entry>>>
-			entries_mat; /*< Matrix containing the entries for each packet. */
-	std::vector<std::vector<double>>
-			times_mat; /*< Matrix containing the tx/rx times of each packet. */
+	UwRangingTDOAStore pkt_store; /*< Tx/rx times and entries of the last
+									 pkt_history packets of each node. */
 	std::vector<int> last_ids; /*< Vector of ids of the last rx/tx packet. */
 	std::vector<double>
 			time_of_flights; /*< Vector of one way travel times between each
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwranging_tdoa_store.cpp
+ * @version 1.0.0
+ *
+ * @brief Implementation of the class <i>UwRangingTDOAStore</i>.
+ *
+ */
+
+#include "uwranging_tdoa_store.h"
+
+UwRangingTDOAStore::UwRangingTDOAStore(int n_nodes, int history)
+	: history(1)
+	, slots()
+{
+	resize(n_nodes, history);
+}
+
+void
+UwRangingTDOAStore::resize(int n_nodes, int hist)
+{
+	history = (hist > 0 ? hist : 1);
+	slots.assign(n_nodes > 0 ? n_nodes : 0, std::vector<pkt_slot>(history));
+}
+
+UwRangingTDOAStore::pkt_slot &
+UwRangingTDOAStore::claim(int node, int pkt_id)
+{
+	pkt_slot &slot = slots[node][pkt_id % history];
+
+	if (slot.id != pkt_id) {
+		slot.id = pkt_id;
+		slot.time = -1.;
+		slot.entries.clear();
+	}
+
+	return slot;
+}
+
+const UwRangingTDOAStore::pkt_slot *
+UwRangingTDOAStore::find(int node, int pkt_id) const
+{
+	if (node < 0 || (size_t) node >= slots.size() || pkt_id < 0)
+		return nullptr;
+
+	const pkt_slot &slot = slots[node][pkt_id % history];
+
+	return (slot.id == pkt_id ? &slot : nullptr);
+}
+
+double
+UwRangingTDOAStore::getTime(int node, int pkt_id) const
+{
+	const pkt_slot *slot = find(node, pkt_id);
+
+	return (slot ? slot->time : -1.);
+}
+
+void
+UwRangingTDOAStore::setTime(int node, int pkt_id, double time)
+{
+	claim(node, pkt_id).time = time;
+}
+
+tdoa_entry *
+UwRangingTDOAStore::getEntry(int node, int pkt_id, int entry_node)
+{
+	pkt_slot *slot = const_cast<pkt_slot *>(find(node, pkt_id));
+
+	if (!slot)
+		return nullptr;
+
+	for (size_t i = 0; i < slot->entries.size(); i++) {
+		if (slot->entries[i].node == entry_node)
+			return &slot->entries[i];
+	}
+
+	return nullptr;
+}
+
+void
+UwRangingTDOAStore::setEntry(int node, int pkt_id, const tdoa_entry &entry)
+{
+	pkt_slot &slot = claim(node, pkt_id);
+
+	for (size_t i = 0; i < slot.entries.size(); i++) {
+		if (slot.entries[i].node == entry.node) {
+			slot.entries[i] = entry;
+			return;
+		}
+	}
+
+	slot.entries.push_back(entry);
+}
+
+void
+UwRangingTDOAStore::reset(int node, int pkt_id)
+{
+	pkt_slot &slot = claim(node, pkt_id);
+
+	slot.time = -1.;
+	slot.entries.clear();
+}
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwranging_tdoa_store.h
+ * @version 1.0.0
+ *
+ * @brief Provides the definition of the class <i>UwRangingTDOAStore</i>.
+ *
+ */
+
+#ifndef UWRANGINGTDOA_STORE_H
+#define UWRANGINGTDOA_STORE_H
+
+#include "uwranging_tdoa_hdr.h"
+#include <vector>
+
+/**
+ * Bounded store of the ranging packets seen by a UwRangingTDOA node.
+ * For each node it keeps a ring of <i>history</i> slots, each one holding
+ * the id of a packet, its tx/rx time and the entries it carried. A packet
+ * with id <i>k</i> lives in slot <i>k % history</i>, so newer packets
+ * overwrite the older ones and the memory does not depend on the range of
+ * the packet ids.
+ */
+class UwRangingTDOAStore
+{
+public:
+	/**
+	 * Constructor of the UwRangingTDOAStore class.
+	 * @param n_nodes Number of nodes.
+	 * @param history Number of packets kept for each node.
+	 */
+	UwRangingTDOAStore(int n_nodes = 0, int history = 1);
+
+	/**
+	 * Removes all the packets and sets the size of the store.
+	 * @param n_nodes Number of nodes.
+	 * @param history Number of packets kept for each node.
+	 */
+	void resize(int n_nodes, int history);
+
+	/**
+	 * Returns the tx/rx time of a packet.
+	 * @param node Id of the source node of the packet.
+	 * @param pkt_id Id of the packet.
+	 * @return the time of the packet, or -1 if it is not stored.
+	 */
+	double getTime(int node, int pkt_id) const;
+
+	/**
+	 * Sets the tx/rx time of a packet, replacing the older packet stored in
+	 * the same slot.
+	 * @param node Id of the source node of the packet.
+	 * @param pkt_id Id of the packet.
+	 * @param time Time of the packet.
+	 */
+	void setTime(int node, int pkt_id, double time);
+
+	/**
+	 * Returns the entry of a packet that refers to the given node.
+	 * @param node Id of the source node of the packet.
+	 * @param pkt_id Id of the packet.
+	 * @param entry_node Node the entry refers to.
+	 * @return a pointer to the entry, or nullptr if it is not stored.
+	 */
+	tdoa_entry *getEntry(int node, int pkt_id, int entry_node);
+
+	/**
+	 * Stores an entry of a packet, replacing the one that refers to the same
+	 * node, if any.
+	 * @param node Id of the source node of the packet.
+	 * @param pkt_id Id of the packet.
+	 * @param entry Entry to store.
+	 */
+	void setEntry(int node, int pkt_id, const tdoa_entry &entry);
+
+	/**
+	 * Removes the time and all the entries of a packet.
+	 * @param node Id of the source node of the packet.
+	 * @param pkt_id Id of the packet.
+	 */
+	void reset(int node, int pkt_id);
+
+private:
+	/**
+	 * Packet stored in the ring of a node.
+	 */
+	typedef struct pkt_slot {
+		int id; /**< Id of the packet, -1 if the slot is empty. */
+		double time; /**< Tx/rx time of the packet. */
+		std::vector<tdoa_entry> entries; /**< Entries of the packet. */
+
+		pkt_slot()
+			: id(-1)
+			, time(-1.)
+			, entries()
+		{
+		}
+	} pkt_slot;
+
+	/**
+	 * Returns the slot of a packet, claiming it if it holds another packet.
+	 */
+	pkt_slot &claim(int node, int pkt_id);
+
+	/**
+	 * Returns the slot of a packet, or nullptr if it is not stored.
+	 */
+	const pkt_slot *find(int node, int pkt_id) const;
+
+	int history; /**< Number of packets kept for each node. */
+	std::vector<std::vector<pkt_slot>> slots; /**< Ring of each node. */
+};
+
+#endif
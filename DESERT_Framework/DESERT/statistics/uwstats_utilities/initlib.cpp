@@ -39,6 +39,7 @@
 #include <tclcl.h>
 
 ClMessage_t CLMSG_TRIGGER_STATS;
+ClMessage_t CLMSG_STATS_SUBSCRIBE;
 
 extern EmbeddedTcl UwStatsUtilitiesInitTclCode;
 
@@ -46,6 +47,7 @@ extern "C" int
 Uwstats_utilities_Init()
 {
 	CLMSG_TRIGGER_STATS = ClMessage::addClMessage();
+	CLMSG_STATS_SUBSCRIBE = ClMessage::addClMessage();
 	UwStatsUtilitiesInitTclCode.load();
 	return 0;
 }
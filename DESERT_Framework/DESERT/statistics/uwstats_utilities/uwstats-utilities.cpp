@@ -36,19 +36,100 @@
  */
 #include "uwstats-utilities.h"
 
+#include <algorithm>
+
 #define CLMSG_TRIGGER_STATS_VERBOSITY (3)
+#define CLMSG_STATS_SUBSCRIBE_VERBOSITY (3)
 
 ClMsgTriggerStats::ClMsgTriggerStats()
 	: ClMessage(CLMSG_TRIGGER_STATS_VERBOSITY, CLMSG_TRIGGER_STATS)
+	, stats(NULL)
 {
 }
 
 ClMsgTriggerStats::ClMsgTriggerStats(int dest_id)
 	: ClMessage(CLMSG_TRIGGER_STATS_VERBOSITY, CLMSG_TRIGGER_STATS, UNICAST,
 			  dest_id)
+	, stats(NULL)
 {
 }
 
 ClMsgTriggerStats::~ClMsgTriggerStats()
 {
-}
\ No newline at end of file
+}
+
+ClMsgStatsSubscribe::ClMsgStatsSubscribe(
+		int producer_id, int subscriber_id, double period, bool subscribe)
+	: ClMessage(CLMSG_STATS_SUBSCRIBE_VERBOSITY, CLMSG_STATS_SUBSCRIBE,
+			  UNICAST, producer_id)
+	, subscriber(subscriber_id)
+	, period(period)
+	, subscribe(subscribe)
+{
+}
+
+ClMsgStatsSubscribe::~ClMsgStatsSubscribe()
+{
+}
+
+UwStatsPublisher::UwStatsPublisher()
+	: on_update()
+	, periodic()
+{
+}
+
+void
+UwStatsPublisher::subscribe(int id, double period, double now)
+{
+	unsubscribe(id);
+
+	if (period > 0)
+		periodic.push_back({id, period, now + period});
+	else
+		on_update.push_back(id);
+}
+
+bool
+UwStatsPublisher::unsubscribe(int id)
+{
+	size_t size = on_update.size() + periodic.size();
+
+	on_update.erase(std::remove(on_update.begin(), on_update.end(), id),
+			on_update.end());
+	periodic.erase(std::remove_if(periodic.begin(),
+						   periodic.end(),
+						   [id](const periodic_subscriber &s) {
+							   return s.id == id;
+						   }),
+			periodic.end());
+
+	return on_update.size() + periodic.size() != size;
+}
+
+double
+UwStatsPublisher::nextSnapshot() const
+{
+	double next = -1;
+
+	for (const auto &s : periodic) {
+		if (next < 0 || s.next < next)
+			next = s.next;
+	}
+
+	return next;
+}
+
+void
+UwStatsPublisher::getDueSnapshots(double now, std::vector<int> &due)
+{
+	due.clear();
+
+	for (auto &s : periodic) {
+		if (s.next > now)
+			continue;
+
+		due.push_back(s.id);
+		while (s.next <= now)
+			s.next += s.period;
+	}
+}
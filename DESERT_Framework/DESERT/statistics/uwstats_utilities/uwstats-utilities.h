@@ -39,8 +39,12 @@
 #define UW_STATS_UTILTIES_H
 
 #include "clmessage.h"
+#include "clmsg-stats.h"
+
+#include <vector>
 
 extern ClMessage_t CLMSG_TRIGGER_STATS;
+extern ClMessage_t CLMSG_STATS_SUBSCRIBE;
 
 namespace StatsEnum
 {
@@ -72,6 +76,173 @@ public:
 	 * Destructor
 	 */
 	virtual ~ClMsgTriggerStats();
+
+	/**
+	 * Sets the stats of the module that sent the message. The stats are not
+	 * copied, they are valid only while the message is dispatched.
+	 *
+	 * @param in_stats Pointer to the stats of the module
+	 */
+	void
+	setStats(const Stats *in_stats)
+	{
+		stats = in_stats;
+	}
+
+	/**
+	 * @return the stats of the module that sent the message, NULL if not set
+	 */
+	const Stats *
+	getStats() const
+	{
+		return stats;
+	}
+
+protected:
+	const Stats *stats; /**< Stats of the module that sent the message. */
+};
+
+/**
+ * Message sent by a module to subscribe to (or unsubscribe from) the stats
+ * of another module. The subscriber receives a UNICAST ClMsgTriggerStats at
+ * each update of the stats or, if a period is given, a snapshot of the stats
+ * every period seconds.
+ */
+class ClMsgStatsSubscribe : public ClMessage
+{
+
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param producer_id Id of the module whose stats are requested
+	 * @param subscriber_id Id of the module that receives the stats
+	 * @param period Period of the snapshots [s], 0 to receive every update
+	 * @param subscribe true to subscribe, false to unsubscribe
+	 */
+	ClMsgStatsSubscribe(int producer_id, int subscriber_id, double period = 0,
+			bool subscribe = true);
+
+	/**
+	 * Destructor
+	 */
+	virtual ~ClMsgStatsSubscribe();
+
+	/**
+	 * @return the id of the module that receives the stats
+	 */
+	int
+	getSubscriber() const
+	{
+		return subscriber;
+	}
+
+	/**
+	 * @return the period of the snapshots, 0 for every update
+	 */
+	double
+	getPeriod() const
+	{
+		return period;
+	}
+
+	/**
+	 * @return true for a subscription, false to unsubscribe
+	 */
+	bool
+	isSubscribe() const
+	{
+		return subscribe;
+	}
+
+protected:
+	int subscriber; /**< Id of the module that receives the stats. */
+	double period; /**< Period of the snapshots [s], 0 for every update. */
+	bool subscribe; /**< true to subscribe, false to unsubscribe. */
+};
+
+/**
+ * Keeps the modules subscribed to the stats of a module, either to every
+ * update or to periodic snapshots. The module that owns the stats checks
+ * hasSubscribers() before building any message, so that nothing is
+ * dispatched when nobody is interested.
+ */
+class UwStatsPublisher
+{
+
+public:
+	/**
+	 * Constructor
+	 */
+	UwStatsPublisher();
+
+	/**
+	 * Destructor
+	 */
+	virtual ~UwStatsPublisher() = default;
+
+	/**
+	 * Adds a subscriber, or changes its period if already subscribed.
+	 *
+	 * @param id Id of the module that receives the stats
+	 * @param period Period of the snapshots [s], 0 to receive every update
+	 * @param now Current time [s]
+	 */
+	void subscribe(int id, double period, double now);
+
+	/**
+	 * Removes a subscriber.
+	 *
+	 * @param id Id of the module that receives the stats
+	 * @return true if the module was subscribed
+	 */
+	bool unsubscribe(int id);
+
+	/**
+	 * @return true if some module receives every update of the stats
+	 */
+	bool
+	hasSubscribers() const
+	{
+		return !on_update.empty();
+	}
+
+	/**
+	 * @return the ids of the modules that receive every update of the stats
+	 */
+	const std::vector<int> &
+	getSubscribers() const
+	{
+		return on_update;
+	}
+
+	/**
+	 * @return the time of the next snapshot [s], -1 if there are no
+	 * periodic subscribers
+	 */
+	double nextSnapshot() const;
+
+	/**
+	 * Gets the periodic subscribers whose snapshot is due, and moves their
+	 * next snapshot one period ahead.
+	 *
+	 * @param now Current time [s]
+	 * @param due Ids of the subscribers whose snapshot is due (output)
+	 */
+	void getDueSnapshots(double now, std::vector<int> &due);
+
+protected:
+	/**
+	 * Subscriber to periodic snapshots.
+	 */
+	struct periodic_subscriber {
+		int id; /**< Id of the module that receives the stats. */
+		double period; /**< Period of the snapshots [s]. */
+		double next; /**< Time of the next snapshot [s]. */
+	};
+
+	std::vector<int> on_update; /**< Subscribers to every update. */
+	std::vector<periodic_subscriber> periodic; /**< Periodic subscribers. */
 };
 
 #endif /* UW_STATS_UTILTIES_H */
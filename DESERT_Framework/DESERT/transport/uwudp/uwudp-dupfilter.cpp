@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwudp-dupfilter.cpp
+ * @version 1.0.0
+ *
+ * \brief Provides the implementation of the class <i>UwDupFilter</i>.
+ */
+
+#include "uwudp-dupfilter.h"
+
+#include <algorithm>
+
+UwDupFilter::UwDupFilter(uint32_t window, uint32_t id_bits)
+	: window_(0)
+	, id_bits_((id_bits >= 2 && id_bits <= 32) ? id_bits : 32)
+	, flows_()
+{
+	setWindow(window);
+}
+
+void
+UwDupFilter::setWindow(uint32_t window)
+{
+	uint32_t max_window = (uint32_t) 1 << (id_bits_ - 1);
+	uint32_t w = 64;
+	while (w < window && w < max_window)
+		w <<= 1;
+	if (w > max_window)
+		w = max_window;
+
+	if (w != window_) {
+		window_ = w;
+		flows_.clear();
+	}
+}
+
+void
+UwDupFilter::clear()
+{
+	flows_.clear();
+}
+
+int32_t
+UwDupFilter::distance(uint32_t from, uint32_t to) const
+{
+	uint32_t shift = 32 - id_bits_;
+	return ((int32_t) ((to - from) << shift)) >> shift;
+}
+
+void
+UwDupFilter::clearRange(flow_window &w, uint32_t from, uint32_t n) const
+{
+	if (n >= window_) {
+		std::fill(w.bits.begin(), w.bits.end(), 0);
+		return;
+	}
+
+	uint32_t mask = window_ - 1;
+	uint32_t pos = (from + 1) & mask;
+	while (n > 0) {
+		uint32_t bit = pos & 63;
+		uint32_t len = 64 - bit;
+		if (len > n)
+			len = n;
+		if (len > window_ - pos)
+			len = window_ - pos;
+		uint64_t clr = (len == 64) ? ~(uint64_t) 0
+								   : (((uint64_t) 1 << len) - 1) << bit;
+		w.bits[pos >> 6] &= ~clr;
+		pos = (pos + len) & mask;
+		n -= len;
+	}
+}
+
+bool
+UwDupFilter::isDuplicate(uint32_t flow, uint32_t id)
+{
+	uint32_t mask = window_ - 1;
+	std::map<uint32_t, flow_window>::iterator it = flows_.find(flow);
+
+	if (it == flows_.end()) {
+		flow_window &w = flows_[flow];
+		w.head = id;
+		w.bits.assign(window_ / 64, 0);
+		w.bits[(id & mask) >> 6] |= (uint64_t) 1 << (id & 63);
+		return false;
+	}
+
+	flow_window &w = it->second;
+	int32_t d = distance(w.head, id);
+
+	if (d > 0) {
+		clearRange(w, w.head, (uint32_t) d);
+		w.head = id;
+	} else if ((uint32_t) -d >= window_) {
+		return true; // Older than the window.
+	}
+
+	uint64_t &word = w.bits[(id & mask) >> 6];
+	uint64_t bit = (uint64_t) 1 << (id & 63);
+	if (word & bit)
+		return true;
+	word |= bit;
+	return false;
+}
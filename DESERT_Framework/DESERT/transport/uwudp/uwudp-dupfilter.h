@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwudp-dupfilter.h
+ * @version 1.0.0
+ *
+ * \brief Provides the definition of the class <i>UwDupFilter</i>.
+ *
+ * <i>UwDupFilter</i> detects duplicated packets with a sliding window of
+ * packet IDs for each flow.
+ */
+
+#ifndef _UWUDP_DUPFILTER_H_
+#define _UWUDP_DUPFILTER_H_
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+#define UWDUPFILTER_DEFAULT_WINDOW \
+	65536 /**< Default number of packet IDs tracked by each flow. */
+
+/**
+ * UwDupFilter keeps, for each flow (e.g., a (port, source) pair), a bitset
+ * of the last <i>window</i> packet IDs received. IDs are compared with serial
+ * number arithmetic on <i>id_bits</i> bits, so that wrapping counters are
+ * supported. A packet whose ID is older than the window of its flow is
+ * considered a duplicate.
+ *
+ * The memory used by each flow is window / 8 bytes and every lookup is O(1).
+ */
+class UwDupFilter
+{
+public:
+	/**
+	 * Constructor of the UwDupFilter class.
+	 *
+	 * @param window Number of packet IDs tracked by each flow.
+	 * @param id_bits Number of bits of the packet IDs.
+	 */
+	UwDupFilter(uint32_t window = UWDUPFILTER_DEFAULT_WINDOW,
+			uint32_t id_bits = 32);
+
+	/**
+	 * Sets the number of packet IDs tracked by each flow. It is rounded up
+	 * to a power of two, between 64 and 2^(id_bits - 1). The flows are
+	 * cleared if the window changes.
+	 *
+	 * @param window Number of packet IDs tracked by each flow.
+	 */
+	void setWindow(uint32_t window);
+
+	/**
+	 * Returns the number of packet IDs tracked by each flow.
+	 */
+	inline uint32_t
+	getWindow() const
+	{
+		return window_;
+	}
+
+	/**
+	 * Checks whether a packet has already been received and, if not, marks
+	 * it as received.
+	 *
+	 * @param flow ID of the flow of the packet.
+	 * @param id ID of the packet within its flow.
+	 * @return <i>true</i> if the packet is a duplicate, <i>false</i>
+	 * otherwise.
+	 */
+	bool isDuplicate(uint32_t flow, uint32_t id);
+
+	/**
+	 * Removes all the flows.
+	 */
+	void clear();
+
+	/**
+	 * Builds the ID of a flow from a port and a source address.
+	 */
+	static inline uint32_t
+	flowId(uint16_t port, uint8_t source)
+	{
+		return ((uint32_t) port << 8) | source;
+	}
+
+private:
+	/**
+	 * Window of a flow.
+	 */
+	typedef struct flow_window {
+		uint32_t head; /**< Highest ID received. */
+		std::vector<uint64_t> bits; /**< Bit (id % window) is set if id,
+									   within the window, was received. */
+	} flow_window;
+
+	/**
+	 * Returns the signed distance from <i>from</i> to <i>to</i>, with serial
+	 * number arithmetic on id_bits_ bits.
+	 */
+	int32_t distance(uint32_t from, uint32_t to) const;
+
+	/**
+	 * Clears the bits of the IDs in (from, from + n] of a window.
+	 */
+	void clearRange(flow_window &w, uint32_t from, uint32_t n) const;
+
+	uint32_t window_; /**< Number of IDs tracked by each flow. */
+	uint32_t id_bits_; /**< Number of bits of the IDs. */
+	std::map<uint32_t, flow_window> flows_; /**< Windows of the flows. */
+};
+
+#endif // _UWUDP_DUPFILTER_H_
@@ -38,6 +38,7 @@
  */
 
 #include "uwudp-module.h"
+#include "uwlog.h"
 
 #include <iostream>
 #include <set>
@@ -77,9 +78,12 @@ public:
 UwUdp::UwUdp()
 	: portcounter(0)
 	, drop_duplicated_packets_(0)
+	, dup_window_(UWDUPFILTER_DEFAULT_WINDOW)
 	, debug_(0)
+	, dup_filter()
 {
 	bind("drop_duplicated_packets_", &drop_duplicated_packets_);
+	bind("dup_window_", &dup_window_);
 	bind("debug_", &debug_);
 }
 
@@ -112,7 +116,7 @@ UwUdp::command(int argc, const char *const *argv)
 void
 UwUdp::recv(Packet *p)
 {
-	printOnLog(Logger::LogLevel::ERROR,
+	UWLOG(Logger::LogLevel::ERROR,
 			"UWUDP",
 			"recv(Packet *)::packet sent without source module");
 	Packet::free(p);
@@ -131,7 +135,7 @@ UwUdp::recv(Packet *p, int idSrc)
 			map<int, int>::const_iterator iter = id_map.find(uwudp->dport());
 
 			if (iter == id_map.end()) {
-				printOnLog(Logger::LogLevel::ERROR,
+				UWLOG(Logger::LogLevel::ERROR,
 						"UWUDP",
 						"recv(Packet *, int)::unknown port number, dport = " +
 								to_string(uwudp->dport()));
@@ -142,7 +146,7 @@ UwUdp::recv(Packet *p, int idSrc)
 
 			int module_id = iter->second;
 
-			printOnLog(Logger::LogLevel::DEBUG,
+			UWLOG(Logger::LogLevel::DEBUG,
 					"UWUDP",
 					"recv(Packet *, int)::new packet with id " +
 							to_string(ch->uid()) + " from ip " +
@@ -150,60 +154,18 @@ UwUdp::recv(Packet *p, int idSrc)
 							" : " + to_string(iter->first));
 
 			if (drop_duplicated_packets_ == 1) {
-				map<uint16_t, map_packets_el>::iterator it =
-						map_packets.find(iter->first);
+				if ((uint32_t) dup_window_ != dup_filter.getWindow())
+					dup_filter.setWindow(dup_window_);
 
-				if (it == map_packets.end()) {
-					printOnLog(Logger::LogLevel::DEBUG,
+				if (dup_filter.isDuplicate(
+							UwDupFilter::flowId(iter->first, iph->saddr()),
+							ch->uid())) {
+					UWLOG(Logger::LogLevel::DEBUG,
 							"UWUDP",
-							"recv(Packet *, int)::packet to a new port");
-
-					std::set<int> tmp_set_;
-					tmp_set_.insert(ch->uid());
-					map_packets_el tmp_map_el_;
-					tmp_map_el_.insert(pair<uint8_t, std::set<int>>(
-							iph->saddr(), tmp_set_));
-					map_packets.insert(pair<uint16_t, map_packets_el>(
-							iter->first, tmp_map_el_));
-				} else {
-					printOnLog(Logger::LogLevel::DEBUG,
-							"UWUDP",
-							"recv(Packet *, int)::packet to a known port");
-
-					std::map<uint8_t, std::set<int>>::iterator it2 =
-							it->second.find(iph->saddr());
-					if (it2 == it->second.end()) {
-						printOnLog(Logger::LogLevel::DEBUG,
-								"UWUDP",
-								"recv(Packet *, int)::packet from a new "
-								"source");
-
-						std::set<int> tmp_set_;
-						tmp_set_.insert(ch->uid());
-						it->second.insert(pair<uint8_t, std::set<int>>(
-								iph->saddr(), tmp_set_));
-					} else {
-						printOnLog(Logger::LogLevel::DEBUG,
-								"UWUDP",
-								"recv(Packet *, int)::packet from a known "
-								"source");
-
-						if (it2->second.count(ch->uid()) < 1) {
-							printOnLog(Logger::LogLevel::DEBUG,
-									"UWUDP",
-									"recv(Packet *, int)::new packet received");
-
-							it2->second.insert(ch->uid());
-						} else { // Packet already received.
-							printOnLog(Logger::LogLevel::DEBUG,
-									"UWUDP",
-									"recv(Packet *, int)::duplicate packet "
-									"dropped");
-
-							drop(p, 1, DROP_RECEIVED_DUPLICATED_PACKET);
-							return;
-						}
-					}
+							"recv(Packet *, int)::duplicate packet dropped");
+
+					drop(p, 1, DROP_RECEIVED_DUPLICATED_PACKET);
+					return;
 				}
 			}
 
@@ -213,7 +175,7 @@ UwUdp::recv(Packet *p, int idSrc)
 			map<int, int>::const_iterator iter = port_map.find(idSrc);
 
 			if (iter == port_map.end()) {
-				printOnLog(Logger::LogLevel::ERROR,
+				UWLOG(Logger::LogLevel::ERROR,
 						"UWUDP",
 						"recv(Packet *, int)::no port assigned to id " +
 								to_string(idSrc) + ", dropping packet");
@@ -248,11 +210,13 @@ UwUdp::assignPort(Module *m)
 	id_map[newport] = id;
 	assert(id_map.find(newport) != id_map.end());
 
-	std::stringstream msg;
-	msg << "assignPort(Module *)::"
-		<< "id = " << id << " port = " << newport
-		<< " portcounter = " << portcounter;
-	printOnLog(Logger::LogLevel::INFO, "UWUDP", msg.str());
+	if (UWLOG_ENABLED(Logger::LogLevel::INFO)) {
+		std::stringstream msg;
+		msg << "assignPort(Module *)::"
+			<< "id = " << id << " port = " << newport
+			<< " portcounter = " << portcounter;
+		printOnLog(Logger::LogLevel::INFO, "UWUDP", msg.str());
+	}
 
 	return newport;
 }
@@ -42,12 +42,13 @@
 #ifndef _UWUDP_H_
 #define _UWUDP_H_
 
+#include "uwudp-dupfilter.h"
+
 #include <sstream>
 #include <uwip-module.h>
 
 #include <map>
 #include <module.h>
-#include <set>
 
 #define DROP_UNKNOWN_PORT_NUMBER \
 	"UPN" /**< Reason for a drop in a <i>UWUDP</i> module. */
@@ -58,8 +59,6 @@
 
 extern packet_t PT_UWUDP;
 
-typedef std::map<uint8_t, std::set<int>> map_packets_el;
-
 /**
  * <i>hdr_uwudp</i> describes <i>UWUDP</i> packets.
  */
@@ -169,16 +168,15 @@ protected:
 	uint16_t portcounter; /**< Counter used to generate new port numbers. */
 	int drop_duplicated_packets_; /**< Flag to enable or disable the drop of
 									 duplicated packets. */
+	int dup_window_; /**< Number of packet IDs tracked for each port and
+						source to detect duplicated packets. */
 	int debug_; /**< Flag to enable or disable debug. */
 	std::map<int, int> port_map; /**< Map application module id to port number
 									(id, port_number). */
 	std::map<int, int> id_map; /**< Map port number to application module id
 								  (port_number, id). */
-	std::map<uint16_t, map_packets_el>
-			map_packets; /**< Map used to keep track of the packets received by
-							each port. The key is the port number. The second
-							element contains the saddr IP and a vector used as
-							bucketlist.*/
+	UwDupFilter dup_filter; /**< Sliding window of the packets received for
+							   each (port, source address) pair. */
 
 	/**
 	 * Returns the size in byte of a <i>hdr_uwudp</i> packet header.
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwlog.h
+ * @version 1.0.0
+ *
+ * \brief Logging front end that checks the log level before building the
+ * message.
+ *
+ * PlugIn::printOnLog takes an already built std::string, so the message of a
+ * DEBUG log is concatenated even when the logger discards it. UWLOG and
+ * UWLOG_MODULE take the same arguments of printOnLog, but the message
+ * expression is evaluated only if the level is enabled, both at compile time
+ * and at run time.
+ *
+ * The most verbose level compiled in is UWLOG_LEVEL (1 = ERR, 2 = INFO,
+ * 3 = DBG, default 3). Building with -DUWLOG_LEVEL=2 removes all the DEBUG
+ * logs from the binary.
+ */
+
+#ifndef UWLOG_H
+#define UWLOG_H
+
+#include <logger.h>
+
+#ifndef UWLOG_LEVEL
+#define UWLOG_LEVEL 3
+#endif
+
+namespace uwlog
+{
+
+/**
+ * Gives read access to the log level of a Logger, that has no getter.
+ */
+class LoggerLevel : public Logger
+{
+public:
+	/**
+	 * @param logger Logger to inspect
+	 * @return the log level of the logger
+	 */
+	static Logger::LogLevel
+	get(const Logger &logger)
+	{
+		return logger.*(&LoggerLevel::log_level_);
+	}
+};
+
+/**
+ * @param level Level of the message
+ * @return true if messages of this level are compiled in
+ */
+constexpr bool
+isCompiled(Logger::LogLevel level)
+{
+	return static_cast<int>(level) <= UWLOG_LEVEL;
+}
+
+/**
+ * @param logger Logger of the module
+ * @param level Level of the message
+ * @return true if the logger prints messages of this level
+ */
+inline bool
+isEnabled(const Logger &logger, Logger::LogLevel level)
+{
+	Logger::LogLevel log_level = LoggerLevel::get(logger);
+
+	return log_level != Logger::LogLevel::NONE && log_level >= level;
+}
+
+} // namespace uwlog
+
+/**
+ * Checks if a message of the given level of a PlugIn would be printed. Useful
+ * to skip the code that builds a message in more than one statement.
+ *
+ * @param obj Pointer to the PlugIn
+ * @param level Logger::LogLevel of the message
+ */
+#define UWLOG_MODULE_ENABLED(obj, level)                                       \
+	(uwlog::isCompiled(level) && (obj)->enable_log &&                          \
+			uwlog::isEnabled((obj)->logger, level))
+
+/**
+ * Checks if a message of the given level of the current PlugIn would be
+ * printed.
+ *
+ * @param level Logger::LogLevel of the message
+ */
+#define UWLOG_ENABLED(level) UWLOG_MODULE_ENABLED(this, level)
+
+/**
+ * Logs a message of the given PlugIn, evaluating the message only if the
+ * level is enabled for that PlugIn.
+ *
+ * @param obj Pointer to the PlugIn
+ * @param level Logger::LogLevel of the message
+ * @param module Name of the module
+ * @param message Expression that builds the message
+ */
+#define UWLOG_MODULE(obj, level, module, message)                              \
+	do {                                                                       \
+		if (UWLOG_MODULE_ENABLED(obj, level))                                  \
+			(obj)->printOnLog(level, module, message);                         \
+	} while (0)
+
+/**
+ * Logs a message of the current PlugIn, evaluating the message only if the
+ * level is enabled.
+ *
+ * @param level Logger::LogLevel of the message
+ * @param module Name of the module
+ * @param message Expression that builds the message
+ */
+#define UWLOG(level, module, message) UWLOG_MODULE(this, level, module, message)
+
+#endif /* UWLOG_H */
@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwlut.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwLut class.
+ *
+ */
+
+#include "uwlut.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/**
+ * Relative tolerance used to decide whether the keys are evenly spaced
+ */
+static const double UNIFORM_TOLERANCE = 1e-9;
+
+std::map<std::string, UwLut *> UwLut::luts_;
+
+UwLut::UwLut()
+	: keys_()
+	, values_()
+	, columns_(1)
+	, uniform_(false)
+	, step_(0)
+{
+}
+
+bool
+UwLut::load(const std::string &file_name, char separator, int columns,
+		int skip_lines)
+{
+	std::ifstream input_file_(file_name.c_str());
+	if (!input_file_.is_open())
+		return false;
+
+	std::string line_;
+	for (int i = 0; i < skip_lines && std::getline(input_file_, line_); i++)
+		;
+
+	std::map<double, std::vector<double> > rows_;
+	while (std::getline(input_file_, line_)) {
+		std::istringstream line_stream(line_);
+		double key_;
+		if (!(line_stream >> key_))
+			continue;
+		std::vector<double> &row_ = rows_[key_];
+		row_.assign(columns, 0);
+		for (int c = 0; c < columns; c++) {
+			line_stream >> std::ws;
+			if (line_stream.peek() == separator)
+				line_stream.ignore();
+			if (!(line_stream >> row_[c]))
+				break;
+		}
+	}
+
+	columns_ = columns;
+	keys_.clear();
+	values_.clear();
+	keys_.reserve(rows_.size());
+	values_.reserve(rows_.size() * columns);
+	for (std::map<double, std::vector<double> >::const_iterator it =
+					rows_.begin();
+			it != rows_.end();
+			++it) {
+		keys_.push_back(it->first);
+		values_.insert(values_.end(), it->second.begin(), it->second.end());
+	}
+
+	int n = keys_.size();
+	uniform_ = n > 2;
+	step_ = n > 1 ? (keys_[n - 1] - keys_[0]) / (n - 1) : 0;
+	for (int i = 1; uniform_ && i < n; i++)
+		uniform_ = std::fabs(keys_[i] - keys_[0] - i * step_) <=
+				UNIFORM_TOLERANCE * step_;
+	return true;
+}
+
+int
+UwLut::lowerBound(double x) const
+{
+	int n = keys_.size();
+	if (!uniform_)
+		return std::lower_bound(keys_.begin(), keys_.end(), x) -
+				keys_.begin();
+
+	// Guess from the grid, then fix the rounding errors
+	double guess = std::ceil((x - keys_[0]) / step_);
+	int i = guess < 0 ? 0 : guess > n ? n : (int) guess;
+	while (i > 0 && keys_[i - 1] >= x)
+		i--;
+	while (i < n && keys_[i] < x)
+		i++;
+	return i;
+}
+
+double
+UwLut::interpolate(double x, int column) const
+{
+	if (keys_.empty())
+		return 0;
+	if (x <= keys_.front())
+		return getValue(0, column);
+	if (x >= keys_.back())
+		return getValue(keys_.size() - 1, column);
+
+	int i = lowerBound(x);
+	if (keys_[i] == x)
+		return getValue(i, column);
+	return linear(x,
+			keys_[i - 1],
+			getValue(i - 1, column),
+			keys_[i],
+			getValue(i, column));
+}
+
+const UwLut &
+UwLut::getLut(const std::string &file_name, char separator, int columns,
+		int skip_lines)
+{
+	// The same file may be read with different options by different modules
+	std::ostringstream key_;
+	key_ << file_name << '\n'
+		 << (int) separator << '\n'
+		 << columns << '\n'
+		 << skip_lines;
+	std::map<std::string, UwLut *>::iterator it = luts_.find(key_.str());
+	if (it != luts_.end())
+		return *(it->second);
+
+	UwLut *lut_ = new UwLut();
+	if (!lut_->load(file_name, separator, columns, skip_lines)) {
+		std::cerr << "Impossible to open file " << file_name << std::endl;
+		delete lut_;
+		return emptyLut();
+	}
+	luts_[key_.str()] = lut_;
+	return *lut_;
+}
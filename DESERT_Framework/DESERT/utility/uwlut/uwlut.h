@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwlut.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwLut class, a lookup table read from a text file and
+ * shared by all the modules that use the same file.
+ *
+ */
+
+#ifndef UWLUT_H
+#define UWLUT_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Lookup table with a sorted key and one or more value columns, e.g. a PER
+ * versus distance curve or a range versus attenuation coefficient table with
+ * two ranges per row. Each line of the file holds the key followed by the
+ * values, split by a separator. Keys and values are stored in contiguous
+ * arrays; when the keys are evenly spaced the search is done in constant
+ * time, otherwise with a binary search.
+ */
+class UwLut
+{
+public:
+	/**
+	 * Constructor of UwLut class, the table is empty.
+	 */
+	UwLut();
+
+	/**
+	 * Parses a table file. Lines whose key cannot be read are skipped and,
+	 * when a key is repeated, the last line is kept.
+	 *
+	 * @param file_name Name of the file
+	 * @param separator Token separator of the lines
+	 * @param columns Number of values that follow the key
+	 * @param skip_lines Number of header lines to skip
+	 * @return <i>true</i> if the file has been read, <i>false</i> otherwise
+	 */
+	bool load(const std::string &file_name, char separator, int columns,
+			int skip_lines);
+
+	/**
+	 * @return number of rows of the table
+	 */
+	inline int
+	size() const
+	{
+		return keys_.size();
+	}
+
+	/**
+	 * @return <i>true</i> if the table has no rows
+	 */
+	inline bool
+	empty() const
+	{
+		return keys_.empty();
+	}
+
+	/**
+	 * @param i Index of the row
+	 * @return key of the row
+	 */
+	inline double
+	getKey(int i) const
+	{
+		return keys_[i];
+	}
+
+	/**
+	 * @param i Index of the row
+	 * @param column Index of the value column
+	 * @return value of the row in the given column
+	 */
+	inline double
+	getValue(int i, int column = 0) const
+	{
+		return values_[i * columns_ + column];
+	}
+
+	/**
+	 * Index of the first row whose key is not lower than x, as
+	 * std::lower_bound.
+	 *
+	 * @param x Value to search for
+	 * @return index of the row, size() if all the keys are lower than x
+	 */
+	int lowerBound(double x) const;
+
+	/**
+	 * Value in x, linearly interpolated between the two nearest rows and
+	 * equal to the first or last row outside the table.
+	 *
+	 * @param x Value of the key
+	 * @param column Index of the value column
+	 * @return the value, 0 if the table is empty
+	 */
+	double interpolate(double x, int column = 0) const;
+
+	/**
+	 * Line through (x1, y1) and (x2, y2) evaluated in x.
+	 *
+	 * @return the value of the line in x
+	 */
+	static inline double
+	linear(double x, double x1, double y1, double x2, double y2)
+	{
+		double m = (y1 - y2) / (x1 - x2);
+		double q = y1 - m * x1;
+		return m * x + q;
+	}
+
+	/**
+	 * Returns the table of a file, loading it the first time it is requested
+	 * with the same parameters.
+	 *
+	 * @param file_name Name of the file
+	 * @param separator Token separator of the lines
+	 * @param columns Number of values that follow the key
+	 * @param skip_lines Number of header lines to skip
+	 * @return the table, empty if the file cannot be read
+	 */
+	static const UwLut &getLut(const std::string &file_name, char separator,
+			int columns = 1, int skip_lines = 0);
+
+	/**
+	 * @return a table without rows, to be used before a file is loaded
+	 */
+	static inline const UwLut &
+	emptyLut()
+	{
+		static const UwLut empty_lut;
+		return empty_lut;
+	}
+
+	/**
+	 * @return number of tables loaded so far
+	 */
+	static inline int
+	getLoadedLuts()
+	{
+		return luts_.size();
+	}
+
+private:
+	std::vector<double> keys_; /**< Sorted keys. */
+	std::vector<double> values_; /**< Values, row by row. */
+	int columns_; /**< Number of values of each row. */
+	bool uniform_; /**< <i>true</i> if the keys are evenly spaced. */
+	double step_; /**< Distance between two keys, if uniform_. */
+
+	static std::map<std::string, UwLut *> luts_; /**< Loaded tables. */
+};
+
+#endif /* UWLUT_H */
@@ -0,0 +1,337 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwstatetracer-check.cpp
+ * @version 1.0.0
+ *
+ * \brief Check program of UwStateTracer: the transitions of the MAC
+ * protocols are traced, decoded with UwStateTraceDecoder and compared with
+ * the text lines the protocols printed before the tracer.
+ *
+ */
+
+#include "uwstatetracer-decoder.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+using namespace std;
+
+namespace
+{
+
+const char *CHECK_FILE = "uwstatetracer-check.bin"; /**< Trace file. */
+const size_t CHECK_BUFFER = 3; /**< Records in memory, less than a name. */
+const int TRANSITIONS = 5000; /**< Transitions traced. */
+
+enum {
+	BACKOFF = 1, /**< Backoff state of CsmaAloha, UWAloha and MMacUWSR. */
+	DACAP_BACKOFF = 6, /**< STATE_BACKOFF of MMacDACAP. */
+	DACAP_DEFER_DATA = 3, /**< STATE_DEFER_DATA of MMacDACAP. */
+	DACAP_RECONTEND_WINDOW = 19 /**< STATE_RECONTEND_WINDOW of MMacDACAP. */
+};
+
+/** Names of the states of CsmaAloha, UWAloha and MMacUWSR. */
+map<int, string> status_info = {{0, "Idle state"},
+		{BACKOFF, "Backoff state"},
+		{2, "Transmit DATA state"},
+		{3, "Wait for ACK state"},
+		{4, "Check Wait ACK timeout state"},
+		{5, "Start rx Backoff state"},
+		{6,
+				"State with a name long enough to take more than two "
+				"records of the trace"}};
+
+/** Names of the reasons of CsmaAloha, UWAloha and MMacUWSR. */
+map<int, string> reason_info = {{0, "DATA pending from upper layers"},
+		{1, "DATA transmitted"},
+		{2, "ACK timeout"},
+		{3, "DATA dropped due to max tx rounds"},
+		{4, "DATA pending, listening to channel"},
+		{5, "Wait for ACK timer pending"}};
+
+/** Names of the states and of the reasons of MMacDACAP. */
+map<int, string> info = {{1, "Idle State"},
+		{2, "Wait CTS State"},
+		{DACAP_DEFER_DATA, "Defer Data State"},
+		{DACAP_BACKOFF, "Backoff State"},
+		{7, "CTS Received State"},
+		{DACAP_RECONTEND_WINDOW, "Wait Recontend Window State"},
+		{21, "xCTS, or xRTS received"},
+		{22, "Backoff ended"},
+		{23, "Data from upper layers pending in queue"},
+		{24, "Wait WRN Window ended with no WRN"},
+		{25, "xACK wait window ended"}};
+
+/** States of MMacDACAP. */
+const int dacap_states[] = {1, 2, DACAP_DEFER_DATA, DACAP_BACKOFF, 7,
+		DACAP_RECONTEND_WINDOW};
+
+/** Reasons of MMacDACAP. */
+const int dacap_reasons[] = {21, 22, 23, 24, 25};
+
+/**
+ * CsmaAloha::printStateInfo before the tracer.
+ */
+void
+printCsmaAloha(ostream &fout, double NOW, int addr, int prev_state,
+		int curr_state, int last_reason, double delay)
+{
+	if (curr_state == BACKOFF) {
+		fout << left << setw(10) << NOW << "  CsmaAloha(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << status_info[prev_state] << " to "
+			 << status_info[curr_state]
+			 << ". Reason: " << reason_info[last_reason]
+			 << ". Backoff duration = " << delay << endl;
+	} else {
+		fout << left << setw(10) << NOW << "  CsmaAloha(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << status_info[prev_state] << " to "
+			 << status_info[curr_state]
+			 << ". Reason: " << reason_info[last_reason] << endl;
+	}
+}
+
+/**
+ * UWAloha::printStateInfo before the tracer.
+ */
+void
+printUWAloha(ostream &fout, double NOW, int addr, int prev_state,
+		int curr_state, int last_reason, double delay)
+{
+	if (curr_state == BACKOFF) {
+		fout << left << setw(10) << NOW << "  UWAloha (" << addr
+			 << ")::printStateInfo() "
+			 << "from " << status_info[prev_state] << " to "
+			 << status_info[curr_state]
+			 << ". Reason: " << reason_info[last_reason]
+			 << ". Backoff duration = " << delay << endl;
+	} else {
+		fout << left << setw(10) << NOW << "  UWAloha (" << addr
+			 << ")::printStateInfo() "
+			 << "from " << status_info[prev_state] << " to "
+			 << status_info[curr_state]
+			 << ". Reason: " << reason_info[last_reason] << endl;
+	}
+}
+
+/**
+ * MMacUWSR::printStateInfo before the tracer.
+ */
+void
+printUWSR(ostream &fout, double NOW, int addr, int prev_state,
+		int curr_state, int last_reason, double delay)
+{
+	if (curr_state == BACKOFF) {
+		fout << left << setw(10) << NOW << "  MMacUWSR(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << status_info[prev_state] << " to "
+			 << status_info[curr_state]
+			 << ". Reason: " << reason_info[last_reason]
+			 << ". Backoff duration = " << delay << endl;
+	} else {
+		fout << left << setw(10) << NOW << "  MMacUWSR(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << status_info[prev_state] << " to "
+			 << status_info[curr_state]
+			 << ". Reason: " << reason_info[last_reason] << endl;
+	}
+}
+
+/**
+ * MMacDACAP::printStateInfo before the tracer.
+ */
+void
+printDACAP(ostream &fout, double NOW, int addr, int prev_state,
+		int curr_state, int last_reason, double delay, int backoff_counter)
+{
+	if (curr_state == DACAP_BACKOFF) {
+		fout << left << setw(10) << NOW << " MMacDACAP(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << info[prev_state] << " to " << info[curr_state]
+			 << " reason: " << info[last_reason]
+			 << ". Backoff duration = " << delay
+			 << "; backoff cnt = " << backoff_counter << endl;
+	} else if (curr_state == DACAP_DEFER_DATA) {
+		fout << left << setw(10) << NOW << " MMacDACAP(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << info[prev_state] << " to " << info[curr_state]
+			 << " reason: " << info[last_reason]
+			 << ". Defering delay = " << delay << endl;
+	} else if (curr_state == DACAP_RECONTEND_WINDOW) {
+		fout << left << setw(10) << NOW << " MMacDACAP(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << info[prev_state] << " to " << info[curr_state]
+			 << " reason: " << info[last_reason]
+			 << ". Waiting delay = " << delay << endl;
+	} else {
+		fout << left << setw(10) << NOW << " MMacDACAP(" << addr
+			 << ")::printStateInfo() "
+			 << "from " << info[prev_state] << " to " << info[curr_state]
+			 << " reason: " << info[last_reason] << endl;
+	}
+}
+
+/**
+ * UwStateTracer owned by the check, instead of the one of the process.
+ */
+class CheckTracer : public UwStateTracer
+{
+public:
+	CheckTracer()
+		: UwStateTracer()
+	{
+	}
+};
+
+/**
+ * Random key of a map.
+ */
+int
+randomKey(const map<int, string> &names)
+{
+	auto it = names.begin();
+	advance(it, rand() % names.size());
+	return it->first;
+}
+
+} // namespace
+
+int
+main()
+{
+	srand(1);
+	ostringstream expected;
+
+	{
+		CheckTracer tracer;
+		tracer.setFile(CHECK_FILE);
+		tracer.setBufferSize(CHECK_BUFFER);
+
+		// registered as in the initTracer() of the protocols
+		int csma = tracer.addProtocol("CsmaAloha");
+		tracer.setStateNames(csma, status_info);
+		tracer.setReasonNames(csma, reason_info);
+		tracer.setExtraName(csma, BACKOFF, "Backoff duration");
+
+		int aloha = tracer.addProtocol("UWAloha");
+		tracer.setStateNames(aloha, status_info);
+		tracer.setReasonNames(aloha, reason_info);
+		tracer.setExtraName(aloha, BACKOFF, "Backoff duration");
+		tracer.setPrintName(aloha, "  UWAloha ");
+
+		int uwsr = tracer.addProtocol("MMacUWSR");
+		tracer.setStateNames(uwsr, status_info);
+		tracer.setReasonNames(uwsr, reason_info);
+		tracer.setExtraName(uwsr, BACKOFF, "Backoff duration");
+
+		int dacap = tracer.addProtocol("MMacDACAP");
+		tracer.setStateNames(dacap, info);
+		tracer.setReasonNames(dacap, info);
+		tracer.setExtraName(dacap, DACAP_BACKOFF, "Backoff duration");
+		tracer.setAuxName(dacap, DACAP_BACKOFF, "backoff cnt");
+		tracer.setExtraName(dacap, DACAP_DEFER_DATA, "Defering delay");
+		tracer.setExtraName(
+				dacap, DACAP_RECONTEND_WINDOW, "Waiting delay");
+		tracer.setPrintName(dacap, " MMacDACAP");
+		tracer.setReasonLabel(dacap, " reason: ");
+
+		double now = 0;
+		for (int i = 0; i < TRANSITIONS; i++) {
+			now += rand() * 10.0 / RAND_MAX;
+			int addr = rand() % 20;
+			double delay = rand() * 100.0 / RAND_MAX;
+			int protocol = rand() % 4;
+
+			if (protocol == dacap) {
+				int from = dacap_states[rand() % 6];
+				int to = dacap_states[rand() % 6];
+				int reason = dacap_reasons[rand() % 5];
+				int counter = rand() % 10;
+				tracer.trace(now, dacap, addr, from, to, reason, delay,
+						counter);
+				printDACAP(expected, now, addr, from, to, reason, delay,
+						counter);
+				continue;
+			}
+
+			int from = randomKey(status_info);
+			int to = randomKey(status_info);
+			int reason = randomKey(reason_info);
+			tracer.trace(now, protocol, addr, from, to, reason, delay);
+			if (protocol == csma)
+				printCsmaAloha(expected, now, addr, from, to, reason, delay);
+			else if (protocol == aloha)
+				printUWAloha(expected, now, addr, from, to, reason, delay);
+			else
+				printUWSR(expected, now, addr, from, to, reason, delay);
+		}
+	}
+
+	ifstream in(CHECK_FILE, ios_base::in | ios_base::binary);
+	ostringstream decoded;
+	UwStateTraceDecoder decoder;
+	bool ok = decoder.decode(in, decoded);
+	in.close();
+	remove(CHECK_FILE);
+
+	if (!ok) {
+		cerr << "uwstatetracer-check: " << decoder.getError() << endl;
+		return 1;
+	}
+
+	istringstream exp_lines(expected.str());
+	istringstream dec_lines(decoded.str());
+	string exp_line;
+	string dec_line;
+	int line = 0;
+	while (getline(exp_lines, exp_line)) {
+		line++;
+		if (!getline(dec_lines, dec_line) || dec_line != exp_line) {
+			cerr << "uwstatetracer-check: line " << line << " differs" << endl
+				 << "  expected: " << exp_line << endl
+				 << "  decoded:  " << dec_line << endl;
+			return 1;
+		}
+	}
+	if (getline(dec_lines, dec_line)) {
+		cerr << "uwstatetracer-check: more lines than transitions" << endl;
+		return 1;
+	}
+
+	cout << line << " transitions match the text traces" << endl;
+	return 0;
+}
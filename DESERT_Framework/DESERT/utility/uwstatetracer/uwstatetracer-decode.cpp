@@ -0,0 +1,64 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwstatetracer-decode.cpp
+ * @version 1.0.0
+ *
+ * \brief Prints as text a trace file written by UwStateTracer.
+ *
+ * Usage: uwstatetracer-decode [trace file]
+ *
+ */
+
+#include "uwstatetracer-decoder.h"
+
+#include <fstream>
+#include <iostream>
+
+int
+main(int argc, char **argv)
+{
+	const char *file = argc > 1 ? argv[1] : UWSTATETRACER_DEFAULT_FILE;
+	std::ifstream in(file, std::ios_base::in | std::ios_base::binary);
+
+	if (!in) {
+		std::cerr << "uwstatetracer-decode: cannot open " << file << std::endl;
+		return 1;
+	}
+
+	UwStateTraceDecoder decoder;
+	if (!decoder.decode(in, std::cout)) {
+		std::cerr << "uwstatetracer-decode: " << file << ": "
+				  << decoder.getError() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwstatetracer-decoder.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwStateTraceDecoder class.
+ *
+ */
+
+#include "uwstatetracer-decoder.h"
+
+#include <cstring>
+#include <iomanip>
+
+namespace
+{
+
+std::string
+lookup(const std::map<int, std::string> &names, int id)
+{
+	auto it = names.find(id);
+
+	if (it == names.end())
+		return std::to_string(id);
+
+	return it->second;
+}
+
+} // namespace
+
+UwStateTraceDecoder::UwStateTraceDecoder()
+	: protocols()
+	, error()
+{
+}
+
+bool
+UwStateTraceDecoder::decode(std::istream &in, std::ostream &out)
+{
+	protocols.clear();
+	error.clear();
+
+	char magic[UWSTATETRACER_MAGIC_LEN];
+	if (!in.read(magic, UWSTATETRACER_MAGIC_LEN) ||
+			std::memcmp(magic, UWSTATETRACER_MAGIC, UWSTATETRACER_MAGIC_LEN)) {
+		error = "not a state transitions trace";
+		return false;
+	}
+
+	uwstatetracer_record r;
+
+	while (in.read(reinterpret_cast<char *>(&r), sizeof(r))) {
+		protocol_names &p = protocols[r.protocol];
+
+		if (r.type == uwstatetracer_record::TRANSITION) {
+			printTransition(p, r, out);
+			continue;
+		}
+
+		std::string name;
+		uwstatetracer_record chunk;
+		for (int pos = 0; pos < r.aux; pos += sizeof(chunk)) {
+			if (!in.read(reinterpret_cast<char *>(&chunk), sizeof(chunk))) {
+				error = "truncated trace";
+				return false;
+			}
+			name.append(reinterpret_cast<const char *>(&chunk),
+					r.aux - pos < (int) sizeof(chunk) ? r.aux - pos
+													  : sizeof(chunk));
+		}
+
+		switch (r.type) {
+			case uwstatetracer_record::PROTOCOL_NAME:
+				p.name = name;
+				break;
+			case uwstatetracer_record::STATE_NAME:
+				p.states[r.from] = name;
+				break;
+			case uwstatetracer_record::REASON_NAME:
+				p.reasons[r.from] = name;
+				break;
+			case uwstatetracer_record::EXTRA_NAME:
+				p.extra[r.from] = name;
+				break;
+			case uwstatetracer_record::AUX_NAME:
+				p.aux[r.from] = name;
+				break;
+			case uwstatetracer_record::PRINT_NAME:
+				p.print_name = name;
+				break;
+			case uwstatetracer_record::REASON_LABEL:
+				p.reason_label = name;
+				break;
+			default:
+				error = "unknown record type " + std::to_string(r.type);
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void
+UwStateTraceDecoder::printTransition(const protocol_names &p,
+		const uwstatetracer_record &r, std::ostream &out) const
+{
+	out << std::left << std::setw(10) << r.time;
+	if (p.print_name.empty())
+		out << "  " << p.name;
+	else
+		out << p.print_name;
+	out << "(" << r.node << ")::printStateInfo() "
+		<< "from " << lookup(p.states, r.from) << " to "
+		<< lookup(p.states, r.to)
+		<< (p.reason_label.empty() ? ". Reason: " : p.reason_label)
+		<< lookup(p.reasons, r.reason);
+
+	auto extra = p.extra.find(r.to);
+	if (extra != p.extra.end())
+		out << ". " << extra->second << " = " << r.extra;
+
+	auto aux = p.aux.find(r.to);
+	if (aux != p.aux.end())
+		out << "; " << aux->second << " = " << r.aux;
+
+	out << std::endl;
+}
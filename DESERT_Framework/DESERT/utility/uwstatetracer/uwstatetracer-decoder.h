@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwstatetracer-decoder.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwStateTraceDecoder class, that prints as text a trace
+ * file written by UwStateTracer.
+ *
+ */
+
+#ifndef UWSTATETRACER_DECODER_H
+#define UWSTATETRACER_DECODER_H
+
+#include "uwstatetracer.h"
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+/**
+ * Decoder of the trace files written by UwStateTracer. Each transition is
+ * printed as the line the MAC protocols wrote in their text traces.
+ */
+class UwStateTraceDecoder
+{
+public:
+	/**
+	 * Constructor of UwStateTraceDecoder class.
+	 */
+	UwStateTraceDecoder();
+
+	/**
+	 * Prints a trace as text.
+	 *
+	 * @param in Trace, opened in binary mode
+	 * @param out Stream where the lines are printed
+	 * @return bool true if the whole trace was decoded, false otherwise
+	 * @see getError
+	 */
+	bool decode(std::istream &in, std::ostream &out);
+
+	/**
+	 * Returns the reason why the last decode failed.
+	 *
+	 * @return const std::string& the error
+	 */
+	const std::string &
+	getError() const
+	{
+		return error;
+	}
+
+protected:
+	/**
+	 * Names of a protocol read from the trace file.
+	 */
+	struct protocol_names {
+		std::string name; /**< Name of the protocol. */
+		std::string print_name; /**< Text printed before the node. */
+		std::string reason_label; /**< Text printed before the reason. */
+		std::map<int, std::string> states; /**< Names of the states. */
+		std::map<int, std::string> reasons; /**< Names of the reasons. */
+		std::map<int, std::string> extra; /**< Meaning of extra per state. */
+		std::map<int, std::string> aux; /**< Meaning of aux per state. */
+	};
+
+	/**
+	 * Prints a transition.
+	 *
+	 * @param p Names of the protocol of the transition
+	 * @param r Transition
+	 * @param out Stream where the line is printed
+	 */
+	void printTransition(const protocol_names &p, const uwstatetracer_record &r,
+			std::ostream &out) const;
+
+	std::map<int, protocol_names> protocols; /**< Protocols of the trace. */
+	std::string error; /**< Reason why the last decode failed. */
+};
+
+#endif /* UWSTATETRACER_DECODER_H */
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwstatetracer.cpp
+ * @version 1.0.0
+ *
+ * \brief Implementation of UwStateTracer class.
+ *
+ */
+
+#include "uwstatetracer.h"
+
+#include <cstring>
+#include <iostream>
+
+UwStateTracer &
+UwStateTracer::instance()
+{
+	static UwStateTracer tracer;
+	return tracer;
+}
+
+UwStateTracer::UwStateTracer()
+	: buffer(UWSTATETRACER_DEFAULT_BUFFER)
+	, used(0)
+	, protocols()
+	, file_name(UWSTATETRACER_DEFAULT_FILE)
+	, out()
+	, failed(false)
+{
+}
+
+UwStateTracer::~UwStateTracer()
+{
+	flush();
+	if (out.is_open())
+		out.close();
+}
+
+void
+UwStateTracer::setFile(const std::string &file)
+{
+	if (file == file_name)
+		return;
+
+	if (out.is_open()) {
+		flush();
+		out.close();
+	}
+
+	file_name = file;
+	failed = false;
+}
+
+void
+UwStateTracer::setBufferSize(size_t records)
+{
+	flush();
+	buffer.resize(records > 0 ? records : 1);
+}
+
+int
+UwStateTracer::getProtocol(const std::string &name) const
+{
+	for (size_t i = 0; i < protocols.size(); i++) {
+		if (protocols[i] == name)
+			return i;
+	}
+
+	return -1;
+}
+
+int
+UwStateTracer::addProtocol(const std::string &name)
+{
+	int id = getProtocol(name);
+
+	if (id >= 0)
+		return id;
+
+	id = protocols.size();
+	protocols.push_back(name);
+	addName(uwstatetracer_record::PROTOCOL_NAME, id, 0, name);
+
+	return id;
+}
+
+void
+UwStateTracer::setStateName(int protocol, int state, const std::string &name)
+{
+	addName(uwstatetracer_record::STATE_NAME, protocol, state, name);
+}
+
+void
+UwStateTracer::setReasonName(int protocol, int reason, const std::string &name)
+{
+	addName(uwstatetracer_record::REASON_NAME, protocol, reason, name);
+}
+
+void
+UwStateTracer::setExtraName(int protocol, int state, const std::string &name)
+{
+	addName(uwstatetracer_record::EXTRA_NAME, protocol, state, name);
+}
+
+void
+UwStateTracer::setAuxName(int protocol, int state, const std::string &name)
+{
+	addName(uwstatetracer_record::AUX_NAME, protocol, state, name);
+}
+
+void
+UwStateTracer::setPrintName(int protocol, const std::string &name)
+{
+	addName(uwstatetracer_record::PRINT_NAME, protocol, 0, name);
+}
+
+void
+UwStateTracer::setReasonLabel(int protocol, const std::string &label)
+{
+	addName(uwstatetracer_record::REASON_LABEL, protocol, 0, label);
+}
+
+void
+UwStateTracer::addName(
+		uint8_t type, int protocol, int id, const std::string &name)
+{
+	uwstatetracer_record &r = next();
+	std::memset(&r, 0, sizeof(r));
+	r.aux = name.size();
+	r.from = id;
+	r.protocol = protocol;
+	r.type = type;
+
+	for (size_t pos = 0; pos < name.size(); pos += sizeof(r)) {
+		uwstatetracer_record &chunk = next();
+		size_t len = name.size() - pos;
+		std::memset(&chunk, 0, sizeof(chunk));
+		std::memcpy(&chunk, name.data() + pos,
+				len < sizeof(chunk) ? len : sizeof(chunk));
+	}
+}
+
+void
+UwStateTracer::flush()
+{
+	if (used == 0)
+		return;
+
+	if (!out.is_open() && !failed) {
+		out.open(file_name.c_str(),
+				std::ios_base::out | std::ios_base::trunc |
+						std::ios_base::binary);
+		if (out.fail()) {
+			std::cerr << "UwStateTracer::flush()::cannot open trace file "
+					  << file_name << std::endl;
+			failed = true;
+		} else {
+			out.write(UWSTATETRACER_MAGIC, UWSTATETRACER_MAGIC_LEN);
+		}
+	}
+
+	if (out.is_open()) {
+		out.write(reinterpret_cast<const char *>(buffer.data()),
+				used * sizeof(uwstatetracer_record));
+		out.flush();
+	}
+
+	used = 0;
+}
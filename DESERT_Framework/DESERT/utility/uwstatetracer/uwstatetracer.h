@@ -0,0 +1,300 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwstatetracer.h
+ * @version 1.0.0
+ *
+ * \brief Definition of UwStateTracer class, a binary tracer of the state
+ * transitions of the MAC protocols shared by all the modules of the process.
+ *
+ */
+
+#ifndef UWSTATETRACER_H
+#define UWSTATETRACER_H
+
+#include <stdint.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#define UWSTATETRACER_MAGIC "UWSTRC01" /**< First bytes of a trace file. */
+#define UWSTATETRACER_MAGIC_LEN 8 /**< Length of UWSTATETRACER_MAGIC. */
+#define UWSTATETRACER_DEFAULT_FILE "/tmp/MACstateTransitions.bin"
+#define UWSTATETRACER_DEFAULT_BUFFER 8192 /**< Records kept in memory. */
+
+/**
+ * Record of a trace file. A file is UWSTATETRACER_MAGIC followed by records
+ * of fixed size in the byte order of the host. A name record (type other
+ * than TRANSITION) refers to the state or reason in from, and is followed by
+ * the name itself, aux bytes padded to a whole number of records.
+ */
+struct uwstatetracer_record {
+	/**
+	 * Type of a record.
+	 */
+	enum record_type : uint8_t {
+		TRANSITION = 0, /**< State transition of a node. */
+		PROTOCOL_NAME, /**< Name of the protocol. */
+		STATE_NAME, /**< Name of a state. */
+		REASON_NAME, /**< Name of a reason. */
+		EXTRA_NAME, /**< Meaning of extra when entering a state. */
+		AUX_NAME, /**< Meaning of aux when entering a state. */
+		PRINT_NAME, /**< Text printed before the node, if not the name. */
+		REASON_LABEL /**< Text printed before the reason. */
+	};
+
+	double time; /**< Time of the transition [s]. */
+	double extra; /**< Value attached to the transition, e.g. a backoff. */
+	int32_t node; /**< Address of the node. */
+	int32_t aux; /**< Integer attached to the transition, or length of the
+					name. */
+	int16_t from; /**< Previous state. */
+	int16_t to; /**< New state. */
+	int16_t reason; /**< Reason of the transition. */
+	uint8_t protocol; /**< Id of the protocol. */
+	uint8_t type; /**< record_type of the record. */
+};
+
+static_assert(sizeof(uwstatetracer_record) == 32,
+		"uwstatetracer_record must be 32 bytes");
+
+/**
+ * Tracer of the state transitions of the MAC protocols. Transitions are
+ * stored as fixed size binary records in a buffer shared by all the modules
+ * of the process, written to the trace file in a single block when the buffer
+ * is full and at exit. The names of the states and of the reasons are written
+ * once per protocol, so that the uwstatetracer-decode tool can print the
+ * trace as text.
+ */
+class UwStateTracer
+{
+public:
+	/**
+	 * Returns the tracer of the process.
+	 *
+	 * @return UwStateTracer& the tracer
+	 */
+	static UwStateTracer &instance();
+
+	/**
+	 * Sets the trace file. The file is truncated when the first block is
+	 * written; if another file was in use, it is flushed and closed. The
+	 * names of the protocols are written only once, so the file has to be
+	 * set before the protocols are added.
+	 *
+	 * @param file Name of the trace file
+	 */
+	void setFile(const std::string &file);
+
+	/**
+	 * Sets the number of records kept in memory before writing them.
+	 *
+	 * @param records Number of records, at least 1
+	 */
+	void setBufferSize(size_t records);
+
+	/**
+	 * Returns the id of a protocol.
+	 *
+	 * @param name Name of the protocol
+	 * @return int Id of the protocol, -1 if not added yet
+	 */
+	int getProtocol(const std::string &name) const;
+
+	/**
+	 * Adds a protocol, if not added yet.
+	 *
+	 * @param name Name of the protocol
+	 * @return int Id of the protocol
+	 */
+	int addProtocol(const std::string &name);
+
+	/**
+	 * Sets the name of a state of a protocol.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param state State
+	 * @param name Name of the state
+	 */
+	void setStateName(int protocol, int state, const std::string &name);
+
+	/**
+	 * Sets the name of a reason of a protocol.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param reason Reason
+	 * @param name Name of the reason
+	 */
+	void setReasonName(int protocol, int reason, const std::string &name);
+
+	/**
+	 * Sets the meaning of the extra value of the transitions to a state.
+	 * Without a name, the extra value of those transitions is not printed.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param state State entered
+	 * @param name Meaning of the extra value
+	 */
+	void setExtraName(int protocol, int state, const std::string &name);
+
+	/**
+	 * Sets the meaning of the aux value of the transitions to a state.
+	 * Without a name, the aux value of those transitions is not printed.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param state State entered
+	 * @param name Meaning of the aux value
+	 */
+	void setAuxName(int protocol, int state, const std::string &name);
+
+	/**
+	 * Sets the text printed between the time and the node in the text
+	 * lines of a protocol. Without it, two spaces and the name of the
+	 * protocol are printed.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param name Text printed before the node
+	 */
+	void setPrintName(int protocol, const std::string &name);
+
+	/**
+	 * Sets the text printed between the new state and the reason in the
+	 * text lines of a protocol. Without it, ". Reason: " is printed.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param label Text printed before the reason
+	 */
+	void setReasonLabel(int protocol, const std::string &label);
+
+	/**
+	 * Sets the names of all the states in a map.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param names Map from the states to their names
+	 */
+	template <class Map>
+	void
+	setStateNames(int protocol, const Map &names)
+	{
+		for (const auto &elem : names)
+			setStateName(protocol, elem.first, elem.second);
+	}
+
+	/**
+	 * Sets the names of all the reasons in a map.
+	 *
+	 * @param protocol Id of the protocol
+	 * @param names Map from the reasons to their names
+	 */
+	template <class Map>
+	void
+	setReasonNames(int protocol, const Map &names)
+	{
+		for (const auto &elem : names)
+			setReasonName(protocol, elem.first, elem.second);
+	}
+
+	/**
+	 * Traces a state transition.
+	 *
+	 * @param time Time of the transition [s]
+	 * @param protocol Id of the protocol
+	 * @param node Address of the node
+	 * @param from Previous state
+	 * @param to New state
+	 * @param reason Reason of the transition
+	 * @param extra Value attached to the transition
+	 * @param aux Integer attached to the transition
+	 */
+	void
+	trace(double time, int protocol, int node, int from, int to, int reason,
+			double extra = 0, int aux = 0)
+	{
+		uwstatetracer_record &r = next();
+		r.time = time;
+		r.extra = extra;
+		r.node = node;
+		r.aux = aux;
+		r.from = from;
+		r.to = to;
+		r.reason = reason;
+		r.protocol = protocol;
+		r.type = uwstatetracer_record::TRANSITION;
+	}
+
+	/**
+	 * Writes the records in memory to the trace file.
+	 */
+	void flush();
+
+protected:
+	/**
+	 * Constructor of UwStateTracer class.
+	 */
+	UwStateTracer();
+
+	/**
+	 * Destructor of UwStateTracer class, flushes the records in memory.
+	 */
+	~UwStateTracer();
+
+	/**
+	 * Returns the next free record of the buffer, flushing it if full.
+	 *
+	 * @return uwstatetracer_record& the record
+	 */
+	uwstatetracer_record &
+	next()
+	{
+		if (used == buffer.size())
+			flush();
+		return buffer[used++];
+	}
+
+	/**
+	 * Appends a name record followed by the name.
+	 *
+	 * @param type Type of the record
+	 * @param protocol Id of the protocol
+	 * @param id State or reason the name refers to
+	 * @param name Name
+	 */
+	void addName(uint8_t type, int protocol, int id, const std::string &name);
+
+	std::vector<uwstatetracer_record> buffer; /**< Records in memory. */
+	size_t used; /**< Number of records in memory. */
+	std::vector<std::string> protocols; /**< Names of the protocols. */
+	std::string file_name; /**< Name of the trace file. */
+	std::ofstream out; /**< Trace file, opened at the first flush. */
+	bool failed; /**< true if the trace file could not be opened. */
+};
+
+#endif /* UWSTATETRACER_H */